@@ -262,20 +262,114 @@ inline void eval_subtract(complex_adaptor<Backend>& result, const complex_adapto
    eval_subtract(result.real_data(), o.real_data());
    eval_subtract(result.imag_data(), o.imag_data());
 }
+
+//
+// At and above this precision, where multiplications cost much more than additions,
+// squaring takes 2 real multiplications rather than 4, and other products take 3 using
+// Gauss's method when that's nearly as accurate as the usual form:
+//
+#ifdef BOOST_MP_COMPLEX_ADAPTOR_GAUSS_MULTIPLY_BITS
+constexpr std::size_t complex_adaptor_gauss_multiply_bits = BOOST_MP_COMPLEX_ADAPTOR_GAUSS_MULTIPLY_BITS;
+#else
+constexpr std::size_t complex_adaptor_gauss_multiply_bits = 1000;
+#endif
+
 template <class Backend>
-inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& o)
+inline std::size_t complex_adaptor_precision_bits(const Backend& val, const std::integral_constant<bool, true>&)
+{
+   return boost::multiprecision::detail::digits10_2_2(val.precision());
+}
+template <class Backend>
+inline constexpr std::size_t complex_adaptor_precision_bits(const Backend&, const std::integral_constant<bool, false>&)
+{
+   return boost::multiprecision::detail::digits10_2_2(std::numeric_limits<number<Backend> >::digits10);
+}
+template <class Backend>
+inline bool complex_adaptor_use_gauss(const Backend& val)
 {
+   return complex_adaptor_precision_bits(val, std::integral_constant<bool, boost::multiprecision::detail::is_variable_precision<Backend>::value>()) >= complex_adaptor_gauss_multiply_bits;
+}
+template <class Backend>
+inline bool complex_adaptor_components_comparable(const Backend& a, const Backend& b)
+{
+   //
+   // Gauss's method computes ad + bc as c(a + b) + a(d - c), so the error is no longer bounded
+   // by |ad| + |bc| but by |ac| + |ad| + |bc| + |bd|, which is only a few bits worse when
+   // a and b, and c and d, have similar magnitudes.  Zeros and non-finite values use the usual
+   // form, so that signed zeros and infinities come out the same:
+   //
+   using default_ops::eval_fpclassify;
+   using default_ops::eval_ilogb;
+   if ((eval_fpclassify(a) != FP_NORMAL) || (eval_fpclassify(b) != FP_NORMAL))
+      return false;
+   const typename Backend::exponent_type ea = eval_ilogb(a);
+   const typename Backend::exponent_type eb = eval_ilogb(b);
+   return (ea > eb ? ea - eb : eb - ea) <= 4;
+}
+
+template <class Backend>
+inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& a, const complex_adaptor<Backend>& b)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_multiply;
+   using default_ops::eval_subtract;
+
    Backend t1, t2, t3;
-   eval_multiply(t1, result.real_data(), o.real_data());
-   eval_multiply(t2, result.imag_data(), o.imag_data());
+   if (complex_adaptor_use_gauss(a.real_data()))
+   {
+      using default_ops::eval_fpclassify;
+      using default_ops::eval_is_zero;
+      using default_ops::eval_signbit;
+      if ((&a == &b) && (eval_fpclassify(a.real_data()) == FP_NORMAL) && (eval_fpclassify(a.imag_data()) == FP_NORMAL))
+      {
+         // (x + iy)^2 = (x + y)(x - y) + 2ixy
+         eval_add(t1, a.real_data(), a.imag_data());
+         eval_subtract(t2, a.real_data(), a.imag_data());
+         eval_multiply(t3, t1, t2);
+         eval_multiply(t1, a.real_data(), a.imag_data());
+         eval_add(t1, t1);
+         result.real_data() = std::move(t3);
+         result.imag_data() = std::move(t1);
+         return;
+      }
+      if (complex_adaptor_components_comparable(a.real_data(), a.imag_data()) && complex_adaptor_components_comparable(b.real_data(), b.imag_data()))
+      {
+         // (x + iy)(u + iv) = (k1 - k3) + i(k1 + k2), where
+         // k1 = u(x + y), k2 = x(v - u), k3 = y(u + v)
+         Backend k;
+         eval_add(t1, a.real_data(), a.imag_data());
+         eval_multiply(k, b.real_data(), t1);
+         eval_subtract(t1, b.imag_data(), b.real_data());
+         eval_multiply(t2, a.real_data(), t1);
+         eval_add(t1, b.real_data(), b.imag_data());
+         eval_multiply(t3, a.imag_data(), t1);
+         eval_add(t2, k);
+         eval_subtract(k, t3);
+         // Exact cancellation gives +0 in the usual form, whatever the signs of the parts here:
+         if (eval_is_zero(k) && eval_signbit(k))
+            k.negate();
+         if (eval_is_zero(t2) && eval_signbit(t2))
+            t2.negate();
+         result.real_data() = std::move(k);
+         result.imag_data() = std::move(t2);
+         return;
+      }
+   }
+   eval_multiply(t1, a.real_data(), b.real_data());
+   eval_multiply(t2, a.imag_data(), b.imag_data());
    eval_subtract(t3, t1, t2);
-   eval_multiply(t1, result.real_data(), o.imag_data());
-   eval_multiply(t2, result.imag_data(), o.real_data());
+   eval_multiply(t1, a.real_data(), b.imag_data());
+   eval_multiply(t2, a.imag_data(), b.real_data());
    eval_add(t1, t2);
    result.real_data() = std::move(t3);
    result.imag_data() = std::move(t1);
 }
 template <class Backend>
+inline void eval_multiply(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& o)
+{
+   eval_multiply(result, result, o);
+}
+template <class Backend>
 inline void eval_divide(complex_adaptor<Backend>& result, const complex_adaptor<Backend>& z)
 {
    // (a+bi) / (c + di)
@@ -513,14 +607,24 @@ inline void eval_sqrt(complex_adaptor<Backend>& result, const complex_adaptor<Ba
    }
 }
 
+template <class Backend>
+inline void eval_norm(Backend& result, const complex_adaptor<Backend>& val)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_multiply;
+
+   Backend t;
+   eval_multiply(t, val.imag_data(), val.imag_data());
+   eval_multiply(result, val.real_data(), val.real_data());
+   eval_add(result, t);
+}
+
 template <class Backend>
 inline void eval_abs(Backend& result, const complex_adaptor<Backend>& val)
 {
-   Backend t1, t2;
-   eval_multiply(t1, val.real_data(), val.real_data());
-   eval_multiply(t2, val.imag_data(), val.imag_data());
-   eval_add(t1, t2);
-   eval_sqrt(result, t1);
+   Backend t;
+   eval_norm(t, val);
+   eval_sqrt(result, t);
 }
 
 template <class Backend>
@@ -618,9 +722,7 @@ inline void eval_log(complex_adaptor<Backend>& result, const complex_adaptor<Bac
    }
 
    Backend t1, t2;
-   eval_multiply(t1, arg.real_data(), arg.real_data());
-   eval_multiply(t2, arg.imag_data(), arg.imag_data());
-   eval_add(t1, t2);
+   eval_norm(t1, arg);
    eval_log(t2, t1);
    eval_ldexp(result.real_data(), t2, -1);
    eval_atan2(result.imag_data(), arg.imag_data(), arg.real_data());
@@ -23,6 +23,7 @@
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/detail/float128_functions.hpp>
 #include <boost/multiprecision/detail/functions/trunc.hpp>
+#include <boost/multiprecision/detail/newton_division.hpp>
 
 //
 // Some includes we need from Boost.Math, since we rely on that library to provide these functions:
@@ -1169,6 +1170,210 @@ inline typename std::enable_if<boost::multiprecision::detail::is_signed<S>::valu
    eval_multiply(res, res, b);
 }
 
+//
+// Fused multiply-add: res = c + a * b, or c - a * b when subtract is set, with a single rounding.
+// The exact product and c are aligned in an integer wide enough for both, except that when
+// one lies entirely below the rounding point of the other, the bits which can only affect
+// rounding as a "sticky" bit are folded into one:
+//
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void do_eval_multiply_add(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& c, bool subtract)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_get_sign;
+   using default_ops::eval_left_shift;
+   using default_ops::eval_lsb;
+   using default_ops::eval_msb;
+   using default_ops::eval_multiply;
+   using default_ops::eval_right_shift;
+   using default_ops::eval_subtract;
+
+   using float_type = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using wide_type  = cpp_int_backend<std::is_void<Allocator>::value ? 2 * float_type::bit_count + 64 : 0, 2 * float_type::bit_count + 64, std::is_void<Allocator>::value ? unsigned_magnitude : signed_magnitude, unchecked, Allocator>;
+
+   constexpr std::intmax_t bit_count = float_type::bit_count;
+   //
+   // Special values and zeros, and products which certainly overflow or underflow,
+   // gain nothing from fusion:
+   //
+   bool two_step = (a.exponent() > float_type::max_exponent) || (b.exponent() > float_type::max_exponent) || (c.exponent() > float_type::max_exponent);
+   if (!two_step && (a.exponent() > 0) && (b.exponent() > 0))
+      two_step = float_type::max_exponent + 2 - a.exponent() < b.exponent();
+   if (!two_step && (a.exponent() < 0) && (b.exponent() < 0))
+      two_step = float_type::min_exponent - 2 - a.exponent() > b.exponent();
+   wide_type p, m;
+   std::intmax_t p_scale = 0, c_scale = 0, scale = 0;
+   if (!two_step)
+   {
+      eval_multiply(p, a.bits(), b.bits());
+      // Each value is its integer times 2^scale:
+      p_scale                 = static_cast<std::intmax_t>(a.exponent()) + b.exponent() - 2 * (bit_count - 1);
+      c_scale                 = static_cast<std::intmax_t>(c.exponent()) - (bit_count - 1);
+      const std::intmax_t top = (std::max)(p_scale + static_cast<std::intmax_t>(eval_msb(p)), static_cast<std::intmax_t>(c.exponent()));
+      scale                   = (std::max)((std::min)(p_scale, c_scale), top - 2 * bit_count - 4);
+      // The exponent we pass to copy_and_round must be representable:
+      two_step = scale + bit_count - 2 < static_cast<std::intmax_t>((std::numeric_limits<Exponent>::min)());
+   }
+   if (two_step)
+   {
+      float_type t;
+      eval_multiply(t, a, b);
+      if (subtract)
+         eval_subtract(res, c, t);
+      else
+         eval_add(res, c, t);
+      return;
+   }
+
+   m = c.bits();
+   //
+   // Bring both to 2^(scale - 1), anything below 2^scale becomes the sticky bit:
+   //
+   const auto align = [scale](wide_type& x, std::intmax_t x_scale) {
+      if (x_scale >= scale)
+         eval_left_shift(x, static_cast<double_limb_type>(x_scale - scale + 1));
+      else
+      {
+         bool sticky = static_cast<std::intmax_t>(eval_lsb(x)) < scale - x_scale;
+         eval_right_shift(x, static_cast<double_limb_type>(scale - x_scale));
+         eval_left_shift(x, 1u);
+         if (sticky)
+            eval_add(x, static_cast<limb_type>(1u));
+      }
+   };
+   align(p, p_scale);
+   align(m, c_scale);
+
+   const bool p_sign = (a.sign() != b.sign()) != subtract;
+   bool       r_sign = c.sign();
+   if (p_sign == r_sign)
+      eval_add(m, p);
+   else if (m.compare(p) >= 0)
+      eval_subtract(m, p);
+   else
+   {
+      eval_subtract(p, m);
+      m.swap(p);
+      r_sign = p_sign;
+   }
+   if (eval_get_sign(m) == 0)
+   {
+      // Exact cancellation gives +0:
+      res.exponent() = float_type::exponent_zero;
+      res.bits()     = static_cast<limb_type>(0u);
+      res.sign()     = false;
+      return;
+   }
+   //
+   // Overflow and underflow are detected here rather than in copy_and_round, as the
+   // final exponent need not be representable:
+   //
+   const std::intmax_t e       = scale - 1 + bit_count - 1;
+   const std::intmax_t final_e = e + static_cast<std::intmax_t>(eval_msb(m)) - (bit_count - 1);
+   if (final_e > float_type::max_exponent)
+   {
+      res.exponent() = float_type::exponent_infinity;
+      res.bits()     = static_cast<limb_type>(0u);
+      res.sign()     = r_sign;
+      return;
+   }
+   if (final_e < float_type::min_exponent - 1)
+   {
+      res.exponent() = float_type::exponent_zero;
+      res.bits()     = static_cast<limb_type>(0u);
+      res.sign()     = r_sign;
+      return;
+   }
+   res.exponent() = static_cast<Exponent>(e);
+   copy_and_round(res, m);
+   res.sign() = r_sign;
+   res.check_invariants();
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_multiply_add(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b)
+{
+   do_eval_multiply_add(res, a, b, res, false);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_multiply_subtract(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b)
+{
+   do_eval_multiply_add(res, a, b, res, true);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_multiply_add(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& c)
+{
+   do_eval_multiply_add(res, a, b, c, false);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_multiply_subtract(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b,
+   const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& c)
+{
+   // a * b - c == -(c - a * b):
+   do_eval_multiply_add(res, a, b, c, true);
+   if (res.exponent() != cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::exponent_zero)
+      res.negate();
+}
+
+//
+// At and above these precisions division and square root find the result to a few bits
+// more than are needed by Newton iteration, see detail/newton_division.hpp, and only
+// compute the exact remainder in the rare cases where those bits don't decide the rounding:
+//
+#ifdef BOOST_MP_CPP_BIN_FLOAT_NEWTON_DIVISION_BITS
+constexpr std::ptrdiff_t cpp_bin_float_newton_division_bits = BOOST_MP_CPP_BIN_FLOAT_NEWTON_DIVISION_BITS;
+#else
+constexpr std::ptrdiff_t cpp_bin_float_newton_division_bits = 2000;
+#endif
+#ifdef BOOST_MP_CPP_BIN_FLOAT_NEWTON_SQRT_BITS
+constexpr std::ptrdiff_t cpp_bin_float_newton_sqrt_bits = BOOST_MP_CPP_BIN_FLOAT_NEWTON_SQRT_BITS;
+#else
+constexpr std::ptrdiff_t cpp_bin_float_newton_sqrt_bits = 1000000;
+#endif
+
+namespace detail {
+
+constexpr std::size_t cpp_bin_float_newton_guard_bits = sizeof(limb_type) * CHAR_BIT;
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE, class Backend2, class Backend3>
+bool newton_divide(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res, const Backend2& u, const Backend3& v)
+{
+   //
+   // res has its sign and exponent set as for a quotient u / v with bit_count bits,
+   // returns false without changing res if the rounding can't be decided here:
+   //
+   constexpr std::size_t g = cpp_bin_float_newton_guard_bits;
+   constexpr std::size_t n = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count + g;
+   cpp_int               t, d;
+   t.backend() = u;
+   d.backend() = v;
+   t <<= n + g;
+   d <<= g;
+   cpp_int q = boost::multiprecision::detail::newton_quotient(t, d, n);
+   if (!boost::multiprecision::detail::newton_can_round(q, g))
+      return false;
+   res.exponent() -= static_cast<Exponent>(g);
+   copy_and_round(res, q.backend());
+   return true;
+}
+
+} // namespace detail
+
 template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE,
    class Allocator2, class Exponent2, Exponent MinE2, Exponent MaxE2,
    class Allocator3, class Exponent3, Exponent MinE3, Exponent MaxE3>
@@ -1294,6 +1499,8 @@ inline void eval_divide(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, Mi
    //
    // Now get the quotient and remainder:
    //
+   if ((cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count >= cpp_bin_float_newton_division_bits) && detail::newton_divide(res, u.bits(), v.bits()))
+      return;
    typename cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::double_rep_type t(u.bits()), t2(v.bits()), q, r;
    eval_left_shift(t, cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count);
    eval_qr(t, t2, q, r);
@@ -1951,6 +2158,31 @@ inline void eval_sqrt(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE
       return;
    }
 
+   typename cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::exponent_type ae = arg.exponent();
+   if (cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count >= cpp_bin_float_newton_sqrt_bits)
+   {
+      //
+      // Find the root to a few more bits than we need by Newton iteration, which nearly
+      // always decides the rounding without the remainder:
+      //
+      constexpr std::size_t g = detail::cpp_bin_float_newton_guard_bits;
+      constexpr std::size_t n = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count + g;
+      cpp_int               a;
+      a.backend() = arg.bits();
+      a <<= (ae & 1 ? n : n - 1) + g;
+      a = boost::multiprecision::detail::newton_root(a, n);
+      if (boost::multiprecision::detail::newton_can_round(a, g))
+      {
+         res.exponent() = ae / 2;
+         res.sign()     = false;
+         if ((ae & 1) && (ae < 0))
+            --res.exponent();
+         res.exponent() -= static_cast<Exponent>(g);
+         copy_and_round(res, a.backend());
+         return;
+      }
+   }
+
    typename cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::double_rep_type t(arg.bits()), r, s;
    eval_left_shift(t, arg.exponent() & 1 ? cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count : cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count - 1);
    eval_integer_sqrt(s, r, t);
@@ -1963,7 +2195,6 @@ inline void eval_sqrt(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE
          eval_increment(s);
       }
    }
-   typename cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::exponent_type ae = arg.exponent();
    res.exponent()                                                                               = ae / 2;
    res.sign() = false;
    if ((ae & 1) && (ae < 0))
@@ -2146,6 +2377,7 @@ using boost::multiprecision::signbit;
 
 #include <boost/multiprecision/cpp_bin_float/io.hpp>
 #include <boost/multiprecision/cpp_bin_float/transcendental.hpp>
+#include <boost/multiprecision/cpp_bin_float/binary_codec.hpp>
 
 namespace std {
 
@@ -0,0 +1,155 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Binary encoding of cpp_bin_float, see boost/multiprecision/detail/binary_codec.hpp for the format.
+// The mantissa is written without its trailing zero bits, so values with short mantissas
+// (small integers for example) encode compactly, the encoding doesn't depend on the precision
+// of the type, and values can be read into a type of a different precision, rounding to
+// nearest if the destination is narrower.
+//
+
+#ifndef BOOST_MP_CPP_BIN_FLOAT_BINARY_CODEC_HPP
+#define BOOST_MP_CPP_BIN_FLOAT_BINARY_CODEC_HPP
+
+#include <boost/multiprecision/cpp_int/binary_codec.hpp>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+namespace detail {
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline unsigned char binary_codec_flags(const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val) noexcept
+{
+   using float_type = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+
+   unsigned char c;
+   switch (val.exponent())
+   {
+   case float_type::exponent_zero:
+      c = boost::multiprecision::detail::binary_codec_zero;
+      break;
+   case float_type::exponent_infinity:
+      c = boost::multiprecision::detail::binary_codec_infinity;
+      break;
+   case float_type::exponent_nan:
+      c = boost::multiprecision::detail::binary_codec_nan;
+      break;
+   default:
+      c = boost::multiprecision::detail::binary_codec_finite;
+   }
+   return static_cast<unsigned char>(c | (val.sign() ? 4u : 0u));
+}
+
+} // namespace detail
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline std::size_t eval_binary_encoded_size(const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val)
+{
+   using float_type = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using default_ops::eval_lsb;
+
+   if ((val.exponent() == float_type::exponent_zero) || (val.exponent() == float_type::exponent_infinity) || (val.exponent() == float_type::exponent_nan))
+      return 1;
+   std::size_t  low = eval_lsb(val.bits());
+   std::size_t  n   = (float_type::bit_count - low - 1) / CHAR_BIT + 1;
+   std::int64_t e   = static_cast<std::int64_t>(val.exponent()) - static_cast<std::int64_t>(float_type::bit_count - 1) + static_cast<std::int64_t>(low);
+   return 1 + boost::multiprecision::detail::binary_varint_size(boost::multiprecision::detail::binary_zigzag(e)) + boost::multiprecision::detail::binary_varint_size(n) + n;
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_binary_encode(boost::multiprecision::detail::binary_writer& w, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val)
+{
+   using float_type = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using default_ops::eval_lsb;
+
+   unsigned char flags = detail::binary_codec_flags(val);
+   w.write_byte(flags);
+   if ((flags & 3u) != boost::multiprecision::detail::binary_codec_finite)
+      return;
+   // Drop the trailing zeros from the mantissa, so that it's odd:
+   std::size_t  low = eval_lsb(val.bits());
+   std::size_t  n   = (float_type::bit_count - low - 1) / CHAR_BIT + 1;
+   std::int64_t e   = static_cast<std::int64_t>(val.exponent()) - static_cast<std::int64_t>(float_type::bit_count - 1) + static_cast<std::int64_t>(low);
+   w.write_signed_varint(e);
+   w.write_varint(n);
+   detail::binary_codec_store(val.bits(), w.reserve(n), low, n);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+inline void eval_binary_decode(boost::multiprecision::detail::binary_reader& r, cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val)
+{
+   using float_type = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using default_ops::eval_left_shift;
+
+   unsigned char flags = r.read_byte();
+   if (flags > 7u)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+   }
+   val.sign() = flags & 4u;
+   switch (flags & 3u)
+   {
+   case boost::multiprecision::detail::binary_codec_zero:
+      val.exponent() = float_type::exponent_zero;
+      val.bits()     = static_cast<limb_type>(0u);
+      return;
+   case boost::multiprecision::detail::binary_codec_infinity:
+      val.exponent() = float_type::exponent_infinity;
+      val.bits()     = static_cast<limb_type>(0u);
+      return;
+   case boost::multiprecision::detail::binary_codec_nan:
+      val.exponent() = float_type::exponent_nan;
+      val.bits()     = static_cast<limb_type>(0u);
+      return;
+   default:
+      break;
+   }
+   std::int64_t         e = r.read_signed_varint();
+   std::size_t          n = r.read_size();
+   const unsigned char* p = r.read(n);
+   if (!n || !p[n - 1])
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+   }
+   std::size_t bits = (n - 1) * CHAR_BIT + boost::multiprecision::detail::find_msb(p[n - 1]) + 1;
+   // Exponent of the most significant bit, we can't overflow here as bits is bounded by the input size:
+   std::int64_t top = e + static_cast<std::int64_t>(bits - 1);
+   if ((e > static_cast<std::int64_t>(float_type::max_exponent)) || (top > static_cast<std::int64_t>(float_type::max_exponent)))
+   {
+      val.exponent() = float_type::exponent_infinity;
+      val.bits()     = static_cast<limb_type>(0u);
+   }
+   else if (top < static_cast<std::int64_t>(float_type::min_exponent) - 1)
+   {
+      val.exponent() = float_type::exponent_zero;
+      val.bits()     = static_cast<limb_type>(0u);
+   }
+   else if (bits <= float_type::bit_count)
+   {
+      // Fits without rounding, load the bytes straight into the mantissa:
+      detail::binary_codec_load(val.bits(), p, n);
+      eval_left_shift(val.bits(), static_cast<double_limb_type>(float_type::bit_count - bits));
+      if (top < static_cast<std::int64_t>(float_type::min_exponent))
+      {
+         val.exponent() = float_type::exponent_zero;
+         val.bits()     = static_cast<limb_type>(0u);
+      }
+      else
+         val.exponent() = static_cast<Exponent>(top);
+   }
+   else
+   {
+      // Encoded from a wider type, so round to nearest:
+      cpp_int_backend<> t;
+      detail::binary_codec_load(t, p, n);
+      t.normalize();
+      val.exponent() = static_cast<Exponent>(top - static_cast<std::int64_t>(bits - float_type::bit_count));
+      copy_and_round(val, t);
+   }
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif // BOOST_MP_CPP_BIN_FLOAT_BINARY_CODEC_HPP
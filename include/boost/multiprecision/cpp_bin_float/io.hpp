@@ -8,20 +8,57 @@
 
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
+#include <cmath>
+#include <cstring>
+#include <system_error>
+
+//
+// The number of exact powers of 5 cached for conversions to and from decimal, see cached_pow5 below:
+//
+#ifndef BOOST_MP_CPP_BIN_FLOAT_POW5_CACHE_SIZE
+#define BOOST_MP_CPP_BIN_FLOAT_POW5_CACHE_SIZE 256
+#endif
 
 namespace boost { namespace multiprecision {
 namespace cpp_bf_io_detail {
 
+constexpr std::size_t pow5_cache_size = BOOST_MP_CPP_BIN_FLOAT_POW5_CACHE_SIZE;
+
+static_assert(pow5_cache_size > 1, "BOOST_MP_CPP_BIN_FLOAT_POW5_CACHE_SIZE must be at least 2");
+
 //
-// Multiplies a by b and shifts the result so it fits inside max_bits bits,
+// Returns 5^k for k < pow5_cache_size.  The table is built on first use (the initialization of
+// a function local static is thread safe) and is read only thereafter, so it's shared by all
+// threads and all cpp_bin_float types:
+//
+struct pow5_table
+{
+   cpp_int values[pow5_cache_size];
+
+   pow5_table()
+   {
+      values[0] = 1u;
+      for (std::size_t i = 1; i < pow5_cache_size; ++i)
+         values[i] = values[i - 1] * 5u;
+   }
+};
+
+inline const cpp_int& cached_pow5(std::size_t k)
+{
+   static const pow5_table table;
+   BOOST_MP_ASSERT(k < pow5_cache_size);
+   return table.values[k];
+}
+
+//
+// Shifts result right so it fits inside max_bits bits, rounding to nearest, and
 // returns by how much the result was shifted.
 //
 template <class I>
-inline I restricted_multiply(cpp_int& result, const cpp_int& a, const cpp_int& b, I max_bits, std::int64_t& error)
+inline I restricted_round(cpp_int& result, I max_bits, std::int64_t& error)
 {
    using local_integral_type = I;
 
-   result   = a * b;
    local_integral_type gb     = static_cast<local_integral_type>(msb(result));
    local_integral_type rshift = 0;
    if (gb > max_bits)
@@ -52,6 +89,16 @@ inline I restricted_multiply(cpp_int& result, const cpp_int& a, const cpp_int& b
    return rshift;
 }
 //
+// Multiplies a by b and shifts the result so it fits inside max_bits bits,
+// returns by how much the result was shifted.
+//
+template <class I>
+inline I restricted_multiply(cpp_int& result, const cpp_int& a, const cpp_int& b, I max_bits, std::int64_t& error)
+{
+   result = a * b;
+   return restricted_round(result, max_bits, error);
+}
+//
 // Computes a^e shifted to the right so it fits in max_bits, returns how far
 // to the right we are shifted.
 //
@@ -84,6 +131,45 @@ inline I restricted_pow(cpp_int& result, const cpp_int& a, I e, I max_bits, std:
    return exp;
 }
 
+//
+// As restricted_pow(result, 5, e, max_bits, error), but starting from the cached
+// exact powers, so that small powers are subject to at most one rounding:
+//
+template <class I>
+inline I restricted_pow5(cpp_int& result, I e, I max_bits, std::int64_t& error)
+{
+   if (static_cast<std::uintmax_t>(e) < pow5_cache_size)
+   {
+      result = cached_pow5(static_cast<std::size_t>(e));
+      return restricted_round(result, max_bits, error);
+   }
+   I exp = restricted_pow5(result, e / 2, max_bits, error);
+   exp *= 2;
+   exp += restricted_multiply(result, result, result, max_bits, error);
+   if (e & 1)
+      exp += restricted_multiply(result, result, cached_pow5(1), max_bits, error);
+   return exp;
+}
+//
+// Multiplies val by the exact value 5^e:
+//
+template <class Integer>
+inline void multiply_pow5(Integer& val, std::uintmax_t e)
+{
+   if (e < 8 * pow5_cache_size)
+   {
+      // A few multiplications by table entries are cheaper than computing the power:
+      for (; e >= pow5_cache_size; e -= pow5_cache_size - 1)
+         eval_multiply(val.backend(), cached_pow5(pow5_cache_size - 1).backend());
+      eval_multiply(val.backend(), cached_pow5(static_cast<std::size_t>(e)).backend());
+   }
+   else
+   {
+      BOOST_MP_ASSERT(e <= (std::numeric_limits<unsigned>::max)());
+      val *= pow(Integer(5u), static_cast<unsigned>(e));
+   }
+}
+
 inline int get_round_mode(const cpp_int& what, std::int64_t location, std::int64_t error)
 {
    //
@@ -302,7 +388,7 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
          cpp_int t;
          if (decimal_exp)
          {
-            calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow(t, cpp_int(5), decimal_exp, max_bits, error);
+            calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow5(t, decimal_exp, max_bits, error);
             calc_exp += boost::multiprecision::cpp_bf_io_detail::restricted_multiply(t, t, n, max_bits, error);
          }
          else
@@ -363,7 +449,7 @@ cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& cpp_bin_float
       do
       {
          cpp_int d;
-         calc_exp                   = boost::multiprecision::cpp_bf_io_detail::restricted_pow(d, cpp_int(5), -decimal_exp, max_bits, error);
+         calc_exp                   = boost::multiprecision::cpp_bf_io_detail::restricted_pow5(d, -decimal_exp, max_bits, error);
          const std::ptrdiff_t shift = static_cast<std::ptrdiff_t>(static_cast<std::ptrdiff_t>(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count) - static_cast<std::ptrdiff_t>(msb(n)) + static_cast<std::ptrdiff_t>(msb(d)));
          final_exponent             = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count - 1 + decimal_exp - calc_exp;
          if (shift > 0)
@@ -555,12 +641,12 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
                BOOST_MP_ASSERT(power10 <= (std::intmax_t)INT_MAX);
                i <<= -shift;
                if (power10)
-                  i *= pow(cpp_int(5), static_cast<unsigned>(power10));
+                  boost::multiprecision::cpp_bf_io_detail::multiply_pow5(i, static_cast<std::uintmax_t>(power10));
             }
             else if (power10 < 0)
             {
                cpp_int d;
-               calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow(d, cpp_int(5), -power10, max_bits, error);
+               calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow5(d, -power10, max_bits, error);
                shift += calc_exp;
                BOOST_MP_ASSERT(shift < 0); // Must still be true!
                i <<= -shift;
@@ -589,7 +675,7 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
                if (power10)
                {
                   cpp_int t;
-                  calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow(t, cpp_int(5), power10, max_bits, error);
+                  calc_exp = boost::multiprecision::cpp_bf_io_detail::restricted_pow5(t, power10, max_bits, error);
                   calc_exp += boost::multiprecision::cpp_bf_io_detail::restricted_multiply(i, i, t, max_bits, error);
                   shift -= calc_exp;
                }
@@ -628,7 +714,8 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
                // get zero as a result, and that case is already handled above:
                cpp_int r;
                BOOST_MP_ASSERT(-power10 < INT_MAX);
-               cpp_int d = pow(cpp_int(5), static_cast<unsigned>(-power10));
+               cpp_int d = 1u;
+               boost::multiprecision::cpp_bf_io_detail::multiply_pow5(d, static_cast<std::uintmax_t>(-power10));
                d <<= shift;
                divide_qr(i, d, i, r);
                r <<= 1;
@@ -695,6 +782,459 @@ std::string cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::s
 }
 
 } // namespace backends
+
+namespace cpp_bf_io_detail {
+
+//
+// Multiplies val by 10^k:
+//
+template <class Integer>
+inline void multiply_pow10(Integer& val, std::intmax_t k)
+{
+   multiply_pow5(val, static_cast<std::uintmax_t>(k));
+   val <<= static_cast<std::size_t>(k);
+}
+
+//
+// Writes the value of v, which is less than 10^n, as exactly n decimal digits with leading zeros:
+//
+template <class Integer>
+void integer_digits(Integer v, char* p, std::size_t n)
+{
+   const Integer chunk(static_cast<std::uint64_t>(10000000000000000000uLL));
+   Integer       q, r;
+   while (n)
+   {
+      divide_qr(v, chunk, q, r);
+      v.swap(q);
+      std::uint64_t c = static_cast<std::uint64_t>(r);
+      for (unsigned i = 0; n && (i < 19); ++i, c /= 10)
+         p[--n] = static_cast<char>('0' + c % 10);
+   }
+}
+
+//
+// Writes the n digit decimal string p + delta to result, the result must be positive and less than 10^n:
+//
+inline void add_to_digits(const char* p, char* result, std::size_t n, std::int64_t delta)
+{
+   int           carry = 0;
+   std::uint64_t ad = delta < 0 ? static_cast<std::uint64_t>(-delta) : static_cast<std::uint64_t>(delta);
+   while (n--)
+   {
+      int d = p[n] - '0' + (delta < 0 ? -static_cast<int>(ad % 10) : static_cast<int>(ad % 10)) + carry;
+      ad /= 10;
+      carry = d < 0 ? -1 : d > 9 ? 1 : 0;
+      result[n] = static_cast<char>('0' + d - 10 * carry);
+   }
+   BOOST_MP_ASSERT(carry == 0);
+}
+
+//
+// Generates the shortest string of decimal digits which reads back as r * 2^e, and is nearest
+// to it when there's a choice, as in the "free format" algorithm of Burger and Dybvig (Printing
+// Floating-Point Numbers Quickly and Accurately, 1996) with exact integer arithmetic, so it works
+// for any precision.  The values which read back as r * 2^e are those strictly between the midpoints
+// with its neighbours, and the midpoints themselves too if inclusive is set (r is even, and ties
+// round to even).  When r is a power of 2 the next value down is twice as close as the next value up.
+//
+// Rather than generating one digit at a time, we find the range [lo, hi] of integers c for which
+// c * 10^-precision reads back as r * 2^e, where precision is enough digits for there to always be
+// one.  The answer is then the common prefix of lo and hi plus at most one more digit.  lo and hi
+// differ from v * 10^precision by only a few units, so this takes one full sized division and one
+// conversion to decimal whatever the precision.
+//
+// On entry k must be no greater than the decimal exponent of the result, on exit the result
+// is 0.d1d2d3... * 10^k.  digits must have room for 3 * precision characters, the last 2/3 are
+// used as working space.  Returns the number of digits in the result.
+//
+template <class Integer>
+std::size_t shortest_digits(Integer r, std::intmax_t e, bool closer_below, bool inclusive, std::size_t precision, char* digits, std::intmax_t& k)
+{
+   //
+   // Scale so that v = r / s, and the distances to the midpoints above and below are mp / s and mm / s:
+   //
+   BOOST_MP_ASSERT(precision);
+   const unsigned extra = closer_below ? 2 : 1;
+   Integer        s(1u), mp(1u), mm(1u), t;
+   if (e >= 0)
+   {
+      r <<= static_cast<std::size_t>(e) + extra;
+      s <<= extra;
+      mm <<= static_cast<std::size_t>(e);
+   }
+   else
+   {
+      r <<= extra;
+      s <<= static_cast<std::size_t>(extra - e);
+   }
+   if (k >= 0)
+      multiply_pow10(s, k);
+   else
+   {
+      multiply_pow10(r, -k);
+      multiply_pow10(mm, -k);
+   }
+   mp = mm;
+   if (closer_below)
+      mp <<= 1u;
+   //
+   // Correct k if it was an underestimate, when v + mp / s >= 1:
+   //
+   for (;;)
+   {
+      t = r;
+      t += mp;
+      int c = t.compare(s);
+      if (inclusive ? c < 0 : c <= 0)
+         break;
+      s *= 10u;
+      ++k;
+   }
+   //
+   // Now 0.1 <= v + mp / s < 1, so hi has exactly precision digits.  Find q and rem with
+   // v * 10^precision = q + rem / s, then lo and hi are within a few units of q:
+   //
+   multiply_pow10(r, static_cast<std::intmax_t>(precision));
+   multiply_pow10(mm, static_cast<std::intmax_t>(precision));
+   Integer q, rem, qm, rm;
+   divide_qr(r, s, q, rem);
+   divide_qr(mm, s, qm, rm);
+   BOOST_MP_ASSERT(qm < 1000u);
+   // lo is the first integer above (or at if inclusive) q + (rem - mm) / s:
+   std::int64_t delta_lo = -static_cast<std::int64_t>(qm);
+   if (rem.compare(rm) < 0)
+   {
+      --delta_lo;
+      t = s;
+      t -= rm;
+      t += rem;
+   }
+   else
+   {
+      t = rem;
+      t -= rm;
+   }
+   if (!inclusive || !t.is_zero())
+      ++delta_lo;
+   // hi is the last integer below (or at if inclusive) q + (rem + mp) / s:
+   std::int64_t delta_hi = static_cast<std::int64_t>(qm);
+   t                     = rm;
+   if (closer_below)
+   {
+      delta_hi *= 2;
+      t <<= 1u;
+   }
+   t += rem;
+   while (t.compare(s) >= 0)
+   {
+      t -= s;
+      ++delta_hi;
+   }
+   if (!inclusive && t.is_zero())
+      --delta_hi;
+   BOOST_MP_ASSERT(delta_lo <= delta_hi);
+
+   char* lo_digits = digits + precision;
+   char* q_digits  = digits + 2 * precision;
+   integer_digits(q, q_digits, precision);
+   add_to_digits(q_digits, digits, precision, delta_hi);
+   add_to_digits(q_digits, lo_digits, precision, delta_lo);
+   std::size_t i = 0;
+   while ((i < precision) && (digits[i] == lo_digits[i]))
+      ++i;
+   std::size_t j = precision;
+   while ((j > i) && (lo_digits[j - 1] == '0'))
+      --j;
+   if (j == i)
+   {
+      // lo is the common prefix followed by zeros, and is the only value with that few digits:
+      BOOST_MP_ASSERT(i);
+      while (digits[i - 1] == '0')
+         --i;
+      return i;
+   }
+   //
+   // The candidates are the common prefix followed by one digit in [x_min, x_max], pick the one
+   // nearest to v = q + rem / s, whose first i digits are also the common prefix:
+   //
+   const unsigned x_min = static_cast<unsigned>(lo_digits[i] - '0') + (j > i + 1 ? 1u : 0u);
+   const unsigned x_max = static_cast<unsigned>(digits[i] - '0');
+   BOOST_MP_ASSERT(std::memcmp(q_digits, digits, i) == 0);
+   unsigned x = static_cast<unsigned>(q_digits[i] - '0');
+   int      c; // the comparison of the remainder after digit x with 1/2
+   if (i + 1 == precision)
+   {
+      rem <<= 1u;
+      c = rem.compare(s);
+   }
+   else
+   {
+      c = q_digits[i + 1] - '5';
+      if (c == 0)
+      {
+         bool nonzero = !rem.is_zero();
+         for (std::size_t m = i + 2; !nonzero && (m < precision); ++m)
+            nonzero = q_digits[m] != '0';
+         c = nonzero ? 1 : 0;
+      }
+   }
+   if ((c > 0) || ((c == 0) && (x & 1)))
+      ++x;
+   if (x < x_min)
+      x = x_min;
+   if (x > x_max)
+      x = x_max;
+   digits[i] = static_cast<char>('0' + x);
+   return i + 1;
+}
+
+//
+// Writes the digits of |x|, least significant first, and at least BOOST_MP_MIN_EXPONENT_DIGITS of them:
+//
+inline std::size_t exponent_digits(std::intmax_t x, char* exp_digits)
+{
+   std::size_t exp_size = 0;
+   for (std::uintmax_t ax = static_cast<std::uintmax_t>(x < 0 ? -x : x); ax || (exp_size < BOOST_MP_MIN_EXPONENT_DIGITS); ax /= 10)
+      exp_digits[exp_size++] = static_cast<char>('0' + ax % 10);
+   return exp_size;
+}
+
+//
+// Returns true if the digit string of length n whose value is 0.d1d2d3... * 10^k should
+// be written in fixed format: either because it's requested, or because it's no longer
+// than scientific format when neither is requested.
+//
+inline bool use_fixed_format(std::size_t n, std::intmax_t k, std::ios_base::fmtflags f)
+{
+   if ((f & std::ios_base::scientific) == std::ios_base::scientific)
+      return false;
+   if (f & std::ios_base::fixed)
+      return true;
+   char                exp_digits[std::numeric_limits<std::intmax_t>::digits10 + 2];
+   const std::intmax_t sn              = static_cast<std::intmax_t>(n);
+   const std::intmax_t scientific_size = sn + (n > 1 ? 1 : 0) + 2 + static_cast<std::intmax_t>(exponent_digits(k - 1, exp_digits));
+   const std::intmax_t fixed_size      = k >= sn ? k : k > 0 ? sn + 1 : sn + 2 - k;
+   return fixed_size <= scientific_size;
+}
+
+//
+// Writes the digit string [digits, digits + n) whose value is 0.d1d2d3... * 10^k to
+// [first, last), in fixed or scientific format.  Returns nullptr if there's not enough room:
+//
+inline char* format_shortest(char* first, char* last, const char* digits, std::size_t n, std::intmax_t k, bool fixed)
+{
+   const std::intmax_t sn = static_cast<std::intmax_t>(n);
+   const std::intmax_t x  = k - 1; // the exponent in scientific format
+   char                exp_digits[std::numeric_limits<std::intmax_t>::digits10 + 2];
+   std::size_t         exp_size = exponent_digits(x, exp_digits);
+
+   if (fixed)
+   {
+      const std::intmax_t size = k >= sn ? k : k > 0 ? sn + 1 : sn + 2 - k;
+      if (last - first < size)
+         return nullptr;
+      if (k >= sn)
+      {
+         std::memcpy(first, digits, n);
+         std::memset(first + n, '0', static_cast<std::size_t>(k - sn));
+      }
+      else if (k > 0)
+      {
+         std::memcpy(first, digits, static_cast<std::size_t>(k));
+         first[k] = '.';
+         std::memcpy(first + k + 1, digits + k, static_cast<std::size_t>(sn - k));
+      }
+      else
+      {
+         first[0] = '0';
+         first[1] = '.';
+         std::memset(first + 2, '0', static_cast<std::size_t>(-k));
+         std::memcpy(first + 2 - k, digits, n);
+      }
+      return first + size;
+   }
+   const std::size_t size = n + (n > 1 ? 1 : 0) + 2 + exp_size;
+   if (static_cast<std::size_t>(last - first) < size)
+      return nullptr;
+   *first++ = digits[0];
+   if (n > 1)
+   {
+      *first++ = '.';
+      std::memcpy(first, digits + 1, n - 1);
+      first += n - 1;
+   }
+   *first++ = 'e';
+   *first++ = x < 0 ? '-' : '+';
+   while (exp_size)
+      *first++ = exp_digits[--exp_size];
+   return first;
+}
+
+//
+// The number of decimal digits shortest_digits works to for a given number of bits, the
+// buffer passed to it needs 3 times this many characters:
+//
+template <unsigned Bits>
+struct shortest_digits_precision
+{
+   static constexpr std::size_t value = Bits * 30103uL / 100000uL + 2;
+};
+
+//
+// Beyond this many bits of exponent (in excess of the precision), shortest_digits uses
+// the existing decimal conversions rather than exact arithmetic:
+//
+constexpr std::intmax_t shortest_exact_exponent_limit = 4096;
+
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+std::size_t shortest_digits(const backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& val, char* digits, std::intmax_t& k)
+{
+   using float_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+   using default_ops::eval_lsb;
+   //
+   // While the exponent is no larger than the precision, our working values fit in a fixed
+   // precision integer and we don't need to allocate memory:
+   //
+   constexpr std::size_t fixed_bits = 3 * float_type::bit_count + 64;
+   using fixed_type                 = number<backends::cpp_int_backend<fixed_bits, fixed_bits, unsigned_magnitude, unchecked, void>, et_off>;
+
+   const std::intmax_t exp          = val.exponent();
+   const std::intmax_t e            = exp - static_cast<std::intmax_t>(float_type::bit_count - 1);
+   const bool          closer_below = eval_lsb(val.bits()) == float_type::bit_count - 1;
+   const bool          inclusive    = !(val.bits().limbs()[0] & 1u);
+   // Enough decimal digits for there to be one in every rounding interval:
+   const std::size_t   precision    = shortest_digits_precision<float_type::bit_count>::value;
+   // An underestimate of the decimal exponent, as required by shortest_digits:
+   k = static_cast<std::intmax_t>(std::floor(static_cast<double>(exp) * 0.30102999566398119521));
+
+   const std::intmax_t abs_exp = exp < 0 ? -exp : exp;
+   if (abs_exp <= static_cast<std::intmax_t>(float_type::bit_count))
+   {
+      fixed_type r;
+      r.backend() = val.bits();
+      return shortest_digits(r, e, closer_below, inclusive, precision, digits, k);
+   }
+   if (abs_exp <= static_cast<std::intmax_t>(float_type::bit_count) + shortest_exact_exponent_limit)
+   {
+      cpp_int r;
+      r.backend() = val.bits();
+      return shortest_digits(r, e, closer_below, inclusive, precision, digits, k);
+   }
+   //
+   // The exact method needs integers with as many bits as the exponent, so for very large or small
+   // values binary search for the fewest correctly rounded digits which read back as val instead.
+   // This relies on the rounded to nearest digit string being in the rounding interval whenever
+   // any string of the same length is, which is true except when the interval is asymmetric (val
+   // is a power of 2), when we may occasionally produce one more digit than necessary:
+   //
+   float_type abs_val(val);
+   abs_val.sign() = false;
+   std::string best = abs_val.str(std::numeric_limits<number<float_type> >::max_digits10 - 1, std::ios_base::scientific);
+   std::intmax_t lo = 1, hi = std::numeric_limits<number<float_type> >::max_digits10 - 1;
+   while (lo < hi)
+   {
+      const std::intmax_t mid = (lo + hi) / 2;
+      std::string         s   = abs_val.str(mid, std::ios_base::scientific);
+      float_type          t;
+      t = s.c_str();
+      if (t.compare(abs_val) == 0)
+      {
+         hi = mid;
+         best.swap(s);
+      }
+      else
+         lo = mid + 1;
+   }
+   // best is d.ddd...e+xxx, possibly with trailing zeros in the mantissa:
+   std::size_t n = 0;
+   const char* p = best.c_str();
+   for (; *p != 'e'; ++p)
+   {
+      if (*p != '.')
+         digits[n++] = *p;
+   }
+   while ((n > 1) && (digits[n - 1] == '0'))
+      --n;
+   k = std::strtol(p + 1, nullptr, 10) + 1;
+   return n;
+}
+
+} // namespace cpp_bf_io_detail
+
+struct to_chars_result
+{
+   char*     ptr;
+   std::errc ec;
+};
+
+//
+// Writes the shortest decimal string which reads back as val to [first, last) without allocating
+// memory (except for values with very large or small exponents), in the manner of std::to_chars.
+// The format is fixed or scientific if requested in f, and whichever is shorter otherwise.
+// Integers which need more digits than the shortest representation are written exactly in
+// fixed format, which is no longer and closer to the value.
+//
+template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE, expression_template_option ExpressionTemplates>
+to_chars_result to_chars(char* first, char* last, const number<backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>, ExpressionTemplates>& val, std::ios_base::fmtflags f = std::ios_base::fmtflags(0))
+{
+   using float_type = backends::cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>;
+
+   const float_type& b = val.backend();
+   const char*       special = nullptr;
+   switch (b.exponent())
+   {
+   case float_type::exponent_zero:
+      special = (f & std::ios_base::scientific) == std::ios_base::scientific ? "0e+00" : "0";
+      break;
+   case float_type::exponent_infinity:
+      special = "inf";
+      break;
+   case float_type::exponent_nan:
+      special = "nan";
+      break;
+   default:
+      break;
+   }
+   if (b.sign() && (b.exponent() != float_type::exponent_nan))
+   {
+      if (first == last)
+         return {last, std::errc::value_too_large};
+      *first++ = '-';
+   }
+   if (special)
+   {
+      std::size_t n = std::strlen(special);
+      if (static_cast<std::size_t>(last - first) < n)
+         return {last, std::errc::value_too_large};
+      std::memcpy(first, special, n);
+      return {first + n, std::errc()};
+   }
+
+   char          digits[3 * cpp_bf_io_detail::shortest_digits_precision<float_type::bit_count>::value];
+   std::intmax_t k;
+   std::size_t   n = cpp_bf_io_detail::shortest_digits(b, digits, k);
+   BOOST_MP_ASSERT(n <= sizeof(digits));
+   const bool fixed = cpp_bf_io_detail::use_fixed_format(n, k, f);
+   if (fixed && (k > static_cast<std::intmax_t>(n)) && (b.exponent() >= static_cast<Exponent>(float_type::bit_count - 1)))
+   {
+      //
+      // An integer which would be padded with zeros: as with std::to_chars the exact digits
+      // are just as short, and closer to the value:
+      //
+      std::string s = val.str(0, std::ios_base::fixed);
+      std::size_t len = s.size() - (b.sign() ? 1 : 0);
+      if (static_cast<std::size_t>(last - first) < len)
+         return {last, std::errc::value_too_large};
+      std::memcpy(first, s.data() + (b.sign() ? 1 : 0), len);
+      return {first + len, std::errc()};
+   }
+   char* result = cpp_bf_io_detail::format_shortest(first, last, digits, n, k, fixed);
+   if (!result)
+      return {last, std::errc::value_too_large};
+   return {result, std::errc()};
+}
+
 }} // namespace boost::multiprecision
 
 #endif
@@ -7,16 +7,251 @@
 #define BOOST_MP_CPP_BIN_FLOAT_TRANSCENDENTAL_HPP
 
 #include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/binary_splitting.hpp>
+#include <array>
+#include <cmath>
+#include <vector>
 
 namespace boost { namespace multiprecision { namespace backends {
 
+//
+// Above this many bits, the series for exp, log and the trigonometric functions are
+// summed in fixed point by eval_fixed_point_series below, rather than term by term:
+//
+constexpr std::ptrdiff_t cpp_bin_float_fixed_series_bits = 160;
+
+//
+// Sums the hypergeometric series pFq(a; b; x) with half integer parameters, passed as
+// twice their values in a2 and b2, as a fixed point cpp_int scaled by 2^prec.
+//
+// The series is written as the nested product
+//
+// 1 + t[1]x(1 + t[2]x(1 + t[3]x(...)))
+//
+// where t[n] = (a2[0] + 2n - 2)...(a2[p-1] + 2n - 2) 2^(1 + q - p) / (2n (b2[0] + 2n - 2)...(b2[q-1] + 2n - 2))
+//
+// and evaluated by rectangular splitting: with the powers x^1...x^m precomputed, m
+// consecutive levels of the product require only one full multiplication, by x^m,
+// plus a multiplication and division by small integers for each term.  Summing N terms
+// costs about 2sqrt(N) full multiplications, where the term by term methods require N
+// multiplications and N divisions.
+//
+// Returns false, leaving result unchanged, if the series does not converge rapidly enough.
+//
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE, std::size_t P, std::size_t Q>
+bool eval_fixed_point_series(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, const std::array<int, P>& a2, const std::array<int, Q>& b2, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& x)
+{
+   using default_ops::eval_add;
+   using default_ops::eval_divide;
+   using default_ops::eval_left_shift;
+   using default_ops::eval_multiply;
+   using default_ops::eval_right_shift;
+
+   using fixed_type = cpp_int_backend<>;
+
+   constexpr std::ptrdiff_t bits          = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count;
+   constexpr std::ptrdiff_t scale_shift   = 1 + static_cast<std::ptrdiff_t>(Q) - static_cast<std::ptrdiff_t>(P);
+   const std::ptrdiff_t     prec          = bits + 40 + static_cast<std::ptrdiff_t>(msb(static_cast<std::size_t>(bits)));
+   const std::size_t        series_limit  = 4 * static_cast<std::size_t>(prec);
+
+   if (eval_fpclassify(x) == static_cast<int>(FP_ZERO))
+   {
+      result = limb_type(1);
+      return true;
+   }
+   if (eval_fpclassify(x) != static_cast<int>(FP_NORMAL))
+      return false;
+   //
+   // Find how many terms we need from an upper bound on log2 of each term, the
+   // series is assumed to sum to a value of order 1:
+   //
+   const double log2_x    = static_cast<double>(x.exponent()) + 1 + scale_shift;
+   double       log2_term = 0;
+   std::size_t  terms     = 0;
+   for (std::size_t n = 1;; ++n)
+   {
+      double log2_ratio = log2_x - std::log2(2.0 * static_cast<double>(n));
+      bool   last       = false;
+      for (int a : a2)
+      {
+         const double f = static_cast<double>(a) + 2.0 * static_cast<double>(n) - 2;
+         if (f == 0)
+            last = true;
+         else
+            log2_ratio += std::log2(std::fabs(f));
+      }
+      for (int b : b2)
+      {
+         const double f = static_cast<double>(b) + 2.0 * static_cast<double>(n) - 2;
+         if (f == 0)
+            return false;
+         log2_ratio -= std::log2(std::fabs(f));
+      }
+      if (last)
+      {
+         // The series terminates:
+         terms = n - 1;
+         break;
+      }
+      log2_term += log2_ratio;
+      if ((log2_term < -static_cast<double>(prec)) && (log2_ratio < -1))
+      {
+         terms = n;
+         break;
+      }
+      if (n > series_limit)
+         return false;
+   }
+
+   const std::size_t m      = (std::max)(static_cast<std::size_t>(std::sqrt(static_cast<double>(terms))), static_cast<std::size_t>(1u));
+   const std::size_t blocks = (terms + m - 1) / m;
+
+   fixed_type              t;
+   std::vector<fixed_type> powers(m + 1);
+   powers[0] = limb_type(1);
+   eval_left_shift(powers[0], static_cast<double_limb_type>(prec));
+   powers[1] = x.bits();
+   const std::ptrdiff_t shift = static_cast<std::ptrdiff_t>(x.exponent()) - (bits - 1) + prec + scale_shift;
+   if (shift >= 0)
+      eval_left_shift(powers[1], static_cast<double_limb_type>(shift));
+   else
+      eval_right_shift(powers[1], static_cast<double_limb_type>(-shift));
+   if (x.sign())
+      powers[1].negate();
+   for (std::size_t k = 2; k <= m; ++k)
+   {
+      eval_multiply(powers[k], powers[k - 1], powers[1]);
+      eval_right_shift(powers[k], static_cast<double_limb_type>(prec));
+   }
+   //
+   // Multiplies u by t[n], combining the small factors into as few limbs as possible:
+   //
+   const auto apply_ratio = [&a2, &b2](fixed_type& u, std::size_t n) {
+      bool      neg = false;
+      limb_type f   = 1;
+      for (int a : a2)
+      {
+         const std::ptrdiff_t v  = static_cast<std::ptrdiff_t>(a) + 2 * static_cast<std::ptrdiff_t>(n) - 2;
+         const limb_type      av = static_cast<limb_type>(v < 0 ? -v : v);
+         neg                     = neg != (v < 0);
+         if (f > (std::numeric_limits<limb_type>::max)() / av)
+         {
+            eval_multiply(u, f);
+            f = 1;
+         }
+         f *= av;
+      }
+      eval_multiply(u, f);
+      f = static_cast<limb_type>(2 * n);
+      for (int b : b2)
+      {
+         const std::ptrdiff_t v  = static_cast<std::ptrdiff_t>(b) + 2 * static_cast<std::ptrdiff_t>(n) - 2;
+         const limb_type      bv = static_cast<limb_type>(v < 0 ? -v : v);
+         neg                     = neg != (v < 0);
+         if (f > (std::numeric_limits<limb_type>::max)() / bv)
+         {
+            eval_divide(u, f);
+            f = 1;
+         }
+         f *= bv;
+      }
+      eval_divide(u, f);
+      if (neg)
+         u.negate();
+   };
+
+   fixed_type u;
+   u = limb_type(0);
+   for (std::size_t block = blocks; block-- > 0;)
+   {
+      if (block + 1 != blocks)
+      {
+         eval_multiply(t, u, powers[m]);
+         eval_right_shift(t, static_cast<double_limb_type>(prec));
+         u.swap(t);
+      }
+      for (std::size_t j = m; j > 0; --j)
+      {
+         if (block * m + j <= terms)
+            apply_ratio(u, block * m + j);
+         else
+            u = limb_type(0);
+         eval_add(u, powers[j - 1]);
+      }
+   }
+
+   const bool neg = u.sign();
+   if (neg)
+      u.negate();
+   result.exponent() = static_cast<Exponent>(bits - 1 - prec);
+   copy_and_round(result, u);
+   result.sign() = neg && !eval_is_zero(result);
+   return true;
+}
+
+//
+// Returns true if v is a (small) multiple of 1/2, with *twice set to 2v:
+//
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+bool is_half_integer(const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& v, int* twice)
+{
+   using default_ops::eval_convert_to;
+
+   if (eval_fpclassify(v) == static_cast<int>(FP_ZERO))
+   {
+      *twice = 0;
+      return true;
+   }
+   if ((eval_fpclassify(v) != static_cast<int>(FP_NORMAL)) || (v.exponent() > 20))
+      return false;
+   cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> t;
+   eval_ldexp(t, v, 1);
+   eval_convert_to(twice, t);
+   cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> r;
+   r = *twice;
+   return r.compare(t) == 0;
+}
+
+//
+// Overloads of the series used by the generic trigonometric functions, which sum in
+// fixed point when the precision is high and the parameters are half integers, as
+// they always are for sin, cos, asin, acos and atan:
+//
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void hyp0F1(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& x)
+{
+   int bb;
+   if ((cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count < cpp_bin_float_fixed_series_bits)
+      || !is_half_integer(b, &bb)
+      || !eval_fixed_point_series(result, std::array<int, 0>{}, std::array<int, 1>{{bb}}, x))
+      default_ops::hyp0F1(result, b, x);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void hyp2F1(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& a, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& b, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& c, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& x)
+{
+   int aa, bb, cc;
+   // Convergence is geometric with ratio |x|, so is only rapid for small x:
+   if ((cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count < cpp_bin_float_fixed_series_bits)
+      || (x.exponent() >= -1)
+      || !is_half_integer(a, &aa) || !is_half_integer(b, &bb) || !is_half_integer(c, &cc)
+      || !eval_fixed_point_series(result, std::array<int, 2>{{aa, bb}}, std::array<int, 1>{{cc}}, x))
+      default_ops::hyp2F1(result, a, b, c, x);
+}
+
 template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
 void eval_exp_taylor(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& arg)
 {
    constexpr std::ptrdiff_t bits = cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count;
    //
-   // Taylor series for small argument, note returns exp(x) - 1:
+   // Taylor series for small argument, note returns exp(x) - 1.
+   // At high precision we sum (exp(x) - 1) / x = 1F1(1; 2; x) in fixed point:
    //
+   if ((bits >= cpp_bin_float_fixed_series_bits) && eval_fixed_point_series(res, std::array<int, 1>{{2}}, std::array<int, 1>{{4}}, arg))
+   {
+      eval_multiply(res, arg);
+      return;
+   }
    res = limb_type(0);
    cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> num(arg), denom, t;
    denom = limb_type(1);
@@ -152,6 +387,159 @@ void eval_exp(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>&
    eval_ldexp(res, res, nn);
 }
 
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void eval_log(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& arg)
+{
+   //
+   // At high precision we reduce the argument to x * 2^n with 2/3 < x <= 4/3, and then
+   // use:
+   //
+   // log(x) = 2atanh(z) = 2z 2F1(1/2, 1; 3/2; z^2), z = (x - 1) / (x + 1)
+   //
+   // with |z| <= 1/5 and the series summed in fixed point.
+   //
+   using default_ops::eval_add;
+   using default_ops::eval_divide;
+   using default_ops::eval_multiply;
+   using default_ops::eval_subtract;
+
+   if ((cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count < cpp_bin_float_fixed_series_bits) || (eval_fpclassify(arg) != static_cast<int>(FP_NORMAL)) || arg.sign())
+   {
+      default_ops::eval_log(res, arg);
+      return;
+   }
+
+   Exponent                                                          e;
+   cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> x, z, t;
+   eval_frexp(x, arg, &e);
+   if (x.compare(2.0 / 3) <= 0)
+   {
+      eval_ldexp(x, x, 1);
+      --e;
+   }
+   eval_subtract(z, x, limb_type(1));
+   eval_add(x, limb_type(1));
+   eval_divide(z, x);
+   eval_multiply(x, z, z);
+   if (!eval_fixed_point_series(t, std::array<int, 2>{{1, 2}}, std::array<int, 1>{{3}}, x))
+   {
+      default_ops::eval_log(res, arg);
+      return;
+   }
+   eval_multiply(t, z);
+   eval_ldexp(t, t, 1);
+   x = e;
+   eval_multiply(res, x, default_ops::get_constant_ln2<cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> >());
+   eval_add(res, t);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void eval_atan(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& res, const cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& arg)
+{
+   //
+   // At high precision we reduce the argument to x <= 1 with atan(x) = pi/2 - atan(1/x),
+   // then halve the angle with:
+   //
+   // atan(x) = 2atan(x / (1 + sqrt(1 + x^2)))
+   //
+   // until x < 1/16, and finish with:
+   //
+   // atan(x) = x 2F1(1/2, 1; 3/2; -x^2)
+   //
+   // with the series summed in fixed point.
+   //
+   using default_ops::eval_add;
+   using default_ops::eval_divide;
+   using default_ops::eval_multiply;
+   using default_ops::eval_subtract;
+
+   if ((cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count < cpp_bin_float_fixed_series_bits) || (eval_fpclassify(arg) != static_cast<int>(FP_NORMAL)))
+   {
+      default_ops::eval_atan(res, arg);
+      return;
+   }
+
+   cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> x(arg), y, t;
+   const bool                                                        neg    = x.sign();
+   const bool                                                        invert = x.exponent() >= 0;
+   if (neg)
+      x.negate();
+   if (invert)
+   {
+      t = limb_type(1);
+      eval_divide(x, t, x);
+   }
+   int halvings = 0;
+   while (x.exponent() >= -4)
+   {
+      eval_multiply(t, x, x);
+      eval_add(t, limb_type(1));
+      eval_sqrt(y, t);
+      eval_add(y, limb_type(1));
+      eval_divide(x, y);
+      ++halvings;
+   }
+   eval_multiply(y, x, x);
+   y.negate();
+   if (!eval_fixed_point_series(t, std::array<int, 2>{{1, 2}}, std::array<int, 1>{{3}}, y))
+   {
+      default_ops::eval_atan(res, arg);
+      return;
+   }
+   eval_multiply(res, t, x);
+   eval_ldexp(res, res, halvings);
+   if (invert)
+   {
+      eval_ldexp(t, default_ops::get_constant_pi<cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE> >(), -1);
+      eval_subtract(res, t, res);
+   }
+   if (neg)
+      res.negate();
+}
+
+//
+// Above the precision of the stored strings, the constants are computed by binary splitting,
+// see detail/binary_splitting.hpp, rather than the generic methods:
+//
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE, class F>
+void calc_constant_binary_splitting(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, unsigned digits, F calc)
+{
+   const std::ptrdiff_t prec = static_cast<std::ptrdiff_t>(digits) + 64;
+   cpp_int              scale(1);
+   scale <<= prec;
+   cpp_int value = calc(scale, static_cast<std::size_t>(prec));
+   result.exponent() = static_cast<Exponent>(static_cast<std::ptrdiff_t>(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>::bit_count) - 1 - prec);
+   result.sign()     = false;
+   copy_and_round(result, value.backend());
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void calc_pi(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_pi(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_pi);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void calc_log2(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_log2(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_ln2);
+}
+
+template <unsigned Digits, digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
+void calc_e(cpp_bin_float<Digits, DigitBase, Allocator, Exponent, MinE, MaxE>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_e(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_e);
+}
+
 }}} // namespace boost::multiprecision::backends
 
 #endif
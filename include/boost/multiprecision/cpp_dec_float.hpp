@@ -40,6 +40,8 @@
 #include <boost/multiprecision/detail/tables.hpp>
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/binary_splitting.hpp>
+#include <boost/multiprecision/detail/binary_codec.hpp>
 
 #ifdef BOOST_MP_MATH_AVAILABLE
 //
@@ -93,6 +95,7 @@ class cpp_dec_float
    static constexpr std::int32_t cpp_dec_float_elem_mask          = INT32_C(100000000);
 
    static constexpr std::int32_t cpp_dec_float_elems_for_kara     = static_cast<std::int32_t>(128 + 1);
+   static constexpr std::int32_t cpp_dec_float_elems_for_wide_mul = static_cast<std::int32_t>(12);
 
  public:
    using signed_types   = std::tuple<long long> ;
@@ -265,6 +268,11 @@ class cpp_dec_float
       return result;
    }
 
+   // Binary encoding, see boost/multiprecision/detail/binary_codec.hpp.
+   std::size_t binary_encoded_size() const;
+   void        binary_encode(boost::multiprecision::detail::binary_writer& w) const;
+   void        binary_decode(boost::multiprecision::detail::binary_reader& r);
+
    // Specific special values.
    static const cpp_dec_float&  nan () { static const cpp_dec_float val(cpp_dec_float_NaN); return val; }
    static const cpp_dec_float&  inf () { static const cpp_dec_float val(cpp_dec_float_inf); return val; }
@@ -590,6 +598,12 @@ class cpp_dec_float
                                           const std::uint32_t* a,
                                           const std::uint32_t* b,
                                           const std::uint32_t  count);
+#ifdef BOOST_HAS_INT128
+   static void eval_multiply_n_by_n_to_2n_wide(      std::uint32_t* r,
+                                               const std::uint32_t* a,
+                                               const std::uint32_t* b,
+                                               const std::uint32_t  count);
+#endif
 
    static std::uint32_t mul_loop_n(std::uint32_t* const u, std::uint32_t n, const std::int32_t p);
    static std::uint32_t div_loop_n(std::uint32_t* const u, std::uint32_t n, const std::int32_t p);
@@ -1458,6 +1472,127 @@ int cpp_dec_float<Digits10, ExponentType, Allocator>::compare(const cpp_dec_floa
    }
 }
 
+template <unsigned Digits10, class ExponentType, class Allocator>
+std::size_t cpp_dec_float<Digits10, ExponentType, Allocator>::binary_encoded_size() const
+{
+   if ((!(isfinite)()) || iszero())
+      return 1u;
+
+   std::size_t n = static_cast<std::size_t>((std::min)(prec_elem, cpp_dec_float_elem_number));
+   while (!data[n - 1u])
+      --n;
+
+   return 1u + boost::multiprecision::detail::binary_varint_size(boost::multiprecision::detail::binary_zigzag(static_cast<std::int64_t>(exp))) + boost::multiprecision::detail::binary_varint_size(n) + 4u * n;
+}
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+void cpp_dec_float<Digits10, ExponentType, Allocator>::binary_encode(boost::multiprecision::detail::binary_writer& w) const
+{
+   // The flags byte, then for finite non-zero values the exponent and the elements
+   // up to the last non-zero one, as 4 byte little endian words.
+   unsigned char c = (isnan)() ? boost::multiprecision::detail::binary_codec_nan : (isinf)() ? boost::multiprecision::detail::binary_codec_infinity : iszero() ? boost::multiprecision::detail::binary_codec_zero : boost::multiprecision::detail::binary_codec_finite;
+
+   w.write_byte(static_cast<unsigned char>(c | (neg ? 4u : 0u)));
+
+   if (c != boost::multiprecision::detail::binary_codec_finite)
+      return;
+
+   std::size_t n = static_cast<std::size_t>((std::min)(prec_elem, cpp_dec_float_elem_number));
+   while (!data[n - 1u])
+      --n;
+
+   w.write_signed_varint(static_cast<std::int64_t>(exp));
+   w.write_varint(n);
+
+#if BOOST_MP_ENDIAN_LITTLE_BYTE
+   std::memcpy(w.reserve(4u * n), data.data(), 4u * n);
+#else
+   for (std::size_t i = 0u; i < n; ++i)
+      w.write_uint32(data[i]);
+#endif
+}
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+void cpp_dec_float<Digits10, ExponentType, Allocator>::binary_decode(boost::multiprecision::detail::binary_reader& r)
+{
+   const unsigned char flags = r.read_byte();
+
+   if (flags > 7u)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+   }
+
+   switch (flags & 3u)
+   {
+   case boost::multiprecision::detail::binary_codec_zero:
+      *this = zero();
+      return;
+   case boost::multiprecision::detail::binary_codec_infinity:
+      *this = inf();
+      neg   = ((flags & 4u) != 0u);
+      return;
+   case boost::multiprecision::detail::binary_codec_nan:
+      *this = nan();
+      return;
+   default:
+      break;
+   }
+
+   const std::int64_t  e = r.read_signed_varint();
+   const std::uint64_t n = r.read_varint();
+
+   if ((n == 0u) || (n > r.remaining() / 4u) || (e % cpp_dec_float_elem_digits10))
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+   }
+
+   const unsigned char* p = r.read(static_cast<std::size_t>(4u * n));
+
+   // Elements beyond our precision are truncated, as they are when
+   // converting between cpp_dec_float's of different precision.
+   const std::size_t count = static_cast<std::size_t>((std::min)(n, static_cast<std::uint64_t>(cpp_dec_float_elem_number)));
+
+#if BOOST_MP_ENDIAN_LITTLE_BYTE
+   std::memcpy(data.data(), p, 4u * count);
+#else
+   for (std::size_t i = 0u; i < count; ++i)
+      data[i] = static_cast<std::uint32_t>(p[4u * i]) | (static_cast<std::uint32_t>(p[4u * i + 1u]) << 8u) | (static_cast<std::uint32_t>(p[4u * i + 2u]) << 16u) | (static_cast<std::uint32_t>(p[4u * i + 3u]) << 24u);
+#endif
+   std::fill(data.begin() + static_cast<std::ptrdiff_t>(count), data.end(), static_cast<std::uint32_t>(0u));
+
+   for (std::size_t i = 0u; i < count; ++i)
+   {
+      if (data[i] >= static_cast<std::uint32_t>(cpp_dec_float_elem_mask))
+      {
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+      }
+   }
+
+   if (data[0u] == 0u)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed floating point value encountered while decoding."));
+   }
+
+   neg       = ((flags & 4u) != 0u);
+   fpclass   = cpp_dec_float_finite;
+   prec_elem = cpp_dec_float_elem_number;
+
+   if (e > static_cast<std::int64_t>(cpp_dec_float_max_exp10))
+   {
+      const bool b_neg = neg;
+      *this = inf();
+      neg   = b_neg;
+   }
+   else if (e < static_cast<std::int64_t>(cpp_dec_float_min_exp10))
+   {
+      *this = zero();
+   }
+   else
+   {
+      exp = static_cast<exponent_type>(e);
+   }
+}
+
 template <unsigned Digits10, class ExponentType, class Allocator>
 bool cpp_dec_float<Digits10, ExponentType, Allocator>::isone() const
 {
@@ -2643,6 +2778,15 @@ void cpp_dec_float<Digits10, ExponentType, Allocator>::eval_multiply_n_by_n_to_2
                                                                                   const std::uint32_t* b,
                                                                                   const std::uint32_t  count)
 {
+#ifdef BOOST_HAS_INT128
+   if(count >= static_cast<std::uint32_t>(cpp_dec_float_elems_for_wide_mul))
+   {
+      eval_multiply_n_by_n_to_2n_wide(r, a, b, count);
+
+      return;
+   }
+#endif
+
    using local_limb_type = std::uint32_t;
 
    using local_double_limb_type = std::uint64_t;
@@ -2684,6 +2828,111 @@ void cpp_dec_float<Digits10, ExponentType, Allocator>::eval_multiply_n_by_n_to_2
    *ir = static_cast<local_limb_type>(carry);
 }
 
+#ifdef BOOST_HAS_INT128
+template <unsigned Digits10, class ExponentType, class Allocator>
+void cpp_dec_float<Digits10, ExponentType, Allocator>::eval_multiply_n_by_n_to_2n_wide(      std::uint32_t* r,
+                                                                                       const std::uint32_t* a,
+                                                                                       const std::uint32_t* b,
+                                                                                       const std::uint32_t  count)
+{
+   // The same column-wise multiplication as above, but with pairs of elements combined
+   // into limbs of base 10^16, which gives a quarter as many partial products, each
+   // column being accumulated in 128 bits.  This always fits, since 10^32 times the
+   // number of columns is far less than 2^128.  The elements themselves are unchanged,
+   // so there is no effect on decimal round-tripping.
+
+   using local_limb_type = std::uint64_t;
+
+   using local_double_limb_type = uint128_type;
+
+   constexpr local_limb_type wide_mask = static_cast<local_limb_type>(static_cast<local_limb_type>(cpp_dec_float_elem_mask) * static_cast<local_limb_type>(cpp_dec_float_elem_mask));
+
+   // Only school multiplication and the base case of Karatsuba multiplication come here:
+   BOOST_MP_ASSERT(count < static_cast<std::uint32_t>(cpp_dec_float_elems_for_kara));
+
+   constexpr std::uint32_t max_wide_count = static_cast<std::uint32_t>((cpp_dec_float_elems_for_kara + 1) / 2);
+
+   local_limb_type wa[max_wide_count];
+   local_limb_type wb[max_wide_count];
+   local_limb_type wr[max_wide_count * 2U];
+
+   const std::uint32_t wide_count = static_cast<std::uint32_t>((count + 1U) / 2U);
+
+   // Pair the elements up from the least significant end, an odd count leaves
+   // the most significant limb with a single element.
+   for(std::uint32_t i = 0U; i < wide_count; ++i)
+   {
+      const std::int32_t lo = static_cast<std::int32_t>(count - 1U - (2U * i));
+
+      wa[wide_count - 1U - i] = static_cast<local_limb_type>(a[lo] + ((lo > 0) ? static_cast<local_limb_type>(a[lo - 1] * static_cast<local_limb_type>(cpp_dec_float_elem_mask)) : 0U));
+      wb[wide_count - 1U - i] = static_cast<local_limb_type>(b[lo] + ((lo > 0) ? static_cast<local_limb_type>(b[lo - 1] * static_cast<local_limb_type>(cpp_dec_float_elem_mask)) : 0U));
+   }
+
+   using local_reverse_iterator_type = std::reverse_iterator<local_limb_type*>;
+
+   local_reverse_iterator_type ir(wr + (wide_count * 2U));
+
+   local_double_limb_type carry = 0U;
+
+   for(std::int32_t j = static_cast<std::int32_t>(wide_count - 1U); j >= static_cast<std::int32_t>(1); --j)
+   {
+      local_double_limb_type sum = carry;
+
+      for(std::int32_t i = static_cast<std::int32_t>(wide_count - 1U); i >= j; --i)
+      {
+         sum += static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(wa[i]) * wb[  static_cast<std::int32_t>(wide_count - 1U)
+                                                                                                    - static_cast<std::int32_t>(i - j)]);
+      }
+
+      carry = static_cast<local_double_limb_type>(sum / wide_mask);
+      *ir++ = static_cast<local_limb_type>       (sum - static_cast<local_double_limb_type>(carry * wide_mask));
+   }
+
+   for(std::int32_t j = static_cast<std::int32_t>(wide_count - 1U); j >= static_cast<std::int32_t>(0); --j)
+   {
+      local_double_limb_type sum = carry;
+
+      for(std::int32_t i = j; i >= static_cast<std::int32_t>(0); --i)
+      {
+         sum += static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(wa[j - i]) * wb[i]);
+      }
+
+      carry = static_cast<local_double_limb_type>(sum / wide_mask);
+      *ir++ = static_cast<local_limb_type>       (sum - static_cast<local_double_limb_type>(carry * wide_mask));
+   }
+
+   *ir = static_cast<local_limb_type>(carry);
+
+   // Split the limbs back into elements, when the count is odd the two leading elements
+   // of the wide product are always zero and are dropped.
+   const std::uint32_t skip = static_cast<std::uint32_t>((wide_count * 4U) - (count * 2U));
+
+   for(std::uint32_t k = 0U; k < (wide_count * 2U); ++k)
+   {
+      const std::uint32_t hi = static_cast<std::uint32_t>(wr[k] / static_cast<std::uint32_t>(cpp_dec_float_elem_mask));
+      const std::uint32_t lo = static_cast<std::uint32_t>(wr[k] - static_cast<local_limb_type>(hi * static_cast<local_limb_type>(cpp_dec_float_elem_mask)));
+
+      if((2U * k) >= skip)
+      {
+         r[(2U * k) - skip] = hi;
+      }
+      else
+      {
+         BOOST_MP_ASSERT(hi == 0U);
+      }
+
+      if((2U * k + 1U) >= skip)
+      {
+         r[(2U * k + 1U) - skip] = lo;
+      }
+      else
+      {
+         BOOST_MP_ASSERT(lo == 0U);
+      }
+   }
+}
+#endif
+
 template <unsigned Digits10, class ExponentType, class Allocator>
 std::uint32_t cpp_dec_float<Digits10, ExponentType, Allocator>::mul_loop_n(std::uint32_t* const u, std::uint32_t n, const std::int32_t p)
 {
@@ -3527,6 +3776,65 @@ inline std::size_t hash_value(const cpp_dec_float<Digits10, ExponentType, Alloca
    return val.hash();
 }
 
+template <unsigned Digits10, class ExponentType, class Allocator>
+inline std::size_t eval_binary_encoded_size(const cpp_dec_float<Digits10, ExponentType, Allocator>& val)
+{
+   return val.binary_encoded_size();
+}
+template <unsigned Digits10, class ExponentType, class Allocator>
+inline void eval_binary_encode(boost::multiprecision::detail::binary_writer& w, const cpp_dec_float<Digits10, ExponentType, Allocator>& val)
+{
+   val.binary_encode(w);
+}
+template <unsigned Digits10, class ExponentType, class Allocator>
+inline void eval_binary_decode(boost::multiprecision::detail::binary_reader& r, cpp_dec_float<Digits10, ExponentType, Allocator>& val)
+{
+   val.binary_decode(r);
+}
+
+//
+// Above the precision of the stored strings, the constants are computed by binary splitting,
+// see detail/binary_splitting.hpp, as integers scaled by a power of 10 which convert exactly:
+//
+template <unsigned Digits10, class ExponentType, class Allocator, class F>
+void calc_constant_binary_splitting(cpp_dec_float<Digits10, ExponentType, Allocator>& result, unsigned digits, F calc)
+{
+   const unsigned decimal_digits = static_cast<unsigned>(boost::multiprecision::detail::digits2_2_10(digits)) + 20u;
+   const cpp_int  scale          = pow(cpp_int(10), decimal_digits);
+
+   std::string str = calc(scale, static_cast<std::size_t>(digits) + 64u).str();
+   str += "e-";
+   str += std::to_string(decimal_digits);
+   result = str.c_str();
+}
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+void calc_pi(cpp_dec_float<Digits10, ExponentType, Allocator>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_pi(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_pi);
+}
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+void calc_log2(cpp_dec_float<Digits10, ExponentType, Allocator>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_log2(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_ln2);
+}
+
+template <unsigned Digits10, class ExponentType, class Allocator>
+void calc_e(cpp_dec_float<Digits10, ExponentType, Allocator>& result, unsigned digits)
+{
+   if (digits < default_ops::constant_string_bits)
+      default_ops::calc_e(result, digits);
+   else
+      calc_constant_binary_splitting(result, digits, &boost::multiprecision::detail::binary_splitting_e);
+}
+
 } // namespace backends
 
 namespace detail {
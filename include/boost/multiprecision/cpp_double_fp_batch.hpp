@@ -0,0 +1,571 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//  http://www.boost.org/LICENSE_1_0.txt)
+//
+
+#ifndef BOOST_MP_CPP_DOUBLE_FP_BATCH_2026_10_18_HPP
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_2026_10_18_HPP
+
+#include <boost/multiprecision/cpp_double_fp.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+//
+// Batched arithmetic on arrays of cpp_double_fp_backend values, stored as structure-of-arrays
+// (all the high parts in one array, all the low parts in another) so that the error-free
+// transformations of neighbouring elements can be evaluated in the lanes of a vector register.
+//
+// The kernels are written as plain loops for the compiler to vectorize.  On x86 with GCC or
+// clang each kernel is compiled a second time for AVX2 and FMA, and a third time for AVX-512,
+// and the widest version supported by the CPU is chosen at runtime.  Defining
+// BOOST_MP_CPP_DOUBLE_FP_BATCH_NO_DISPATCH disables this, leaving only the code for the
+// instruction set selected on the command line.
+//
+// The error-free product is exact with or without FMA, but with FMA the cross products are
+// also accumulated with a single rounding each, so that the low parts of results may differ
+// in the last bit or so from those of the scalar operators (and between machines with and
+// without FMA).  Additions are the same as the scalar operators everywhere.  Unlike the
+// scalar operators, the kernels don't check for infinities, NaN's, overflow or underflow.
+//
+// The arrays of a result may be the same as those of an argument, but may not otherwise
+// overlap them, so there are never dependencies between the iterations of the loops:
+//
+#if defined(__clang__)
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP _Pragma("clang loop vectorize(assume_safety)")
+#elif defined(__GNUC__)
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP _Pragma("GCC ivdep")
+#else
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+#endif
+
+#if !defined(BOOST_MP_CPP_DOUBLE_FP_BATCH_NO_DISPATCH) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_HAS_DISPATCH
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#endif
+
+// The kernels must be inlined into the functions compiled for each instruction set, even in debug builds:
+#if defined(__GNUC__) || defined(__clang__)
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE inline __attribute__((__always_inline__))
+#else
+#define BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE BOOST_MP_FORCEINLINE
+#endif
+
+namespace boost { namespace multiprecision {
+
+namespace backends { namespace cpp_df_qf_detail {
+
+template <typename FloatingPointType>
+struct batch_ref
+{
+   FloatingPointType* hi;
+   FloatingPointType* lo;
+};
+
+template <typename FloatingPointType>
+struct batch_cref
+{
+   const FloatingPointType* hi;
+   const FloatingPointType* lo;
+};
+
+// Only used when the target has FMA instructions.
+template <typename FloatingPointType>
+BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto batch_fma_op(const FloatingPointType x, const FloatingPointType y, const FloatingPointType z) -> FloatingPointType
+{
+   return ccmath::unsafe::fma(x, y, z);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto batch_fma_op(const float x, const float y, const float z) -> float
+{
+   return __builtin_fmaf(x, y, z);
+}
+
+BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto batch_fma_op(const double x, const double y, const double z) -> double
+{
+   return __builtin_fma(x, y, z);
+}
+#endif
+
+template <typename FloatingPointType,
+          const bool HasFma>
+struct batch_arithmetic
+{
+   using float_type = FloatingPointType;
+   using arithmetic = exact_arithmetic<float_type>;
+
+   // The elements are processed in blocks of this many for the polynomial,
+   // and summed into this many partial sums for the dot product:
+   static constexpr std::size_t block_size { 256U };
+   static constexpr std::size_t dot_lanes  { 8U };
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto add(float_type& rh, float_type& rl, const float_type ah, const float_type al, const float_type bh, const float_type bl) -> void
+   {
+      // As in cpp_double_fp_backend::operator+=.
+      pair<float_type, float_type> s { arithmetic::two_sum(ah, bh) };
+
+      const pair<float_type, float_type> t { arithmetic::two_sum(al, bl) };
+
+      s = arithmetic::two_hilo_sum(s.first, s.second + t.first);
+      s = arithmetic::two_hilo_sum(s.first, t.second + s.second);
+
+      rh = s.first;
+      rl = s.second;
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto mul(float_type& rh, float_type& rl, const float_type ah, const float_type al, const float_type bh, const float_type bl) -> void
+   {
+      // As in cpp_double_fp_backend::mul_unchecked.  With FMA the exact error of the
+      // product of the high parts takes one instruction, and the cross products are
+      // accumulated into it with two more, so that the compiler has no freedom to
+      // contract the sum differently in different builds.  Otherwise the error comes
+      // from Dekker's splitting.
+
+      const float_type p { ah * bh };
+
+      float_type c { };
+
+      if (HasFma)
+      {
+         c = batch_fma_op(al, bh, batch_fma_op(ah, bl, batch_fma_op(ah, bh, -p)));
+      }
+      else
+      {
+         const float_type ca { split_maker<float_type>::value * ah };
+         const float_type cb { split_maker<float_type>::value * bh };
+         const float_type ha { ca - float_type { ca - ah } };
+         const float_type hb { cb - float_type { cb - bh } };
+         const float_type ta { ah - ha };
+         const float_type tb { bh - hb };
+
+         const float_type e { float_type { float_type { float_type { (ha * hb) - p } + (ha * tb) } + (ta * hb) } + (ta * tb) };
+
+         c = (e + (ah * bl)) + (al * bh);
+      }
+
+      rh = p + c;
+      rl = float_type { p - rh } + c;
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto add(batch_ref<float_type> r, batch_cref<float_type> a, batch_cref<float_type> b, const std::size_t n) -> void
+   {
+      BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+      for (std::size_t i = 0U; i < n; ++i)
+      {
+         add(r.hi[i], r.lo[i], a.hi[i], a.lo[i], b.hi[i], b.lo[i]);
+      }
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto mul(batch_ref<float_type> r, batch_cref<float_type> a, batch_cref<float_type> b, const std::size_t n) -> void
+   {
+      BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+      for (std::size_t i = 0U; i < n; ++i)
+      {
+         mul(r.hi[i], r.lo[i], a.hi[i], a.lo[i], b.hi[i], b.lo[i]);
+      }
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto fma(batch_ref<float_type> r, batch_cref<float_type> a, batch_cref<float_type> b, batch_cref<float_type> c, const std::size_t n) -> void
+   {
+      BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+      for (std::size_t i = 0U; i < n; ++i)
+      {
+         float_type ph { };
+         float_type pl { };
+
+         mul(ph, pl, a.hi[i], a.lo[i], b.hi[i], b.lo[i]);
+         add(r.hi[i], r.lo[i], ph, pl, c.hi[i], c.lo[i]);
+      }
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto axpy(const float_type alpha_hi, const float_type alpha_lo, batch_cref<float_type> x, batch_ref<float_type> y, const std::size_t n) -> void
+   {
+      BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+      for (std::size_t i = 0U; i < n; ++i)
+      {
+         float_type ph { };
+         float_type pl { };
+
+         mul(ph, pl, alpha_hi, alpha_lo, x.hi[i], x.lo[i]);
+         add(y.hi[i], y.lo[i], ph, pl, y.hi[i], y.lo[i]);
+      }
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto dot(float_type* rh, float_type* rl, batch_cref<float_type> a, batch_cref<float_type> b, const std::size_t n) -> void
+   {
+      // The products are summed into dot_lanes partial sums, which are then added in order,
+      // so that the result doesn't depend on the width of the vector registers.
+
+      float_type sh[dot_lanes] = { };
+      float_type sl[dot_lanes] = { };
+
+      std::size_t i { 0U };
+
+      for ( ; i + dot_lanes <= n; i += dot_lanes)
+      {
+         const float_type* ah { a.hi + i };
+         const float_type* al { a.lo + i };
+         const float_type* bh { b.hi + i };
+         const float_type* bl { b.lo + i };
+
+         for (std::size_t j = 0U; j < dot_lanes; ++j)
+         {
+            float_type ph { };
+            float_type pl { };
+
+            mul(ph, pl, ah[j], al[j], bh[j], bl[j]);
+            add(sh[j], sl[j], sh[j], sl[j], ph, pl);
+         }
+      }
+
+      for (std::size_t j = 0U; i < n; ++i, ++j)
+      {
+         float_type ph { };
+         float_type pl { };
+
+         mul(ph, pl, a.hi[i], a.lo[i], b.hi[i], b.lo[i]);
+         add(sh[j], sl[j], sh[j], sl[j], ph, pl);
+      }
+
+      *rh = sh[0U];
+      *rl = sl[0U];
+
+      for (std::size_t j = 1U; j < dot_lanes; ++j)
+      {
+         add(*rh, *rl, *rh, *rl, sh[j], sl[j]);
+      }
+   }
+
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto horner(batch_ref<float_type> r, batch_cref<float_type> x, batch_cref<float_type> coef, const std::size_t degree, const std::size_t n) -> void
+   {
+      // Each block of elements runs through all the coefficients while it is in the cache,
+      // with the elements of the block in the inner loop.
+
+      for (std::size_t i0 = 0U; i0 < n; i0 += block_size)
+      {
+         const std::size_t i1 { ((n - i0) < block_size) ? n : i0 + block_size };
+
+         BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+         for (std::size_t i = i0; i < i1; ++i)
+         {
+            r.hi[i] = coef.hi[degree];
+            r.lo[i] = coef.lo[degree];
+         }
+
+         for (std::size_t k = degree; k-- > 0U; )
+         {
+            const float_type ch { coef.hi[k] };
+            const float_type cl { coef.lo[k] };
+
+            BOOST_MP_CPP_DOUBLE_FP_BATCH_IVDEP
+            for (std::size_t i = i0; i < i1; ++i)
+            {
+               float_type ph { };
+               float_type pl { };
+
+               mul(ph, pl, r.hi[i], r.lo[i], x.hi[i], x.lo[i]);
+               add(r.hi[i], r.lo[i], ph, pl, ch, cl);
+            }
+         }
+      }
+   }
+};
+
+// The error-free product uses FMA when the instruction set chosen at compile time has it.
+template <typename FloatingPointType>
+struct batch_has_fma
+{
+   static constexpr bool value =
+#if defined(__FMA__) && (defined(__GNUC__) || defined(__clang__))
+      (std::is_same<FloatingPointType, float>::value || std::is_same<FloatingPointType, double>::value);
+#else
+      false;
+#endif
+};
+
+template <typename FloatingPointType>
+struct batch_is_dispatched
+{
+   static constexpr bool value =
+#if defined(BOOST_MP_CPP_DOUBLE_FP_BATCH_HAS_DISPATCH)
+      (std::is_same<FloatingPointType, float>::value || std::is_same<FloatingPointType, double>::value);
+#else
+      false;
+#endif
+};
+
+enum class batch_kernel { add, mul, fma, axpy, dot, horner };
+
+template <const batch_kernel Kernel>
+struct batch_invoke;
+
+template <>
+struct batch_invoke<batch_kernel::add>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::add(args...); }
+};
+
+template <>
+struct batch_invoke<batch_kernel::mul>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::mul(args...); }
+};
+
+template <>
+struct batch_invoke<batch_kernel::fma>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::fma(args...); }
+};
+
+template <>
+struct batch_invoke<batch_kernel::axpy>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::axpy(args...); }
+};
+
+template <>
+struct batch_invoke<batch_kernel::dot>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::dot(args...); }
+};
+
+template <>
+struct batch_invoke<batch_kernel::horner>
+{
+   template <class Arithmetic, class... Args>
+   static BOOST_MP_CPP_DOUBLE_FP_BATCH_INLINE auto run(Args... args) -> void { Arithmetic::horner(args...); }
+};
+
+#if defined(BOOST_MP_CPP_DOUBLE_FP_BATCH_HAS_DISPATCH)
+template <const batch_kernel Kernel, typename FloatingPointType, class... Args>
+BOOST_MP_CPP_DOUBLE_FP_BATCH_TARGET_AVX512 auto batch_run_avx512(Args... args) -> void
+{
+   batch_invoke<Kernel>::template run<batch_arithmetic<FloatingPointType, batch_is_dispatched<FloatingPointType>::value>>(args...);
+}
+
+template <const batch_kernel Kernel, typename FloatingPointType, class... Args>
+BOOST_MP_CPP_DOUBLE_FP_BATCH_TARGET_AVX2 auto batch_run_avx2(Args... args) -> void
+{
+   batch_invoke<Kernel>::template run<batch_arithmetic<FloatingPointType, batch_is_dispatched<FloatingPointType>::value>>(args...);
+}
+#endif
+
+template <const batch_kernel Kernel, typename FloatingPointType, class... Args>
+auto batch_run(Args... args) -> void
+{
+#if defined(BOOST_MP_CPP_DOUBLE_FP_BATCH_HAS_DISPATCH)
+   if (batch_is_dispatched<FloatingPointType>::value)
+   {
+      if (__builtin_cpu_supports("avx512f"))
+      {
+         batch_run_avx512<Kernel, FloatingPointType>(args...);
+
+         return;
+      }
+
+      if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+      {
+         batch_run_avx2<Kernel, FloatingPointType>(args...);
+
+         return;
+      }
+   }
+#endif
+
+   batch_invoke<Kernel>::template run<batch_arithmetic<FloatingPointType, batch_has_fma<FloatingPointType>::value>>(args...);
+}
+
+} } // namespace backends::cpp_df_qf_detail
+
+//
+// A structure-of-arrays container of double-float values, for use with the batched
+// kernels below.  Elements are read and written as number<cpp_double_fp_backend<>> values,
+// and the arrays of high and low parts are available directly.
+//
+template <typename FloatingPointType,
+          class Allocator = std::allocator<FloatingPointType>>
+class cpp_double_fp_batch
+{
+ public:
+   using float_type     = FloatingPointType;
+   using backend_type   = backends::cpp_double_fp_backend<float_type>;
+   using value_type     = number<backend_type, et_off>;
+   using size_type      = std::size_t;
+   using allocator_type = Allocator;
+
+   cpp_double_fp_batch() = default;
+
+   explicit cpp_double_fp_batch(const size_type n, const value_type& v = value_type { 0 }, const allocator_type& alloc = allocator_type())
+      : my_hi(n, v.backend().crep().first, alloc),
+        my_lo(n, v.backend().crep().second, alloc) { }
+
+   template <class Iterator>
+   cpp_double_fp_batch(Iterator first, Iterator last, const allocator_type& alloc = allocator_type())
+      : my_hi(alloc),
+        my_lo(alloc)
+   {
+      for ( ; first != last; ++first)
+      {
+         push_back(value_type { *first });
+      }
+   }
+
+   auto size () const noexcept -> size_type { return my_hi.size(); }
+   auto empty() const noexcept -> bool      { return my_hi.empty(); }
+
+   auto resize(const size_type n, const value_type& v = value_type { 0 }) -> void
+   {
+      my_hi.resize(n, v.backend().crep().first);
+      my_lo.resize(n, v.backend().crep().second);
+   }
+
+   auto reserve(const size_type n) -> void
+   {
+      my_hi.reserve(n);
+      my_lo.reserve(n);
+   }
+
+   auto push_back(const value_type& v) -> void
+   {
+      my_hi.push_back(v.backend().crep().first);
+      my_lo.push_back(v.backend().crep().second);
+   }
+
+   auto get(const size_type i) const -> value_type
+   {
+      value_type result { };
+
+      result.backend().rep() = typename backend_type::rep_type { my_hi[i], my_lo[i] };
+
+      return result;
+   }
+
+   auto set(const size_type i, const value_type& v) -> void
+   {
+      my_hi[i] = v.backend().crep().first;
+      my_lo[i] = v.backend().crep().second;
+   }
+
+   auto hi_data()       noexcept -> float_type*       { return my_hi.data(); }
+   auto hi_data() const noexcept -> const float_type* { return my_hi.data(); }
+   auto lo_data()       noexcept -> float_type*       { return my_lo.data(); }
+   auto lo_data() const noexcept -> const float_type* { return my_lo.data(); }
+
+ private:
+   std::vector<float_type, allocator_type> my_hi;
+   std::vector<float_type, allocator_type> my_lo;
+
+   auto ref() -> backends::cpp_df_qf_detail::batch_ref<float_type> { return { my_hi.data(), my_lo.data() }; }
+   auto cref() const -> backends::cpp_df_qf_detail::batch_cref<float_type> { return { my_hi.data(), my_lo.data() }; }
+
+   template <typename F, class A>
+   friend auto batch_add(cpp_double_fp_batch<F, A>& result, const cpp_double_fp_batch<F, A>& a, const cpp_double_fp_batch<F, A>& b) -> void;
+
+   template <typename F, class A>
+   friend auto batch_multiply(cpp_double_fp_batch<F, A>& result, const cpp_double_fp_batch<F, A>& a, const cpp_double_fp_batch<F, A>& b) -> void;
+
+   template <typename F, class A>
+   friend auto batch_fma(cpp_double_fp_batch<F, A>& result, const cpp_double_fp_batch<F, A>& a, const cpp_double_fp_batch<F, A>& b, const cpp_double_fp_batch<F, A>& c) -> void;
+
+   template <typename F, class A>
+   friend auto batch_axpy(const typename cpp_double_fp_batch<F, A>::value_type& alpha, const cpp_double_fp_batch<F, A>& x, cpp_double_fp_batch<F, A>& y) -> void;
+
+   template <typename F, class A>
+   friend auto batch_dot(const cpp_double_fp_batch<F, A>& a, const cpp_double_fp_batch<F, A>& b) -> typename cpp_double_fp_batch<F, A>::value_type;
+
+   template <typename F, class A>
+   friend auto batch_horner(cpp_double_fp_batch<F, A>& result, const cpp_double_fp_batch<F, A>& x, const cpp_double_fp_batch<F, A>& coefficients) -> void;
+};
+
+// result[i] = a[i] + b[i], result may be the same object as a or b.
+template <typename FloatingPointType, class Allocator>
+auto batch_add(cpp_double_fp_batch<FloatingPointType, Allocator>& result, const cpp_double_fp_batch<FloatingPointType, Allocator>& a, const cpp_double_fp_batch<FloatingPointType, Allocator>& b) -> void
+{
+   BOOST_MP_ASSERT(a.size() == b.size());
+
+   result.resize(a.size());
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::add, FloatingPointType>(result.ref(), a.cref(), b.cref(), a.size());
+}
+
+// result[i] = a[i] * b[i], result may be the same object as a or b.
+template <typename FloatingPointType, class Allocator>
+auto batch_multiply(cpp_double_fp_batch<FloatingPointType, Allocator>& result, const cpp_double_fp_batch<FloatingPointType, Allocator>& a, const cpp_double_fp_batch<FloatingPointType, Allocator>& b) -> void
+{
+   BOOST_MP_ASSERT(a.size() == b.size());
+
+   result.resize(a.size());
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::mul, FloatingPointType>(result.ref(), a.cref(), b.cref(), a.size());
+}
+
+// result[i] = a[i] * b[i] + c[i], rounded after the multiplication and again after the addition.
+template <typename FloatingPointType, class Allocator>
+auto batch_fma(cpp_double_fp_batch<FloatingPointType, Allocator>& result, const cpp_double_fp_batch<FloatingPointType, Allocator>& a, const cpp_double_fp_batch<FloatingPointType, Allocator>& b, const cpp_double_fp_batch<FloatingPointType, Allocator>& c) -> void
+{
+   BOOST_MP_ASSERT((a.size() == b.size()) && (a.size() == c.size()));
+
+   result.resize(a.size());
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::fma, FloatingPointType>(result.ref(), a.cref(), b.cref(), c.cref(), a.size());
+}
+
+// y[i] += alpha * x[i].
+template <typename FloatingPointType, class Allocator>
+auto batch_axpy(const typename cpp_double_fp_batch<FloatingPointType, Allocator>::value_type& alpha, const cpp_double_fp_batch<FloatingPointType, Allocator>& x, cpp_double_fp_batch<FloatingPointType, Allocator>& y) -> void
+{
+   BOOST_MP_ASSERT(x.size() == y.size());
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::axpy, FloatingPointType>(alpha.backend().crep().first, alpha.backend().crep().second, x.cref(), y.ref(), x.size());
+}
+
+// Returns the sum of a[i] * b[i].
+template <typename FloatingPointType, class Allocator>
+auto batch_dot(const cpp_double_fp_batch<FloatingPointType, Allocator>& a, const cpp_double_fp_batch<FloatingPointType, Allocator>& b) -> typename cpp_double_fp_batch<FloatingPointType, Allocator>::value_type
+{
+   BOOST_MP_ASSERT(a.size() == b.size());
+
+   typename cpp_double_fp_batch<FloatingPointType, Allocator>::value_type result { };
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::dot, FloatingPointType>(&result.backend().rep().first, &result.backend().rep().second, a.cref(), b.cref(), a.size());
+
+   return result;
+}
+
+// result[i] = the polynomial with the given coefficients (constant term first) at x[i],
+// result may be the same object as x.
+template <typename FloatingPointType, class Allocator>
+auto batch_horner(cpp_double_fp_batch<FloatingPointType, Allocator>& result, const cpp_double_fp_batch<FloatingPointType, Allocator>& x, const cpp_double_fp_batch<FloatingPointType, Allocator>& coefficients) -> void
+{
+   BOOST_MP_ASSERT(!coefficients.empty());
+
+   if (&result == &x)
+   {
+      cpp_double_fp_batch<FloatingPointType, Allocator> t { };
+
+      batch_horner(t, x, coefficients);
+
+      result = static_cast<cpp_double_fp_batch<FloatingPointType, Allocator>&&>(t);
+
+      return;
+   }
+
+   result.resize(x.size());
+
+   backends::cpp_df_qf_detail::batch_run<backends::cpp_df_qf_detail::batch_kernel::horner, FloatingPointType>(result.ref(), x.cref(), coefficients.cref(), coefficients.size() - 1U, x.size());
+}
+
+} } // namespace boost::multiprecision
+
+#endif // BOOST_MP_CPP_DOUBLE_FP_BATCH_2026_10_18_HPP
@@ -1882,6 +1882,10 @@ public:
             }
             result.normalize();
          }
+         else if (use_recursive_radix_conversion_digits(n))
+         {
+            radix_conversion_from_decimal(result, s, n);
+         }
          else
          {
             // Base 10, we extract blocks of size 10^9 at a time, that way
@@ -2052,28 +2056,27 @@ public:
       {
          if (this->sign())
             BOOST_MP_THROW_EXCEPTION(std::runtime_error("Base 8 or 16 printing of negative numbers is not supported."));
-         limb_type       shift = base == 8 ? 3 : 4;
-         limb_type       mask  = static_cast<limb_type>((1u << shift) - 1);
-         cpp_int_backend t(*this);
+         std::size_t shift = base == 8 ? 3 : 4;
+         limb_type   mask  = static_cast<limb_type>((1u << shift) - 1);
          result.assign(Bits / shift + ((Bits % shift) ? 1 : 0), '0');
          std::string::difference_type pos      = static_cast<std::string::difference_type>(result.size() - 1u);
          char                         letter_a = f & std::ios_base::uppercase ? 'A' : 'a';
-         for (std::size_t i = 0; i < Bits / shift; ++i)
+         //
+         // Each digit is read directly from the limbs, octal digits may straddle two limbs:
+         //
+         typename base_type::const_limb_pointer p = this->limbs();
+         for (std::size_t bit = 0; bit < Bits; bit += shift)
          {
-            char c = static_cast<char>('0' + static_cast<char>(t.limbs()[0] & mask));
+            std::size_t limb   = bit / base_type::limb_bits;
+            std::size_t offset = bit % base_type::limb_bits;
+            limb_type   v      = p[limb] >> offset;
+            if ((offset + shift > base_type::limb_bits) && (limb + 1 < this->size()))
+               v |= p[limb + 1] << (base_type::limb_bits - offset);
+            char c = static_cast<char>('0' + static_cast<char>(v & mask));
             if (c > '9')
                c = static_cast<char>(c + letter_a - '9' - 1);
             result[static_cast<std::size_t>(pos)] = c;
             --pos;
-            eval_right_shift(t, shift);
-         }
-         if (Bits % shift)
-         {
-            mask   = static_cast<limb_type>((1u << (Bits % shift)) - 1);
-            char c = static_cast<char>('0' + static_cast<char>(t.limbs()[0] & mask));
-            if (c > '9')
-               c = static_cast<char>(c + letter_a - '9');
-            result[static_cast<std::size_t>(pos)] = c;
          }
          //
          // Get rid of leading zeros:
@@ -2104,6 +2107,10 @@ public:
          {
             result = std::to_string(t.limbs()[0]);
          }
+         else if (use_recursive_radix_conversion(this->size()))
+         {
+            radix_conversion_to_decimal(result, t);
+         }
          else
          {
             cpp_int_backend block10;
@@ -2351,10 +2358,15 @@ struct is_convertible_arithmetic<uint128_type, backends::cpp_int_backend<MinBits
 #include <boost/multiprecision/cpp_int/add.hpp>
 #include <boost/multiprecision/cpp_int/multiply.hpp>
 #include <boost/multiprecision/cpp_int/divide.hpp>
+#include <boost/multiprecision/cpp_int/radix_conversion.hpp>
 #include <boost/multiprecision/cpp_int/bitwise.hpp>
+#include <boost/multiprecision/cpp_int/fixed_width.hpp>
 #include <boost/multiprecision/cpp_int/misc.hpp>
 #include <boost/multiprecision/cpp_int/literals.hpp>
 #include <boost/multiprecision/cpp_int/serialize.hpp>
 #include <boost/multiprecision/cpp_int/import_export.hpp>
+#include <boost/multiprecision/cpp_int/binary_codec.hpp>
+#include <boost/multiprecision/cpp_int/montgomery.hpp>
+#include <boost/multiprecision/cpp_int/barrett.hpp>
 
 #endif
@@ -7,7 +7,7 @@
 #ifndef BOOST_MP_ADD_UNSIGNED_HPP
 #define BOOST_MP_ADD_UNSIGNED_HPP
 
-#include <boost/multiprecision/cpp_int/intel_intrinsics.hpp>
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
 
 namespace boost { namespace multiprecision { namespace backends {
@@ -218,31 +218,8 @@ inline BOOST_MP_CXX14_CONSTEXPR void add_unsigned(CppInt1& result, const CppInt2
       if (as < bs)
          swap(pa, pb);
       // First where a and b overlap:
-      std::size_t      i = 0;
-      unsigned char carry = 0;
-#if defined(BOOST_MSVC) && !defined(BOOST_HAS_INT128) && defined(_M_X64)
-      //
-      // Special case for 32-bit limbs on 64-bit architecture - we can process
-      // 2 limbs with each instruction.
-      //
-      for (; i + 8 <= m; i += 8)
-      {
-         carry = _addcarry_u64(carry, *(unsigned long long*)(pa + i + 0), *(unsigned long long*)(pb + i + 0), (unsigned long long*)(pr + i));
-         carry = _addcarry_u64(carry, *(unsigned long long*)(pa + i + 2), *(unsigned long long*)(pb + i + 2), (unsigned long long*)(pr + i + 2));
-         carry = _addcarry_u64(carry, *(unsigned long long*)(pa + i + 4), *(unsigned long long*)(pb + i + 4), (unsigned long long*)(pr + i + 4));
-         carry = _addcarry_u64(carry, *(unsigned long long*)(pa + i + 6), *(unsigned long long*)(pb + i + 6), (unsigned long long*)(pr + i + 6));
-      }
-#else
-      for (; i + 4 <= m; i += 4)
-      {
-         carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i + 0], pb[i + 0], pr + i);
-         carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i + 1], pb[i + 1], pr + i + 1);
-         carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i + 2], pb[i + 2], pr + i + 2);
-         carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i + 3], pb[i + 3], pr + i + 3);
-      }
-#endif
-      for (; i < m; ++i)
-         carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i], pb[i], pr + i);
+      std::size_t   i     = m;
+      unsigned char carry = static_cast<unsigned char>(::boost::multiprecision::detail::limb_add_n(pr, pa, pb, m));
       for (; i < x && carry; ++i)
          // We know carry is 1, so we just need to increment pa[i] (ie add a literal 1) and capture the carry:
          carry = ::boost::multiprecision::detail::addcarry_limb(0, pa[i], 1, pr + i);
@@ -315,33 +292,9 @@ inline BOOST_MP_CXX14_CONSTEXPR void subtract_unsigned(CppInt1& result, const Cp
          return;
       }
 
-      std::size_t i = 0;
-      unsigned char borrow = 0;
       // First where a and b overlap:
-#if defined(BOOST_MSVC) && !defined(BOOST_HAS_INT128) && defined(_M_X64)
-      //
-      // Special case for 32-bit limbs on 64-bit architecture - we can process
-      // 2 limbs with each instruction.
-      //
-      for (; i + 8 <= m; i += 8)
-      {
-         borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(pa + i), *reinterpret_cast<const unsigned long long*>(pb + i), reinterpret_cast<unsigned long long*>(pr + i));
-         borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(pa + i + 2), *reinterpret_cast<const unsigned long long*>(pb + i + 2), reinterpret_cast<unsigned long long*>(pr + i + 2));
-         borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(pa + i + 4), *reinterpret_cast<const unsigned long long*>(pb + i + 4), reinterpret_cast<unsigned long long*>(pr + i + 4));
-         borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(pa + i + 6), *reinterpret_cast<const unsigned long long*>(pb + i + 6), reinterpret_cast<unsigned long long*>(pr + i + 6));
-      }
-#else
-      for(; i + 4 <= m; i += 4)
-      {
-         borrow = boost::multiprecision::detail::subborrow_limb(borrow, pa[i], pb[i], pr + i);
-         borrow = boost::multiprecision::detail::subborrow_limb(borrow, pa[i + 1], pb[i + 1], pr + i + 1);
-         borrow = boost::multiprecision::detail::subborrow_limb(borrow, pa[i + 2], pb[i + 2], pr + i + 2);
-         borrow = boost::multiprecision::detail::subborrow_limb(borrow, pa[i + 3], pb[i + 3], pr + i + 3);
-      }
-#endif
-      for (; i < m; ++i)
-         borrow = boost::multiprecision::detail::subborrow_limb(borrow, pa[i], pb[i], pr + i);
-
+      std::size_t   i      = m;
+      unsigned char borrow = static_cast<unsigned char>(boost::multiprecision::detail::limb_sub_n(pr, pa, pb, m));
       // Now where only a has digits, only as long as we've borrowed:
       while (borrow && (i < x))
       {
@@ -0,0 +1,194 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   https://www.boost.org/LICENSE_1_0.txt)
+//
+// Barrett reduction by a fixed modulus for cpp_int_backend:
+//
+#ifndef BOOST_MP_CPP_INT_BARRETT_HPP
+#define BOOST_MP_CPP_INT_BARRETT_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4127) // conditional expression is constant
+#endif
+//
+// Holds a positive modulus m of n limbs along with the reciprocal mu = floor(b^2n / m),
+// where b = 2^bits_per_limb.  Any value x < b^2n can then be reduced modulo m with
+// two half-products and at most a few subtractions (Handbook of Applied Cryptography,
+// algorithm 14.42), larger values fall back to ordinary division.
+//
+// As with montgomery_engine the constants are held in the variable precision type,
+// but reduction works directly on the limbs of the caller's values, so fixed precision
+// arguments are neither converted nor allocated for.
+//
+class barrett_engine
+{
+ public:
+   using backend_type = cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> >;
+
+   template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+   explicit barrett_engine(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& m)
+      : m_modulus(m)
+   {
+      using default_ops::eval_get_sign;
+      if (eval_get_sign(m_modulus) <= 0)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("Barrett reduction requires a positive modulus."));
+      }
+      backend_type t(static_cast<limb_type>(1u));
+      eval_left_shift(t, 2 * m_modulus.size() * bits_per_limb);
+      eval_divide(m_reciprocal, t, m_modulus);
+   }
+
+   const backend_type& modulus() const noexcept { return m_modulus; }
+   const backend_type& reciprocal() const noexcept { return m_reciprocal; }
+   //
+   // Scratch space required by reduce_limbs:
+   //
+   std::size_t workspace_size() const noexcept
+   {
+      return 2 * m_modulus.size() + 4 + m_reciprocal.size();
+   }
+   //
+   // Sets pr[0, n] to the residue of the xn limb value px, which must satisfy n <= xn <= 2n.
+   // The result has n + 1 limbs, the most significant of which is always zero on exit.
+   //
+   void reduce_limbs(limb_type* pr, const limb_type* px, std::size_t xn, limb_type* workspace) const
+   {
+      const std::size_t n   = m_modulus.size();
+      const std::size_t mun = m_reciprocal.size();
+      const limb_type*  pm  = m_modulus.limbs();
+      const limb_type*  pmu = m_reciprocal.limbs();
+      BOOST_MP_ASSERT((xn >= n) && (xn <= 2 * n));
+      //
+      // q = floor(floor(x / b^(n-1)) * mu / b^(n+1)).  Partial products below column n-1
+      // can alter q by at most one, so they're skipped, which halves the work:
+      //
+      const limb_type*  pq1 = px + (n - 1);
+      const std::size_t q1n = xn - (n - 1);
+      limb_type*        pq2 = workspace;
+      std::memset(pq2, 0, (q1n + mun) * sizeof(limb_type));
+      for (std::size_t i = 0; i < q1n; ++i)
+      {
+         const std::size_t j = i < n - 1 ? n - 1 - i : 0;
+         BOOST_MP_ASSERT(j < mun);
+         pq2[i + mun]        = ::boost::multiprecision::detail::limb_addmul_1(pq2 + i + j, pmu + j, mun - j, pq1[i]);
+      }
+      const limb_type*  pq  = pq2 + (n + 1);
+      const std::size_t qn  = q1n + mun > n + 1 ? q1n + mun - (n + 1) : 0;
+      //
+      // r = (x - q * m) mod b^(n+1), only the low n+1 limbs of q * m are needed:
+      //
+      std::memset(pr, 0, (n + 1) * sizeof(limb_type));
+      for (std::size_t i = 0; (i < qn) && (i <= n); ++i)
+      {
+         limb_type carry = ::boost::multiprecision::detail::limb_addmul_1(pr + i, pm, (std::min)(n, n + 1 - i), pq[i]);
+         if (i == 0)
+            pr[n] = carry;
+      }
+      limb_type borrow = 0;
+      for (std::size_t i = 0; i <= n; ++i)
+      {
+         limb_type xi = i < xn ? px[i] : 0;
+         limb_type d  = static_cast<limb_type>(xi - pr[i] - borrow);
+         borrow       = (xi < pr[i]) || ((xi == pr[i]) && borrow) ? 1u : 0u;
+         pr[i]        = d;
+      }
+      //
+      // The estimate of q is at most three too small:
+      //
+      while (compare_to_modulus(pr) >= 0)
+      {
+         borrow = 0;
+         for (std::size_t i = 0; i <= n; ++i)
+         {
+            limb_type mi = i < n ? pm[i] : 0;
+            limb_type d  = static_cast<limb_type>(pr[i] - mi - borrow);
+            borrow       = (pr[i] < mi) || ((pr[i] == mi) && borrow) ? 1u : 0u;
+            pr[i]        = d;
+         }
+      }
+   }
+   //
+   // Sets result = x % m, with the sign of the result following that of x as for eval_modulus.
+   // result may alias x:
+   //
+   template <class CppInt1, class CppInt2>
+   void reduce(CppInt1& result, const CppInt2& x) const
+   {
+      const std::size_t n  = m_modulus.size();
+      const std::size_t xn = x.size();
+      if ((xn > 2 * n) || (n == 1))
+      {
+         // Too large for a single Barrett step, or a single limb modulus which has its own fast path:
+         eval_modulus(result, x, m_modulus);
+         return;
+      }
+      if ((xn < n) || ((xn == n) && (x.compare_unsigned(m_modulus) < 0)))
+      {
+         if ((void*)&result != (void*)&x)
+            result = x;
+         return;
+      }
+      bool                  s = x.sign();
+      constexpr std::size_t stack_limbs = 64;
+      limb_type             stack_buffer[stack_limbs];
+      std::size_t           needed = workspace_size() + n + 1;
+      if (needed <= stack_limbs)
+         reduce_into(result, x, stack_buffer);
+      else
+      {
+         typename backend_type::scoped_shared_storage storage(m_modulus.allocator(), needed);
+         reduce_into(result, x, storage.allocate(needed));
+      }
+      result.sign(s);
+   }
+
+ private:
+   int compare_to_modulus(const limb_type* pr) const noexcept
+   {
+      const std::size_t n  = m_modulus.size();
+      const limb_type*  pm = m_modulus.limbs();
+      if (pr[n])
+         return 1;
+      for (std::size_t i = n; i > 0; --i)
+      {
+         if (pr[i - 1] != pm[i - 1])
+            return pr[i - 1] > pm[i - 1] ? 1 : -1;
+      }
+      return 0;
+   }
+   template <class CppInt1, class CppInt2>
+   void reduce_into(CppInt1& result, const CppInt2& x, limb_type* workspace) const
+   {
+      const std::size_t n  = m_modulus.size();
+      limb_type*        pr = workspace + workspace_size();
+      reduce_limbs(pr, x.limbs(), x.size(), workspace);
+      result.resize(n, n);
+      BOOST_MP_ASSERT(result.size() == n);
+      std::memcpy(result.limbs(), pr, n * sizeof(limb_type));
+      result.normalize();
+   }
+
+   backend_type m_modulus, m_reciprocal;
+};
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
@@ -0,0 +1,176 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Binary encoding of cpp_int, see boost/multiprecision/detail/binary_codec.hpp for the format.
+//
+
+#ifndef BOOST_MP_CPP_INT_BINARY_CODEC_HPP
+#define BOOST_MP_CPP_INT_BINARY_CODEC_HPP
+
+#include <boost/multiprecision/detail/binary_codec.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace backends {
+
+namespace detail {
+
+//
+// Number of significant bytes in the magnitude:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline std::size_t binary_codec_byte_count(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, const std::integral_constant<bool, false>&) noexcept
+{
+   std::size_t size = val.size();
+   limb_type   top  = val.limbs()[size - 1];
+   if (!top)
+      return 0; // normalized, so this is zero
+   return (size - 1) * sizeof(limb_type) + boost::multiprecision::detail::find_msb(top) / CHAR_BIT + 1;
+}
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline std::size_t binary_codec_byte_count(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, const std::integral_constant<bool, true>&) noexcept
+{
+   std::size_t result = 0;
+   for (typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::local_limb_type l = *val.limbs(); l; l >>= CHAR_BIT)
+      ++result;
+   return result;
+}
+template <class CppInt>
+inline std::size_t binary_codec_byte_count(const CppInt& val) noexcept
+{
+   return binary_codec_byte_count(val, std::integral_constant<bool, is_trivial_cpp_int<CppInt>::value>());
+}
+
+//
+// Copy byte_count bytes of the magnitude, starting from bit first_bit, to p:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void binary_codec_store(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, unsigned char* p, std::size_t first_bit, std::size_t byte_count, const std::integral_constant<bool, false>&) noexcept
+{
+   constexpr std::size_t limb_bits = sizeof(limb_type) * CHAR_BIT;
+
+   const limb_type*  pl    = val.limbs();
+   const std::size_t size  = val.size();
+   const std::size_t first = first_bit / limb_bits;
+   const std::size_t shift = first_bit % limb_bits;
+#if BOOST_MP_ENDIAN_LITTLE_BYTE
+   if (!shift)
+   {
+      std::memcpy(p, pl + first, byte_count);
+      return;
+   }
+#endif
+   for (std::size_t i = first; byte_count; ++i)
+   {
+      limb_type l = pl[i] >> shift;
+      if (shift && (i + 1 < size))
+         l |= pl[i + 1] << (limb_bits - shift);
+      std::size_t n = (std::min)(byte_count, sizeof(limb_type));
+#if BOOST_MP_ENDIAN_LITTLE_BYTE
+      std::memcpy(p, &l, n);
+      p += n;
+#else
+      for (std::size_t j = 0; j < n; ++j, l >>= CHAR_BIT)
+         *p++ = static_cast<unsigned char>(l);
+#endif
+      byte_count -= n;
+   }
+}
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void binary_codec_store(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, unsigned char* p, std::size_t first_bit, std::size_t byte_count, const std::integral_constant<bool, true>&) noexcept
+{
+   typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::local_limb_type l = *val.limbs();
+   if (byte_count)
+      l >>= first_bit;
+   for (std::size_t i = 0; i < byte_count; ++i, l >>= CHAR_BIT)
+      p[i] = static_cast<unsigned char>(l);
+}
+template <class CppInt>
+inline void binary_codec_store(const CppInt& val, unsigned char* p, std::size_t first_bit, std::size_t byte_count) noexcept
+{
+   binary_codec_store(val, p, first_bit, byte_count, std::integral_constant<bool, is_trivial_cpp_int<CppInt>::value>());
+}
+
+//
+// Set the magnitude from byte_count bytes at p, discarding high order bytes which
+// don't fit in an unchecked fixed precision type:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void binary_codec_load(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, const unsigned char* p, std::size_t byte_count, const std::integral_constant<bool, false>&)
+{
+   std::size_t limb_count = byte_count ? (byte_count - 1) / sizeof(limb_type) + 1 : 1;
+   val.resize(limb_count, limb_count);
+   limb_count = val.size();
+   byte_count = (std::min)(byte_count, limb_count * sizeof(limb_type));
+   limb_type* pl = val.limbs();
+   pl[limb_count - 1] = 0;
+#if BOOST_MP_ENDIAN_LITTLE_BYTE
+   std::memcpy(pl, p, byte_count);
+#else
+   for (std::size_t i = 0; i < limb_count; ++i)
+      pl[i] = 0;
+   for (std::size_t i = 0; i < byte_count; ++i)
+      pl[i / sizeof(limb_type)] |= static_cast<limb_type>(p[i]) << (CHAR_BIT * (i % sizeof(limb_type)));
+#endif
+}
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void binary_codec_load(cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val, const unsigned char* p, std::size_t byte_count, const std::integral_constant<bool, true>&)
+{
+   using local_limb_type = typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::local_limb_type;
+   if (byte_count > sizeof(local_limb_type))
+   {
+      BOOST_IF_CONSTEXPR(Checked == checked)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::overflow_error("Decoded value is out of range of the fixed precision integer type."));
+      }
+      byte_count = sizeof(local_limb_type);
+   }
+   local_limb_type l = 0;
+   for (std::size_t i = byte_count; i; --i)
+      l = static_cast<local_limb_type>((l << CHAR_BIT) | p[i - 1]);
+   *val.limbs() = l;
+}
+
+template <class CppInt>
+inline void binary_codec_load(CppInt& val, const unsigned char* p, std::size_t byte_count)
+{
+   binary_codec_load(val, p, byte_count, std::integral_constant<bool, is_trivial_cpp_int<CppInt>::value>());
+}
+
+} // namespace detail
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline std::size_t eval_binary_encoded_size(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val) noexcept
+{
+   std::size_t n = detail::binary_codec_byte_count(val);
+   return boost::multiprecision::detail::binary_varint_size((static_cast<std::uint64_t>(n) << 1) | val.sign()) + n;
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void eval_binary_encode(boost::multiprecision::detail::binary_writer& w, const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val)
+{
+   std::size_t n = detail::binary_codec_byte_count(val);
+   w.write_varint((static_cast<std::uint64_t>(n) << 1) | val.sign());
+   detail::binary_codec_store(val, w.reserve(n), 0, n);
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+inline void eval_binary_decode(boost::multiprecision::detail::binary_reader& r, cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& val)
+{
+   std::uint64_t h = r.read_varint();
+   if ((h >> 1) > r.remaining())
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Unexpected end of input while decoding a multiprecision value."));
+   }
+   std::size_t n = static_cast<std::size_t>(h >> 1);
+   detail::binary_codec_load(val, r.read(n), n);
+   if ((h & 1u) != val.sign())
+      val.negate();
+   val.normalize();
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif // BOOST_MP_CPP_INT_BINARY_CODEC_HPP
@@ -140,6 +140,27 @@ inline limb_type block_multiplier(std::size_t count)
 
 constexpr std::size_t bits_per_limb = sizeof(limb_type) * CHAR_BIT;
 
+//
+// Number of limbs above which cpp_int converts to and from decimal strings by splitting
+// the value in two with a division or multiplication by a power of ten, rather than
+// working one block of digits at a time (see cpp_int/radix_conversion.hpp):
+//
+#ifdef BOOST_MP_RADIX_CONVERSION_CUTOFF
+constexpr std::size_t radix_conversion_cutoff = BOOST_MP_RADIX_CONVERSION_CUTOFF;
+#else
+constexpr std::size_t radix_conversion_cutoff = 30;
+#endif
+
+inline bool use_recursive_radix_conversion(std::size_t limbs)
+{
+   return limbs > radix_conversion_cutoff;
+}
+inline bool use_recursive_radix_conversion_digits(std::size_t digits)
+{
+   // 1233 / 4096 is a slight overestimate of log10(2):
+   return use_recursive_radix_conversion(digits * 4096u / (1233u * bits_per_limb));
+}
+
 template <class T>
 inline BOOST_MP_CXX14_CONSTEXPR void minmax(const T& a, const T& b, T& aa, T& bb)
 {
@@ -8,11 +8,187 @@
 #ifndef BOOST_MP_CPP_INT_DIVIDE_HPP
 #define BOOST_MP_CPP_INT_DIVIDE_HPP
 
+#include <cstring>
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
 
 namespace boost { namespace multiprecision { namespace backends {
 
+//
+// Minimum number of limbs in both the divisor and the quotient before
+// recursive (Burnikel-Ziegler) division takes over from long division:
+//
+#ifdef BOOST_MP_DIVIDE_RECURSIVE_CUTOFF
+const std::size_t divide_recursive_cutoff = BOOST_MP_DIVIDE_RECURSIVE_CUTOFF;
+#else
+const std::size_t divide_recursive_cutoff = 80;
+#endif
+
+inline bool use_recursive_divide(std::size_t xs, std::size_t ys)
+{
+   return (ys >= divide_recursive_cutoff) && (xs >= ys + divide_recursive_cutoff);
+}
+
+template <class CppInt1, class CppInt2, class CppInt3>
+BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
+    CppInt1*       result,
+    const CppInt2& x,
+    const CppInt3& y,
+    CppInt1&       r);
+
+//
+// Recursive division after C. Burnikel and J. Ziegler, "Fast Recursive Division",
+// MPI-I-98-1-022, 1998.  Dividing 2n limbs by n limbs is reduced to two 3n/2 by n
+// limb divisions, each of which is one n by n/2 limb division plus an n/2 limb
+// multiplication, so division inherits the complexity of multiplication.
+// All the values are positive variable precision cpp_int's of the same type:
+//
+template <class CppInt>
+inline void divide_block(CppInt& r, const CppInt& a, std::size_t offset, std::size_t len)
+{
+   // r = limbs [offset, offset + len) of a:
+   std::size_t n = a.size() > offset ? (std::min)(len, a.size() - offset) : 0;
+   if (!n)
+   {
+      r = static_cast<limb_type>(0u);
+      return;
+   }
+   r.resize(n, n);
+   std::memcpy(r.limbs(), a.limbs() + offset, n * sizeof(limb_type));
+   r.normalize();
+}
+
+template <class CppInt>
+void divide_2n1n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, std::size_t n);
+
+//
+// Divides a of at most 3h limbs by b of 2h limbs whose most significant bit is set,
+// requires a < b * 2^(h * bits_per_limb):
+//
+template <class CppInt>
+void divide_3n2n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, std::size_t h)
+{
+   CppInt a1, b1, t;
+   divide_block(a1, a, 2 * h, h);
+   divide_block(b1, b, h, h);
+   divide_block(t, a, h, 2 * h);
+   if (a1.compare(b1) < 0)
+      divide_2n1n(q, r, t, b1, h);
+   else
+   {
+      // The quotient estimate saturates at 2^(h * bits_per_limb) - 1, and since a1 == b1
+      // the remainder a12 - q * b1 = a2 + b1:
+      q.resize(h, h);
+      std::memset(q.limbs(), 0xFF, h * sizeof(limb_type));
+      divide_block(r, a, h, h);
+      eval_add(r, b1);
+   }
+   // r = r * 2^(h * bits_per_limb) + a3 - q * b2, corrected by at most 2 additions of b:
+   eval_left_shift(r, h * bits_per_limb);
+   divide_block(t, a, 0, h);
+   eval_add(r, t);
+   divide_block(b1, b, 0, h);
+   eval_multiply(t, q, b1);
+   eval_subtract(r, t);
+   while (r.sign())
+   {
+      eval_add(r, b);
+      eval_decrement(q);
+   }
+}
+//
+// Divides a by b of n limbs whose most significant bit is set, requires a < b * 2^(n * bits_per_limb):
+//
+template <class CppInt>
+void divide_2n1n(CppInt& q, CppInt& r, const CppInt& a, const CppInt& b, std::size_t n)
+{
+   if ((n & 1u) || (n < divide_recursive_cutoff))
+   {
+      divide_unsigned_helper(&q, a, b, r);
+      return;
+   }
+   const std::size_t h = n / 2;
+   CppInt            t, q1;
+   divide_block(t, a, h, 3 * h);
+   divide_3n2n(q1, r, t, b, h);
+   eval_left_shift(r, h * bits_per_limb);
+   divide_block(t, a, 0, h);
+   eval_add(r, t);
+   t = r;
+   divide_3n2n(q, r, t, b, h);
+   // q = q1 * 2^(h * bits_per_limb) + q, where the lower part has at most h limbs:
+   std::size_t qs = q.size();
+   q.resize(h + q1.size(), h + q1.size());
+   BOOST_MP_ASSERT(q.size() == h + q1.size());
+   std::memset(q.limbs() + qs, 0, (h - qs) * sizeof(limb_type));
+   std::memcpy(q.limbs() + h, q1.limbs(), q1.size() * sizeof(limb_type));
+   q.normalize();
+}
+//
+// Sets q = a / b and r = a % b, a and b are positive and are overwritten:
+//
+template <class CppInt>
+void divide_recursive(CppInt& q, CppInt& r, CppInt& a, CppInt& b)
+{
+   //
+   // Pad the divisor to n = j * 2^k limbs, where j is small enough for long division to take over
+   // after k levels of recursion, then normalize so that its most significant bit is set:
+   //
+   const std::size_t s = b.size();
+   std::size_t       m = 1;
+   while (m * (divide_recursive_cutoff - 1) < s)
+      m <<= 1;
+   const std::size_t n     = ((s + m - 1) / m) * m;
+   const std::size_t shift = n * bits_per_limb - 1 - static_cast<std::size_t>(eval_msb(b));
+   eval_left_shift(b, shift);
+   eval_left_shift(a, shift);
+   //
+   // Split a into t blocks of n limbs, the top one having a clear most significant bit
+   // so that every partial remainder satisfies the requirements of divide_2n1n:
+   //
+   std::size_t t = (static_cast<std::size_t>(eval_msb(a)) + 2 + n * bits_per_limb - 1) / (n * bits_per_limb);
+   if (t < 2)
+      t = 2;
+   CppInt z, qi;
+   divide_block(z, a, (t - 2) * n, 2 * n);
+   q.resize((t - 1) * n, (t - 1) * n);
+   BOOST_MP_ASSERT(q.size() == (t - 1) * n);
+   std::memset(q.limbs(), 0, q.size() * sizeof(limb_type));
+   for (std::size_t i = t - 1; i > 0; --i)
+   {
+      divide_2n1n(qi, r, z, b, n);
+      std::memcpy(q.limbs() + (i - 1) * n, qi.limbs(), qi.size() * sizeof(limb_type));
+      if (i > 1)
+      {
+         eval_left_shift(r, n * bits_per_limb);
+         divide_block(z, a, (i - 2) * n, n);
+         eval_add(z, r);
+      }
+   }
+   q.normalize();
+   eval_right_shift(r, shift);
+}
+//
+// Sets *result = x / y and r = x % y, ignoring signs:
+//
+template <class CppInt1, class CppInt2, class CppInt3>
+void divide_unsigned_recursive(
+    CppInt1*       result,
+    const CppInt2& x,
+    const CppInt3& y,
+    CppInt1&       r)
+{
+   using working_type = cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> >;
+   working_type a(x), b(y), q, rem;
+   a.sign(false);
+   b.sign(false);
+   divide_recursive(q, rem, a, b);
+   if (result)
+      *result = q;
+   r = rem;
+}
+
 template <class CppInt1, class CppInt2, class CppInt3>
 BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
     CppInt1*       result,
@@ -77,6 +253,16 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
       return;
    }
 
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(y_order) && use_recursive_divide(x.size(), y.size()))
+#else
+   if (use_recursive_divide(x.size(), y.size()))
+#endif
+   {
+      divide_unsigned_recursive(result, x, y, r);
+      return;
+   }
+
    typename CppInt2::const_limb_pointer px = x.limbs();
    typename CppInt3::const_limb_pointer py = y.limbs();
 
@@ -220,6 +406,11 @@ BOOST_MP_CXX14_CONSTEXPR void divide_unsigned_helper(
       typename CppInt1::limb_pointer pt          = t.limbs();
       for (std::size_t i = 0; i < shift; ++i)
          pt[i] = 0;
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+      if (!BOOST_MP_IS_CONST_EVALUATED(guess))
+         carry = ::boost::multiprecision::detail::limb_mul_1(pt + shift, py, y.size(), guess);
+      else
+#endif
       for (std::size_t i = 0; i < y.size(); ++i)
       {
          carry += static_cast<double_limb_type>(py[i]) * static_cast<double_limb_type>(guess);
@@ -0,0 +1,385 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Arithmetic for the small fixed precision cpp_int's - uint256_t and friends.
+//
+// When all the arguments are the same unchecked fixed width type, and that type
+// occupies 2, 4, 8 or 16 limbs, we can drop the variable length logic altogether:
+// every operation works on exactly N limbs, with unused limbs read as zero, in
+// loops whose trip count is a compile time constant (and which are unrolled
+// completely), and the result is normalized just once at the end.  Everything
+// is constexpr.
+//
+// Define BOOST_MP_CPP_INT_NO_FIXED_WIDTH_KERNELS to disable these overloads.
+//
+#ifndef BOOST_MP_CPP_INT_FIXED_WIDTH_HPP
+#define BOOST_MP_CPP_INT_FIXED_WIDTH_HPP
+
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
+
+#ifndef BOOST_MP_CPP_INT_NO_FIXED_WIDTH_KERNELS
+
+#if defined(__clang__)
+#define BOOST_MP_FIXED_WIDTH_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && (__GNUC__ >= 8)
+#define BOOST_MP_FIXED_WIDTH_UNROLL _Pragma("GCC unroll 16")
+#else
+#define BOOST_MP_FIXED_WIDTH_UNROLL
+#endif
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// From this many limbs up, multiplication at runtime is faster done a row at a
+// time with limb_addmul_1 than with the unrolled loops:
+//
+#ifdef BOOST_MP_CPP_INT_FIXED_WIDTH_KERNEL_MULTIPLY_LIMBS
+constexpr std::size_t fixed_width_kernel_multiply_limbs = BOOST_MP_CPP_INT_FIXED_WIDTH_KERNEL_MULTIPLY_LIMBS;
+#else
+constexpr std::size_t fixed_width_kernel_multiply_limbs = 8;
+#endif
+
+//
+// Non-zero only for the types which get the unrolled treatment:
+//
+template <class CppInt, bool = is_trivial_cpp_int<CppInt>::value>
+struct fixed_width_limb_count : public std::integral_constant<std::size_t, 0>
+{};
+template <std::size_t Bits, cpp_integer_type SignType>
+struct fixed_width_limb_count<cpp_int_backend<Bits, Bits, SignType, unchecked, void>, false>
+{
+ private:
+   static constexpr std::size_t count = cpp_int_backend<Bits, Bits, SignType, unchecked, void>::internal_limb_count;
+
+ public:
+   static constexpr std::size_t value = (count == 2) || (count == 4) || (count == 8) || (count == 16) ? count : 0;
+};
+
+//
+// Limbs above size() may hold anything, so every read goes through this,
+// which treats them as zero:
+//
+BOOST_MP_FORCEINLINE constexpr limb_type fixed_width_limb(const limb_type* p, std::size_t size, std::size_t i) noexcept
+{
+   return i < size ? p[i] : 0;
+}
+
+template <class CppInt>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void fixed_width_negate(CppInt& result) noexcept
+{
+   // Two's complement of all the limbs, in place:
+   constexpr std::size_t         N     = fixed_width_limb_count<CppInt>::value;
+   typename CppInt::limb_pointer pr    = result.limbs();
+   double_limb_type              carry = 1;
+   BOOST_MP_FIXED_WIDTH_UNROLL
+   for (std::size_t i = 0; i < N; ++i)
+   {
+      carry += static_cast<limb_type>(~pr[i]);
+      pr[i] = static_cast<limb_type>(carry);
+      carry >>= CppInt::limb_bits;
+   }
+}
+
+//
+// Addition and subtraction overwrite all N limbs of the result in a single pass (so
+// aliasing between the arguments is harmless), and then normalize once.  Anything carried
+// out of the top limb is discarded, just as it is for other unchecked fixed precision
+// types:
+//
+template <std::size_t Bits, cpp_integer_type SignType>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value != 0>::type
+add_unsigned(
+    cpp_int_backend<Bits, Bits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) noexcept
+{
+   using backend_type = cpp_int_backend<Bits, Bits, SignType, unchecked, void>;
+   constexpr std::size_t N = fixed_width_limb_count<backend_type>::value;
+
+   std::size_t                             as = a.size();
+   std::size_t                             bs = b.size();
+   bool                                    s  = a.sign();
+   typename backend_type::const_limb_pointer pa = a.limbs();
+   typename backend_type::const_limb_pointer pb = b.limbs();
+   result.resize(N, N);
+   typename backend_type::limb_pointer pr = result.limbs();
+#if defined(BOOST_MP_HAS_IMMINTRIN_H) && !defined(BOOST_MP_NO_CONSTEXPR_DETECTION)
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+   {
+      unsigned char carry = 0;
+      if ((as == N) && (bs == N))
+      {
+         BOOST_MP_FIXED_WIDTH_UNROLL
+         for (std::size_t i = 0; i < N; ++i)
+            carry = ::boost::multiprecision::detail::addcarry_limb(carry, pa[i], pb[i], pr + i);
+      }
+      else
+      {
+         BOOST_MP_FIXED_WIDTH_UNROLL
+         for (std::size_t i = 0; i < N; ++i)
+            carry = ::boost::multiprecision::detail::addcarry_limb(carry, fixed_width_limb(pa, as, i), fixed_width_limb(pb, bs, i), pr + i);
+      }
+   }
+   else
+#endif
+   {
+      double_limb_type carry = 0;
+      BOOST_MP_FIXED_WIDTH_UNROLL
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         carry += static_cast<double_limb_type>(fixed_width_limb(pa, as, i)) + static_cast<double_limb_type>(fixed_width_limb(pb, bs, i));
+         pr[i] = static_cast<limb_type>(carry);
+         carry >>= backend_type::limb_bits;
+      }
+   }
+   result.normalize();
+   result.sign(s);
+}
+
+template <std::size_t Bits, cpp_integer_type SignType>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value != 0>::type
+subtract_unsigned(
+    cpp_int_backend<Bits, Bits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) noexcept
+{
+   using backend_type = cpp_int_backend<Bits, Bits, SignType, unchecked, void>;
+   constexpr std::size_t N = fixed_width_limb_count<backend_type>::value;
+
+   std::size_t                             as = a.size();
+   std::size_t                             bs = b.size();
+   bool                                    s  = a.sign();
+   typename backend_type::const_limb_pointer pa = a.limbs();
+   typename backend_type::const_limb_pointer pb = b.limbs();
+   result.resize(N, N);
+   typename backend_type::limb_pointer pr = result.limbs();
+   bool                                borrowed = false;
+#if defined(BOOST_MP_HAS_IMMINTRIN_H) && !defined(BOOST_MP_NO_CONSTEXPR_DETECTION)
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+   {
+      unsigned char borrow = 0;
+      if ((as == N) && (bs == N))
+      {
+         BOOST_MP_FIXED_WIDTH_UNROLL
+         for (std::size_t i = 0; i < N; ++i)
+            borrow = ::boost::multiprecision::detail::subborrow_limb(borrow, pa[i], pb[i], pr + i);
+      }
+      else
+      {
+         BOOST_MP_FIXED_WIDTH_UNROLL
+         for (std::size_t i = 0; i < N; ++i)
+            borrow = ::boost::multiprecision::detail::subborrow_limb(borrow, fixed_width_limb(pa, as, i), fixed_width_limb(pb, bs, i), pr + i);
+      }
+      borrowed = borrow;
+   }
+   else
+#endif
+   {
+      double_limb_type borrow = 0;
+      BOOST_MP_FIXED_WIDTH_UNROLL
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         borrow = static_cast<double_limb_type>(fixed_width_limb(pa, as, i)) - static_cast<double_limb_type>(fixed_width_limb(pb, bs, i)) - borrow;
+         pr[i]  = static_cast<limb_type>(borrow);
+         borrow = (borrow >> backend_type::limb_bits) & 1u;
+      }
+      borrowed = borrow;
+   }
+   if (borrowed && (SignType == signed_magnitude))
+   {
+      // |b| > |a|: for unsigned types the wrapped value is already the answer,
+      // otherwise negate to get |b| - |a| and flip the sign:
+      fixed_width_negate(result);
+      s = !s;
+   }
+   result.normalize();
+   result.sign(s);
+}
+
+template <std::size_t Bits, cpp_integer_type SignType>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value != 0>::type
+eval_multiply(
+    cpp_int_backend<Bits, Bits, SignType, unchecked, void>&       result,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& a,
+    const cpp_int_backend<Bits, Bits, SignType, unchecked, void>& b) noexcept
+{
+   using backend_type = cpp_int_backend<Bits, Bits, SignType, unchecked, void>;
+   constexpr std::size_t N = fixed_width_limb_count<backend_type>::value;
+
+   if ((&result == &a) || (&result == &b))
+   {
+      backend_type t(result);
+      eval_multiply(result, &result == &a ? t : a, &result == &b ? t : b);
+      return;
+   }
+   //
+   // Only the low N limbs of the product are needed, and rows for the unused
+   // limbs of a are skipped, so that small values held in a wide type don't
+   // pay for the full width:
+   //
+   std::size_t                             as = a.size();
+   std::size_t                             bs = b.size();
+   typename backend_type::const_limb_pointer pa = a.limbs();
+   typename backend_type::const_limb_pointer pb = b.limbs();
+   if (as > bs)
+   {
+      std_constexpr::swap(as, bs);
+      std_constexpr::swap(pa, pb);
+   }
+   result.resize(N, N);
+   typename backend_type::limb_pointer pr = result.limbs();
+   BOOST_MP_FIXED_WIDTH_UNROLL
+   for (std::size_t i = 0; i < N; ++i)
+      pr[i] = 0;
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(as) && (N >= fixed_width_kernel_multiply_limbs))
+   {
+      for (std::size_t i = 0; i < as; ++i)
+      {
+         if (i + bs < N)
+            pr[i + bs] = ::boost::multiprecision::detail::limb_addmul_1(pr + i, pb, bs, pa[i]);
+         else
+            ::boost::multiprecision::detail::limb_addmul_1(pr + i, pb, N - i, pa[i]);
+      }
+   }
+   else
+#endif
+   {
+      BOOST_MP_FIXED_WIDTH_UNROLL
+      for (std::size_t i = 0; i < N; ++i)
+      {
+         if (i >= as)
+            break;
+         double_limb_type carry = 0;
+         BOOST_MP_FIXED_WIDTH_UNROLL
+         for (std::size_t j = 0; j < N - i; ++j)
+         {
+            carry += static_cast<double_limb_type>(pa[i]) * static_cast<double_limb_type>(fixed_width_limb(pb, bs, j)) + pr[i + j];
+            pr[i + j] = static_cast<limb_type>(carry);
+            carry >>= backend_type::limb_bits;
+         }
+      }
+   }
+   result.normalize();
+   result.sign(a.sign() != b.sign());
+}
+
+//
+// The shifts operate in place, so rather than testing every read against the size
+// of the argument, the limbs between the old and new sizes are zeroed first:
+//
+template <std::size_t Bits, cpp_integer_type SignType>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, SignType, unchecked, void> >::value != 0>::type
+eval_left_shift(
+    cpp_int_backend<Bits, Bits, SignType, unchecked, void>& result,
+    double_limb_type                                        s) noexcept
+{
+   using backend_type = cpp_int_backend<Bits, Bits, SignType, unchecked, void>;
+   constexpr std::size_t N = fixed_width_limb_count<backend_type>::value;
+
+   if (!s)
+      return;
+   if (s >= N * backend_type::limb_bits)
+   {
+      result = static_cast<limb_type>(0u);
+      return;
+   }
+   std::size_t                         offset = static_cast<std::size_t>(s / backend_type::limb_bits);
+   unsigned                            shift  = static_cast<unsigned>(s % backend_type::limb_bits);
+   std::size_t                         rs     = result.size();
+   std::size_t                         ns     = (std::min)(N, rs + offset + (shift ? 1 : 0));
+   typename backend_type::limb_pointer pr     = result.limbs();
+   for (std::size_t i = rs; i < ns; ++i)
+      pr[i] = 0;
+   //
+   // Working down from the top, each limb only depends on limbs below it, which
+   // are yet to be overwritten:
+   //
+   std::size_t i = ns - 1;
+   if (shift)
+   {
+      for (; i > offset; --i)
+         pr[i] = static_cast<limb_type>(pr[i - offset] << shift) | static_cast<limb_type>(pr[i - offset - 1] >> (backend_type::limb_bits - shift));
+      pr[i] = static_cast<limb_type>(pr[0] << shift);
+   }
+   else
+   {
+      for (; i > offset; --i)
+         pr[i] = pr[i - offset];
+      pr[i] = pr[0];
+   }
+   while (i)
+      pr[--i] = 0;
+   result.resize(ns, ns);
+   result.normalize();
+}
+
+template <class CppInt>
+BOOST_MP_FORCEINLINE BOOST_MP_CXX14_CONSTEXPR void fixed_width_right_shift(CppInt& result, double_limb_type s) noexcept
+{
+   std::size_t rs = result.size();
+   if (s >= rs * CppInt::limb_bits)
+   {
+      result = static_cast<limb_type>(0u);
+      return;
+   }
+   std::size_t                   offset = static_cast<std::size_t>(s / CppInt::limb_bits);
+   unsigned                      shift  = static_cast<unsigned>(s % CppInt::limb_bits);
+   std::size_t                   ns     = rs - offset;
+   typename CppInt::limb_pointer pr     = result.limbs();
+   //
+   // Working up from the bottom, each limb only depends on limbs above it:
+   //
+   std::size_t i = 0;
+   if (shift)
+   {
+      for (; i + 1 < ns; ++i)
+         pr[i] = static_cast<limb_type>(pr[i + offset] >> shift) | static_cast<limb_type>(pr[i + offset + 1] << (CppInt::limb_bits - shift));
+      pr[i] = static_cast<limb_type>(pr[rs - 1] >> shift);
+   }
+   else
+   {
+      for (; i + 1 < ns; ++i)
+         pr[i] = pr[i + offset];
+      pr[i] = pr[rs - 1];
+   }
+   result.resize(ns, ns);
+   result.normalize();
+}
+
+template <std::size_t Bits>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, unsigned_magnitude, unchecked, void> >::value != 0>::type
+eval_right_shift(
+    cpp_int_backend<Bits, Bits, unsigned_magnitude, unchecked, void>& result,
+    double_limb_type                                                  s) noexcept
+{
+   if (s)
+      fixed_width_right_shift(result, s);
+}
+
+template <std::size_t Bits>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<fixed_width_limb_count<cpp_int_backend<Bits, Bits, signed_magnitude, unchecked, void> >::value != 0>::type
+eval_right_shift(
+    cpp_int_backend<Bits, Bits, signed_magnitude, unchecked, void>& result,
+    double_limb_type                                                s) noexcept
+{
+   if (!s)
+      return;
+   //
+   // Negative values round towards -infinity, as in the general case:
+   //
+   bool is_neg = result.sign();
+   if (is_neg)
+      eval_increment(result);
+   fixed_width_right_shift(result, s);
+   if (is_neg)
+      eval_decrement(result);
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif // BOOST_MP_CPP_INT_NO_FIXED_WIDTH_KERNELS
+
+#endif
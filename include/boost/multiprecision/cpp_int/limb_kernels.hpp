@@ -0,0 +1,400 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_CPP_INT_LIMB_KERNELS_HPP
+#define BOOST_MP_CPP_INT_LIMB_KERNELS_HPP
+
+#include <boost/multiprecision/detail/number_base.hpp>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <boost/multiprecision/cpp_int/intel_intrinsics.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+#include <cstddef>
+
+//
+// The inner loops of cpp_int arithmetic operate on arrays of limbs via the kernels below, named
+// after their equivalents in GMP:
+//
+// limb_add_n(r, a, b, n)          r[0, n) = a + b, returns the carry.
+// limb_sub_n(r, a, b, n)          r[0, n) = a - b, returns the borrow.
+// limb_mul_1(r, a, n, b)          r[0, n) = a * b, returns the high limb.
+// limb_addmul_1(r, a, n, b)       r[0, n) += a * b, returns the carry limb.
+// limb_submul_1(r, a, n, b)       r[0, n) -= a * b, returns the borrow limb.
+// limb_sqr_diag_addlsh1(r, a, n)  r[0, 2n) = 2 * r + the squares a[i]^2 at limb 2i, which must not overflow.
+//
+// In each case r may be the same array as a (or b) but must not otherwise overlap them.
+//
+// On x86-64 with GCC or clang the multiplying kernels also have versions using the BMI2 mulx
+// instruction and the two independent carry chains of the ADX adcx/adox instructions, which are
+// chosen at runtime when the CPU supports them.  Defining BOOST_MP_CPP_INT_NO_DISPATCH
+// turns this off.
+//
+#if !defined(BOOST_MP_CPP_INT_NO_DISPATCH) && defined(BOOST_HAS_INT128) && (defined(__GNUC__) || defined(__clang__)) && defined(__x86_64__) && !defined(BOOST_INTEL)
+#define BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+#endif
+
+namespace boost { namespace multiprecision { namespace detail {
+
+inline limb_type limb_add_n(limb_type* r, const limb_type* a, const limb_type* b, std::size_t n) noexcept
+{
+   std::size_t i = 0;
+#ifdef BOOST_MP_HAS_IMMINTRIN_H
+   unsigned char carry = 0;
+#if defined(BOOST_MSVC) && !defined(BOOST_HAS_INT128) && defined(_M_X64)
+   //
+   // Special case for 32-bit limbs on 64-bit architecture - we can process
+   // 2 limbs with each instruction.
+   //
+   for (; i + 8 <= n; i += 8)
+   {
+      carry = _addcarry_u64(carry, *(unsigned long long*)(a + i + 0), *(unsigned long long*)(b + i + 0), (unsigned long long*)(r + i));
+      carry = _addcarry_u64(carry, *(unsigned long long*)(a + i + 2), *(unsigned long long*)(b + i + 2), (unsigned long long*)(r + i + 2));
+      carry = _addcarry_u64(carry, *(unsigned long long*)(a + i + 4), *(unsigned long long*)(b + i + 4), (unsigned long long*)(r + i + 4));
+      carry = _addcarry_u64(carry, *(unsigned long long*)(a + i + 6), *(unsigned long long*)(b + i + 6), (unsigned long long*)(r + i + 6));
+   }
+#else
+   for (; i + 4 <= n; i += 4)
+   {
+      carry = addcarry_limb(carry, a[i + 0], b[i + 0], r + i);
+      carry = addcarry_limb(carry, a[i + 1], b[i + 1], r + i + 1);
+      carry = addcarry_limb(carry, a[i + 2], b[i + 2], r + i + 2);
+      carry = addcarry_limb(carry, a[i + 3], b[i + 3], r + i + 3);
+   }
+#endif
+   for (; i < n; ++i)
+      carry = addcarry_limb(carry, a[i], b[i], r + i);
+   return carry;
+#else
+   double_limb_type carry = 0;
+   for (; i < n; ++i)
+   {
+      carry += static_cast<double_limb_type>(a[i]) + static_cast<double_limb_type>(b[i]);
+      r[i] = static_cast<limb_type>(carry);
+      carry >>= bits_per_limb;
+   }
+   return static_cast<limb_type>(carry);
+#endif
+}
+
+inline limb_type limb_sub_n(limb_type* r, const limb_type* a, const limb_type* b, std::size_t n) noexcept
+{
+   std::size_t i = 0;
+#ifdef BOOST_MP_HAS_IMMINTRIN_H
+   unsigned char borrow = 0;
+#if defined(BOOST_MSVC) && !defined(BOOST_HAS_INT128) && defined(_M_X64)
+   for (; i + 8 <= n; i += 8)
+   {
+      borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(a + i), *reinterpret_cast<const unsigned long long*>(b + i), reinterpret_cast<unsigned long long*>(r + i));
+      borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(a + i + 2), *reinterpret_cast<const unsigned long long*>(b + i + 2), reinterpret_cast<unsigned long long*>(r + i + 2));
+      borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(a + i + 4), *reinterpret_cast<const unsigned long long*>(b + i + 4), reinterpret_cast<unsigned long long*>(r + i + 4));
+      borrow = _subborrow_u64(borrow, *reinterpret_cast<const unsigned long long*>(a + i + 6), *reinterpret_cast<const unsigned long long*>(b + i + 6), reinterpret_cast<unsigned long long*>(r + i + 6));
+   }
+#else
+   for (; i + 4 <= n; i += 4)
+   {
+      borrow = subborrow_limb(borrow, a[i + 0], b[i + 0], r + i);
+      borrow = subborrow_limb(borrow, a[i + 1], b[i + 1], r + i + 1);
+      borrow = subborrow_limb(borrow, a[i + 2], b[i + 2], r + i + 2);
+      borrow = subborrow_limb(borrow, a[i + 3], b[i + 3], r + i + 3);
+   }
+#endif
+   for (; i < n; ++i)
+      borrow = subborrow_limb(borrow, a[i], b[i], r + i);
+   return borrow;
+#else
+   double_limb_type borrow = 0;
+   for (; i < n; ++i)
+   {
+      borrow = static_cast<double_limb_type>(a[i]) - static_cast<double_limb_type>(b[i]) - borrow;
+      r[i]   = static_cast<limb_type>(borrow);
+      borrow = (borrow >> bits_per_limb) & 1u;
+   }
+   return static_cast<limb_type>(borrow);
+#endif
+}
+
+//
+// Portable versions of the multiplying kernels, these also finish off whatever limbs are
+// left over by the unrolled assembly versions, hence the carry argument:
+//
+inline BOOST_MP_CXX14_CONSTEXPR limb_type limb_mul_1_generic(limb_type* r, const limb_type* a, std::size_t n, limb_type b, limb_type carry) noexcept
+{
+   double_limb_type t = carry;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      t += static_cast<double_limb_type>(a[i]) * static_cast<double_limb_type>(b);
+      r[i] = static_cast<limb_type>(t);
+      t >>= bits_per_limb;
+   }
+   return static_cast<limb_type>(t);
+}
+
+inline BOOST_MP_CXX14_CONSTEXPR limb_type limb_addmul_1_generic(limb_type* r, const limb_type* a, std::size_t n, limb_type b, limb_type carry) noexcept
+{
+   double_limb_type t = carry;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      t += static_cast<double_limb_type>(a[i]) * static_cast<double_limb_type>(b) + r[i];
+      r[i] = static_cast<limb_type>(t);
+      t >>= bits_per_limb;
+   }
+   return static_cast<limb_type>(t);
+}
+
+inline BOOST_MP_CXX14_CONSTEXPR limb_type limb_submul_1_generic(limb_type* r, const limb_type* a, std::size_t n, limb_type b, limb_type borrow) noexcept
+{
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      double_limb_type t  = static_cast<double_limb_type>(a[i]) * static_cast<double_limb_type>(b) + borrow;
+      limb_type        lo = static_cast<limb_type>(t);
+      borrow              = static_cast<limb_type>(t >> bits_per_limb);
+      if (r[i] < lo)
+         ++borrow;
+      r[i] -= lo;
+   }
+   return borrow;
+}
+
+inline BOOST_MP_CXX14_CONSTEXPR void limb_sqr_diag_addlsh1_generic(limb_type* r, const limb_type* a, std::size_t n) noexcept
+{
+   double_limb_type carry       = 0;
+   limb_type        shifted_out = 0;
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      double_limb_type sq = static_cast<double_limb_type>(a[i]) * static_cast<double_limb_type>(a[i]);
+      limb_type        lo = r[2 * i];
+      limb_type        hi = r[2 * i + 1];
+      carry += static_cast<double_limb_type>(static_cast<limb_type>(lo << 1u) | shifted_out) + static_cast<limb_type>(sq);
+      r[2 * i] = static_cast<limb_type>(carry);
+      carry >>= bits_per_limb;
+      carry += static_cast<double_limb_type>(static_cast<limb_type>(hi << 1u) | (lo >> (bits_per_limb - 1))) + static_cast<limb_type>(sq >> bits_per_limb);
+      r[2 * i + 1] = static_cast<limb_type>(carry);
+      carry >>= bits_per_limb;
+      shifted_out = hi >> (bits_per_limb - 1);
+   }
+   BOOST_MP_ASSERT((carry == 0) && (shifted_out == 0));
+}
+
+#ifdef BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+
+inline bool limb_kernels_use_adx() noexcept
+{
+   static const bool result = []() {
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("bmi2") && __builtin_cpu_supports("adx");
+   }();
+   return result;
+}
+//
+// The assembly versions process 4 limbs per iteration, blocks is n / 4 and must be non-zero.
+// mulx leaves the flags alone, so adcx carries the sum of the low halves of the products
+// with r, while adox carries the high halves into the next limb.  The loop counter is in
+// rcx as lea and jrcxz don't touch the flags either:
+//
+inline limb_type limb_mul_1_adx(limb_type*& r, const limb_type*& a, std::size_t blocks, limb_type b) noexcept
+{
+   limb_type hi = 0, t0, t1;
+   __asm__ volatile(
+       "xorl %k[t0], %k[t0]\n\t"
+       "1:\n\t"
+       "mulx (%[a]), %[t0], %[t1]\n\t"
+       "adcx %[hi], %[t0]\n\t"
+       "movq %[t0], (%[r])\n\t"
+       "mulx 8(%[a]), %[t0], %[hi]\n\t"
+       "adcx %[t1], %[t0]\n\t"
+       "movq %[t0], 8(%[r])\n\t"
+       "mulx 16(%[a]), %[t0], %[t1]\n\t"
+       "adcx %[hi], %[t0]\n\t"
+       "movq %[t0], 16(%[r])\n\t"
+       "mulx 24(%[a]), %[t0], %[hi]\n\t"
+       "adcx %[t1], %[t0]\n\t"
+       "movq %[t0], 24(%[r])\n\t"
+       "leaq 32(%[a]), %[a]\n\t"
+       "leaq 32(%[r]), %[r]\n\t"
+       "leaq -1(%[n]), %[n]\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       "movl $0, %k[t0]\n\t"
+       "adcx %[t0], %[hi]\n\t"
+       : [r] "+&r"(r), [a] "+&r"(a), [n] "+&c"(blocks), [hi] "+&r"(hi), [t0] "=&r"(t0), [t1] "=&r"(t1)
+       : "d"(b)
+       : "cc", "memory");
+   return hi;
+}
+
+inline limb_type limb_addmul_1_adx(limb_type*& r, const limb_type*& a, std::size_t blocks, limb_type b) noexcept
+{
+   limb_type hi = 0, t0, t1;
+   __asm__ volatile(
+       "xorl %k[t0], %k[t0]\n\t"
+       "1:\n\t"
+       "mulx (%[a]), %[t0], %[t1]\n\t"
+       "adcx (%[r]), %[t0]\n\t"
+       "adox %[hi], %[t0]\n\t"
+       "movq %[t0], (%[r])\n\t"
+       "mulx 8(%[a]), %[t0], %[hi]\n\t"
+       "adcx 8(%[r]), %[t0]\n\t"
+       "adox %[t1], %[t0]\n\t"
+       "movq %[t0], 8(%[r])\n\t"
+       "mulx 16(%[a]), %[t0], %[t1]\n\t"
+       "adcx 16(%[r]), %[t0]\n\t"
+       "adox %[hi], %[t0]\n\t"
+       "movq %[t0], 16(%[r])\n\t"
+       "mulx 24(%[a]), %[t0], %[hi]\n\t"
+       "adcx 24(%[r]), %[t0]\n\t"
+       "adox %[t1], %[t0]\n\t"
+       "movq %[t0], 24(%[r])\n\t"
+       "leaq 32(%[a]), %[a]\n\t"
+       "leaq 32(%[r]), %[r]\n\t"
+       "leaq -1(%[n]), %[n]\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       "movl $0, %k[t0]\n\t"
+       "adcx %[t0], %[hi]\n\t"
+       "adox %[t0], %[hi]\n\t"
+       : [r] "+&r"(r), [a] "+&r"(a), [n] "+&c"(blocks), [hi] "+&r"(hi), [t0] "=&r"(t0), [t1] "=&r"(t1)
+       : "d"(b)
+       : "cc", "memory");
+   return hi;
+}
+//
+// r - p is computed as ~(~r + p), the carry out of ~r + p being the borrow:
+//
+inline limb_type limb_submul_1_adx(limb_type*& r, const limb_type*& a, std::size_t blocks, limb_type b) noexcept
+{
+   limb_type hi = 0, t0, t1, t2;
+   __asm__ volatile(
+       "xorl %k[t0], %k[t0]\n\t"
+       "1:\n\t"
+       "mulx (%[a]), %[t0], %[t1]\n\t"
+       "movq (%[r]), %[t2]\n\t"
+       "notq %[t2]\n\t"
+       "adcx %[t2], %[t0]\n\t"
+       "adox %[hi], %[t0]\n\t"
+       "notq %[t0]\n\t"
+       "movq %[t0], (%[r])\n\t"
+       "mulx 8(%[a]), %[t0], %[hi]\n\t"
+       "movq 8(%[r]), %[t2]\n\t"
+       "notq %[t2]\n\t"
+       "adcx %[t2], %[t0]\n\t"
+       "adox %[t1], %[t0]\n\t"
+       "notq %[t0]\n\t"
+       "movq %[t0], 8(%[r])\n\t"
+       "mulx 16(%[a]), %[t0], %[t1]\n\t"
+       "movq 16(%[r]), %[t2]\n\t"
+       "notq %[t2]\n\t"
+       "adcx %[t2], %[t0]\n\t"
+       "adox %[hi], %[t0]\n\t"
+       "notq %[t0]\n\t"
+       "movq %[t0], 16(%[r])\n\t"
+       "mulx 24(%[a]), %[t0], %[hi]\n\t"
+       "movq 24(%[r]), %[t2]\n\t"
+       "notq %[t2]\n\t"
+       "adcx %[t2], %[t0]\n\t"
+       "adox %[t1], %[t0]\n\t"
+       "notq %[t0]\n\t"
+       "movq %[t0], 24(%[r])\n\t"
+       "leaq 32(%[a]), %[a]\n\t"
+       "leaq 32(%[r]), %[r]\n\t"
+       "leaq -1(%[n]), %[n]\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       "movl $0, %k[t0]\n\t"
+       "adcx %[t0], %[hi]\n\t"
+       "adox %[t0], %[hi]\n\t"
+       : [r] "+&r"(r), [a] "+&r"(a), [n] "+&c"(blocks), [hi] "+&r"(hi), [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2)
+       : "d"(b)
+       : "cc", "memory");
+   return hi;
+}
+//
+// Here adcx doubles r one limb at a time, and adox adds in the squares, n must be non-zero:
+//
+inline void limb_sqr_diag_addlsh1_adx(limb_type* r, const limb_type* a, std::size_t n) noexcept
+{
+   limb_type t0, t1, t2, d;
+   __asm__ volatile(
+       "xorl %k[t0], %k[t0]\n\t"
+       "1:\n\t"
+       "movq (%[a]), %[d]\n\t"
+       "mulx %[d], %[t0], %[t1]\n\t"
+       "movq (%[r]), %[t2]\n\t"
+       "adcx %[t2], %[t2]\n\t"
+       "adox %[t0], %[t2]\n\t"
+       "movq %[t2], (%[r])\n\t"
+       "movq 8(%[r]), %[t2]\n\t"
+       "adcx %[t2], %[t2]\n\t"
+       "adox %[t1], %[t2]\n\t"
+       "movq %[t2], 8(%[r])\n\t"
+       "leaq 8(%[a]), %[a]\n\t"
+       "leaq 16(%[r]), %[r]\n\t"
+       "leaq -1(%[n]), %[n]\n\t"
+       "jrcxz 2f\n\t"
+       "jmp 1b\n"
+       "2:\n\t"
+       : [r] "+&r"(r), [a] "+&r"(a), [n] "+&c"(n), [t0] "=&r"(t0), [t1] "=&r"(t1), [t2] "=&r"(t2), [d] "=&d"(d)
+       :
+       : "cc", "memory");
+}
+
+#endif
+
+inline limb_type limb_mul_1(limb_type* r, const limb_type* a, std::size_t n, limb_type b) noexcept
+{
+   limb_type carry = 0;
+#ifdef BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+   if ((n >= 4) && limb_kernels_use_adx())
+   {
+      carry = limb_mul_1_adx(r, a, n / 4, b);
+      n %= 4;
+   }
+#endif
+   return limb_mul_1_generic(r, a, n, b, carry);
+}
+
+inline limb_type limb_addmul_1(limb_type* r, const limb_type* a, std::size_t n, limb_type b) noexcept
+{
+   limb_type carry = 0;
+#ifdef BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+   if ((n >= 4) && limb_kernels_use_adx())
+   {
+      carry = limb_addmul_1_adx(r, a, n / 4, b);
+      n %= 4;
+   }
+#endif
+   return limb_addmul_1_generic(r, a, n, b, carry);
+}
+
+inline limb_type limb_submul_1(limb_type* r, const limb_type* a, std::size_t n, limb_type b) noexcept
+{
+   limb_type borrow = 0;
+#ifdef BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+   if ((n >= 4) && limb_kernels_use_adx())
+   {
+      borrow = limb_submul_1_adx(r, a, n / 4, b);
+      n %= 4;
+   }
+#endif
+   return limb_submul_1_generic(r, a, n, b, borrow);
+}
+
+inline void limb_sqr_diag_addlsh1(limb_type* r, const limb_type* a, std::size_t n) noexcept
+{
+#ifdef BOOST_MP_CPP_INT_HAS_ADX_DISPATCH
+   if (n && limb_kernels_use_adx())
+   {
+      limb_sqr_diag_addlsh1_adx(r, a, n);
+      return;
+   }
+#endif
+   limb_sqr_diag_addlsh1_generic(r, a, n);
+}
+
+}}} // namespace boost::multiprecision::detail
+
+#endif
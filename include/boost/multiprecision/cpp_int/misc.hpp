@@ -20,6 +20,7 @@
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/detail/number_base.hpp>
 #include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/uniform_int_distribution.hpp>
 
 #ifndef BOOST_MP_STANDALONE
 #include <boost/integer/common_factor_rt.hpp>
@@ -1417,6 +1418,19 @@ inline BOOST_MP_CXX14_CONSTEXPR std::size_t hash_value(const cpp_int_backend<Min
    return result;
 }
 
+//
+// Limb filling for uniform_int_distribution, range is positive:
+//
+template <class Engine, std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline void eval_uniform_int(boost::multiprecision::detail::uniform_limb_source<Engine>& src, cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& result, const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& range)
+{
+   const std::size_t n = range.size();
+   result.resize(n, n);
+   boost::multiprecision::detail::generate_uniform_limbs(src, result.limbs(), range.limbs(), n);
+   result.sign(false);
+   result.normalize();
+}
+
 #ifdef BOOST_MSVC
 #pragma warning(pop)
 #endif
@@ -0,0 +1,432 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   https://www.boost.org/LICENSE_1_0.txt)
+//
+// Montgomery reduction and modular exponentiation for cpp_int_backend:
+//
+#ifndef BOOST_MP_CPP_INT_MONTGOMERY_HPP
+#define BOOST_MP_CPP_INT_MONTGOMERY_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/constexpr.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+#ifdef BOOST_MSVC
+#pragma warning(push)
+#pragma warning(disable : 4127) // conditional expression is constant
+#endif
+//
+// Minimum number of limbs in the modulus before powm switches to Montgomery
+// multiplication.  Below this the setup cost (one full division to obtain R^2 mod n)
+// isn't recovered, and single limb moduli already take a fast division path:
+//
+#ifdef BOOST_MP_MONTGOMERY_CUTOFF
+constexpr std::size_t montgomery_cutoff = BOOST_MP_MONTGOMERY_CUTOFF;
+#else
+constexpr std::size_t montgomery_cutoff = 2;
+#endif
+//
+// Returns -n^-1 mod 2^bits_per_limb for odd n.
+// Since n * n == 1 mod 8 for all odd n, n is its own inverse to 3 bits, and
+// each Newton step x = x * (2 - n * x) doubles the number of correct bits:
+//
+inline BOOST_MP_CXX14_CONSTEXPR limb_type montgomery_inverse(limb_type n) noexcept
+{
+   BOOST_MP_ASSERT(n & 1u);
+   limb_type x = n;
+   for (std::size_t bits = 3; bits < bits_per_limb; bits *= 2)
+      x = static_cast<limb_type>(x * static_cast<limb_type>(static_cast<limb_type>(2u) - static_cast<limb_type>(n * x)));
+   return static_cast<limb_type>(static_cast<limb_type>(0u) - x);
+}
+//
+// Window size for sliding window exponentiation, chosen from the number of bits
+// in the exponent so that the cost of the table of odd powers is balanced against
+// the number of multiplications saved:
+//
+inline BOOST_MP_CXX14_CONSTEXPR std::size_t montgomery_window_bits(std::size_t exponent_bits) noexcept
+{
+   return exponent_bits <= 7 ? 1 : exponent_bits <= 25 ? 2 : exponent_bits <= 81 ? 3 : exponent_bits <= 241 ? 4 : exponent_bits <= 673 ? 5 : 6;
+}
+//
+// The reduction engine: holds an odd modulus n of k limbs, along with the precomputed
+// values -n^-1 mod 2^bits_per_limb, R mod n and R^2 mod n where R = 2^(k * bits_per_limb).
+// Values in "Montgomery form" are stored as aR mod n, and the product of two such values
+// is reduced with REDC, which requires only multiplications and shifts.
+//
+// All the work is done in the variable precision type below: fixed precision arguments
+// get converted on entry, that way intermediate products never overflow and
+// we keep the number of template instantiations down.
+//
+class montgomery_engine
+{
+ public:
+   using backend_type = cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> >;
+
+   template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator>
+   explicit montgomery_engine(const cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>& m)
+      : m_modulus(m)
+   {
+      using default_ops::eval_get_sign;
+      if ((eval_get_sign(m_modulus) <= 0) || !(m_modulus.limbs()[0] & 1u) || ((m_modulus.size() == 1) && (m_modulus.limbs()[0] == 1u)))
+      {
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("Montgomery reduction requires an odd modulus greater than one."));
+      }
+      m_inverse = montgomery_inverse(m_modulus.limbs()[0]);
+      //
+      // R mod n, which is also the value 1 in Montgomery form:
+      //
+      backend_type t(static_cast<limb_type>(1u));
+      eval_left_shift(t, m_modulus.size() * bits_per_limb);
+      eval_modulus(m_one, t, m_modulus);
+      //
+      // R^2 mod n, used for conversion into Montgomery form:
+      //
+      eval_multiply(t, m_one, m_one);
+      eval_modulus(m_r2, t, m_modulus);
+   }
+
+   const backend_type& modulus() const noexcept { return m_modulus; }
+   const backend_type& one() const noexcept { return m_one; }
+   //
+   // REDC: sets r = t * R^-1 mod n, where t < nR.  t is used as scratch space and is destroyed:
+   //
+   void reduce(backend_type& r, backend_type& t) const
+   {
+      std::size_t n  = m_modulus.size();
+      std::size_t ts = t.size();
+      BOOST_MP_ASSERT(ts <= 2 * n);
+      BOOST_MP_ASSERT(!t.sign());
+      t.resize(2 * n + 1, 2 * n + 1);
+      backend_type::limb_pointer       pt = t.limbs();
+      backend_type::const_limb_pointer pn = m_modulus.limbs();
+      for (std::size_t i = ts; i < 2 * n + 1; ++i)
+         pt[i] = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         //
+         // Add a multiple of n which clears limb i:
+         //
+         limb_type        m     = static_cast<limb_type>(pt[i] * m_inverse);
+         double_limb_type carry = ::boost::multiprecision::detail::limb_addmul_1(pt + i, pn, n, m);
+         for (std::size_t k = i + n; carry; ++k)
+         {
+            BOOST_MP_ASSERT(k < 2 * n + 1);
+            carry += pt[k];
+            pt[k] = static_cast<limb_type>(carry);
+            carry >>= bits_per_limb;
+         }
+      }
+      //
+      // The low n limbs are now all zero, the result is the high part, which is less than 2n:
+      //
+      r.resize(n + 1, n + 1);
+      std::memcpy(r.limbs(), pt + n, (n + 1) * sizeof(limb_type));
+      r.sign(false);
+      r.normalize();
+      if (r.compare_unsigned(m_modulus) >= 0)
+         subtract_unsigned(r, r, m_modulus);
+   }
+   //
+   // Montgomery product r = abR^-1 mod n, a and b must both be fully reduced,
+   // r may alias either a or b but not workspace:
+   //
+   void multiply(backend_type& r, const backend_type& a, const backend_type& b, backend_type& workspace) const
+   {
+      eval_multiply(workspace, a, b);
+      reduce(r, workspace);
+   }
+   //
+   // Reduces a into [0, n) - negative values are mapped to their positive residue:
+   //
+   void canonicalize(backend_type& r, const backend_type& a) const
+   {
+      if (a.sign() || (a.compare_unsigned(m_modulus) >= 0))
+      {
+         eval_modulus(r, a, m_modulus);
+         if (r.sign())
+            eval_add(r, m_modulus);
+      }
+      else
+         r = a;
+   }
+   void to_montgomery(backend_type& r, const backend_type& a, backend_type& workspace) const
+   {
+      canonicalize(r, a);
+      multiply(r, r, m_r2, workspace);
+   }
+   void from_montgomery(backend_type& r, const backend_type& a, backend_type& workspace) const
+   {
+      workspace = a;
+      reduce(r, workspace);
+   }
+   //
+   // Sets result = base^exponent mod n, with base and result in normal (not Montgomery) form.
+   // Uses left-to-right sliding window exponentiation over a table of odd powers of base:
+   //
+   void powm(backend_type& result, const backend_type& base, const backend_type& exponent) const
+   {
+      using default_ops::eval_bit_test;
+      using default_ops::eval_is_zero;
+      using default_ops::eval_msb;
+
+      BOOST_MP_ASSERT(!exponent.sign());
+
+      if (eval_is_zero(exponent))
+      {
+         result = static_cast<limb_type>(1u);
+         return;
+      }
+      constexpr std::size_t max_window = 6;
+      backend_type          workspace, x, table[static_cast<std::size_t>(1u) << (max_window - 1)];
+
+      std::size_t bits       = eval_msb(exponent) + 1;
+      std::size_t window     = montgomery_window_bits(bits);
+      std::size_t table_size = static_cast<std::size_t>(1u) << (window - 1);
+      BOOST_MP_ASSERT(window <= max_window);
+      //
+      // table[i] = base^(2i+1) in Montgomery form:
+      //
+      to_montgomery(table[0], base, workspace);
+      if (table_size > 1)
+      {
+         multiply(x, table[0], table[0], workspace);
+         for (std::size_t i = 1; i < table_size; ++i)
+            multiply(table[i], table[i - 1], x, workspace);
+      }
+
+      bool           started = false;
+      std::ptrdiff_t i       = static_cast<std::ptrdiff_t>(bits) - 1;
+      while (i >= 0)
+      {
+         if (!eval_bit_test(exponent, static_cast<std::size_t>(i)))
+         {
+            multiply(x, x, x, workspace);
+            --i;
+            continue;
+         }
+         //
+         // Find the longest window ending in a 1 bit:
+         //
+         std::ptrdiff_t low = (std::max)(i - static_cast<std::ptrdiff_t>(window) + 1, static_cast<std::ptrdiff_t>(0));
+         while (!eval_bit_test(exponent, static_cast<std::size_t>(low)))
+            ++low;
+         std::size_t w = 0;
+         for (std::ptrdiff_t j = i; j >= low; --j)
+         {
+            w = (w << 1) | (eval_bit_test(exponent, static_cast<std::size_t>(j)) ? 1u : 0u);
+            if (started)
+               multiply(x, x, x, workspace);
+         }
+         if (started)
+            multiply(x, x, table[w >> 1], workspace);
+         else
+         {
+            // The leading window needs no squarings as the accumulator is one:
+            x       = table[w >> 1];
+            started = true;
+         }
+         i = low - 1;
+      }
+      from_montgomery(result, x, workspace);
+   }
+
+ private:
+   backend_type m_modulus, m_one, m_r2;
+   limb_type    m_inverse;
+};
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline BOOST_MP_CXX14_CONSTEXPR bool use_montgomery_powm(const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a, const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c) noexcept
+{
+   //
+   // Montgomery form is only used when the modulus is odd and positive, we also
+   // require a positive base so that the sign of the result is the same as the generic code:
+   //
+   return !a.sign() && !c.sign() && (c.size() >= montgomery_cutoff) && (c.limbs()[0] & 1u);
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+void eval_powm_montgomery_imp(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const montgomery_engine::backend_type&                                      p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   using backend_type = montgomery_engine::backend_type;
+   montgomery_engine engine(c);
+   backend_type      r;
+   engine.powm(r, backend_type(a.limbs(), 0, a.size()), p);
+   result = r;
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+void eval_powm_montgomery(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   if (p.sign())
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+   }
+   eval_powm_montgomery_imp(result, a, montgomery_engine::backend_type(p.limbs(), 0, p.size()), c);
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, class Integer>
+typename std::enable_if<boost::multiprecision::detail::is_unsigned<Integer>::value>::type eval_powm_montgomery(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    Integer                                                                     p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   montgomery_engine::backend_type e;
+   e = static_cast<typename boost::multiprecision::detail::canonical<Integer, montgomery_engine::backend_type>::type>(p);
+   eval_powm_montgomery_imp(result, a, e, c);
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_powm(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   std::size_t cs = c.size();
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(cs) && use_montgomery_powm(a, c))
+#else
+   if (use_montgomery_powm(a, c))
+#endif
+   {
+      eval_powm_montgomery(result, a, p, c);
+   }
+   else
+      default_ops::eval_powm(result, a, p, c);
+   (void)cs;
+}
+
+template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, class Integer>
+inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<boost::multiprecision::detail::is_unsigned<Integer>::value && !is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value>::type
+eval_powm(
+    cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>&       result,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& a,
+    Integer                                                                     p,
+    const cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>& c)
+{
+   std::size_t cs = c.size();
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(cs) && use_montgomery_powm(a, c))
+#else
+   if (use_montgomery_powm(a, c))
+#endif
+   {
+      eval_powm_montgomery(result, a, p, c);
+   }
+   else
+      default_ops::eval_powm(result, a, p, c);
+   (void)cs;
+}
+
+#ifdef BOOST_MSVC
+#pragma warning(pop)
+#endif
+
+} // namespace backends
+
+//
+// Public interface: a reusable Montgomery context for a fixed odd modulus.
+//
+template <class Number>
+class montgomery_context;
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class montgomery_context<number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> >
+{
+   using engine_type  = backends::montgomery_engine;
+   using backend_type = typename engine_type::backend_type;
+
+ public:
+   using number_type = number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates>;
+
+   explicit montgomery_context(const number_type& m) : m_engine(m.backend()) {}
+
+   number_type modulus() const
+   {
+      return convert(m_engine.modulus());
+   }
+   //
+   // Returns b^p mod m, b may be any value, the result is always in [0, m):
+   //
+   number_type powm(const number_type& b, const number_type& p) const
+   {
+      if (p.sign() < 0)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+      }
+      backend_type r;
+      m_engine.powm(r, backend_type(b.backend()), backend_type(p.backend()));
+      return convert(r);
+   }
+   template <class Integer>
+   typename std::enable_if<boost::multiprecision::detail::is_integral<Integer>::value, number_type>::type powm(const number_type& b, Integer p) const
+   {
+      if (p < 0)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("powm requires a positive exponent."));
+      }
+      backend_type r, e;
+      using ui_type = typename boost::multiprecision::detail::make_unsigned<Integer>::type;
+      e = static_cast<typename boost::multiprecision::detail::canonical<ui_type, backend_type>::type>(static_cast<ui_type>(p));
+      m_engine.powm(r, backend_type(b.backend()), e);
+      return convert(r);
+   }
+   //
+   // Conversion to and from Montgomery form, and multiplication of values already in Montgomery form:
+   //
+   number_type to_montgomery(const number_type& a) const
+   {
+      backend_type r, workspace;
+      m_engine.to_montgomery(r, backend_type(a.backend()), workspace);
+      return convert(r);
+   }
+   number_type from_montgomery(const number_type& a) const
+   {
+      backend_type r, workspace, t;
+      m_engine.canonicalize(t, backend_type(a.backend()));
+      m_engine.from_montgomery(r, t, workspace);
+      return convert(r);
+   }
+   number_type multiply(const number_type& a, const number_type& b) const
+   {
+      backend_type r, workspace, ta, tb;
+      m_engine.canonicalize(ta, backend_type(a.backend()));
+      m_engine.canonicalize(tb, backend_type(b.backend()));
+      m_engine.multiply(r, ta, tb, workspace);
+      return convert(r);
+   }
+
+ private:
+   static number_type convert(const backend_type& val)
+   {
+      number_type result;
+      result.backend() = val;
+      return result;
+   }
+
+   engine_type m_engine;
+};
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -15,6 +15,8 @@
 #include <boost/multiprecision/detail/endian.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/integer.hpp>
+#include <boost/multiprecision/cpp_int/ntt.hpp>
+#include <boost/multiprecision/cpp_int/limb_kernels.hpp>
 
 namespace boost { namespace multiprecision { namespace backends {
 
@@ -43,6 +45,13 @@ eval_multiply(
    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer       p     = result.limbs();
    typename cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1>::limb_pointer       pe    = result.limbs() + result.size();
    typename cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2>::const_limb_pointer pa    = a.limbs();
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(val))
+   {
+      carry = ::boost::multiprecision::detail::limb_mul_1(p, pa, static_cast<std::size_t>(pe - p), val);
+      p     = pe;
+   }
+#endif
    while (p != pe)
    {
       carry += static_cast<double_limb_type>(*pa) * static_cast<double_limb_type>(val);
@@ -89,6 +98,32 @@ const size_t karatsuba_cutoff = BOOST_MP_KARATSUBA_CUTOFF;
 const size_t karatsuba_cutoff = 40;
 #endif
 //
+// Minimum number of limbs in both arguments before Toom-Cook 3-way and 4-way
+// multiplication, and then the number theoretic transform take over:
+//
+#ifdef BOOST_MP_TOOM3_CUTOFF
+const size_t toom3_cutoff = BOOST_MP_TOOM3_CUTOFF;
+#else
+const size_t toom3_cutoff = 250;
+#endif
+#ifdef BOOST_MP_TOOM4_CUTOFF
+const size_t toom4_cutoff = BOOST_MP_TOOM4_CUTOFF;
+#else
+const size_t toom4_cutoff = 2000;
+#endif
+#ifdef BOOST_MP_NTT_CUTOFF
+const size_t ntt_cutoff = BOOST_MP_NTT_CUTOFF;
+#else
+const size_t ntt_cutoff = 30000;
+#endif
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+void multiply_recursive(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage);
+//
 // Core (recursive) Karatsuba multiplication, all the storage required is allocated upfront and 
 // passed down the stack in this routine.  Note that all the cpp_int_backend's must be the same type
 // and full variable precision.  Karatsuba really doesn't play nice with fixed-size integers.  If necessary
@@ -106,6 +141,10 @@ inline void multiply_karatsuba(
    std::size_t as = a.size();
    std::size_t bs = b.size();
    //
+   // Squaring needs only 3 half sized squares, which are cheaper than general products:
+   //
+   const bool is_square = (a.limbs() == b.limbs()) && (as == bs);
+   //
    // Termination condition: if either argument is smaller than karatsuba_cutoff
    // then schoolboy multiplication will be faster:
    //
@@ -167,7 +206,7 @@ inline void multiply_karatsuba(
    //
    // low part of result is a_l * b_l:
    //
-   multiply_karatsuba(result_low, a_l, b_l, storage);
+   multiply_recursive(result_low, a_l, b_l, storage);
    //
    // We haven't zeroed out memory in result, so set to zero any unused limbs,
    // if a_l and b_l have mostly random bits then nothing happens here, but if
@@ -180,15 +219,20 @@ inline void multiply_karatsuba(
    //
    // Set the high part of result to a_h * b_h:
    //
-   multiply_karatsuba(result_high, a_h, b_h, storage);
+   multiply_recursive(result_high, a_h, b_h, storage);
    for (std::size_t i = result_high.size() + 2 * n; i < result.size(); ++i)
       result.limbs()[i] = 0;
    //
-   // Now calculate (a_h+a_l)*(b_h+b_l):
+   // Now calculate (a_h+a_l)*(b_h+b_l), which when squaring is also a square:
    //
    add_unsigned(t2, a_l, a_h);
-   add_unsigned(t3, b_l, b_h);
-   multiply_karatsuba(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   if (is_square)
+      multiply_recursive(t1, t2, t2, storage); // t1 = (a_h+a_l)^2
+   else
+   {
+      add_unsigned(t3, b_l, b_h);
+      multiply_recursive(t1, t2, t3, storage); // t1 = (a_h+a_l)*(b_h+b_l)
+   }
    //
    // There is now a slight deviation from Karatsuba, we want to subtract
    // a_l*b_l + a_h*b_h from t1, but rather than use an addition and a subtraction
@@ -214,19 +258,420 @@ inline void multiply_karatsuba(
    result.normalize();
 }
 
+//
+// Helpers for Toom-Cook multiplication, all operate on the magnitude only and leave the sign unchanged.
+// Exact division by a small odd divisor, using multiplication by the inverse of d mod 2^bits_per_limb:
+//
+template <class CppInt>
+inline void toom_divide_exact(CppInt& r, limb_type d)
+{
+   BOOST_MP_ASSERT(d & 1u);
+   // Newton iteration, each step doubles the number of correct low bits:
+   limb_type inv = d;
+   for (std::size_t bits = 3; bits < bits_per_limb; bits *= 2)
+      inv = static_cast<limb_type>(inv * static_cast<limb_type>(static_cast<limb_type>(2u) - static_cast<limb_type>(d * inv)));
+   typename CppInt::limb_pointer pr     = r.limbs();
+   limb_type                     borrow = 0;
+   for (std::size_t i = 0; i < r.size(); ++i)
+   {
+      limb_type s = static_cast<limb_type>(pr[i] - borrow);
+      limb_type c = pr[i] < borrow ? 1u : 0u;
+      limb_type q = static_cast<limb_type>(s * inv);
+      pr[i]       = q;
+      borrow      = static_cast<limb_type>((static_cast<double_limb_type>(q) * d) >> bits_per_limb) + c;
+   }
+   BOOST_MP_ASSERT(borrow == 0);
+   r.normalize();
+   r.sign(r.sign()); // no negative zero
+}
+template <class CppInt>
+inline void toom_shift_right(CppInt& r, unsigned bits)
+{
+   BOOST_MP_ASSERT(bits && (bits < bits_per_limb));
+   BOOST_MP_ASSERT((r.limbs()[0] & ((static_cast<limb_type>(1u) << bits) - 1)) == 0);
+   typename CppInt::limb_pointer pr = r.limbs();
+   std::size_t                   n  = r.size();
+   for (std::size_t i = 0; i + 1 < n; ++i)
+      pr[i] = (pr[i] >> bits) | static_cast<limb_type>(pr[i + 1] << (bits_per_limb - bits));
+   pr[n - 1] >>= bits;
+   r.normalize();
+   r.sign(r.sign());
+}
+template <class CppInt>
+inline void toom_shift_left(CppInt& r, unsigned bits)
+{
+   BOOST_MP_ASSERT(bits && (bits < bits_per_limb));
+   std::size_t n = r.size();
+   limb_type   carry = r.limbs()[n - 1] >> (bits_per_limb - bits);
+   if (carry)
+      r.resize(n + 1, n + 1);
+   typename CppInt::limb_pointer pr = r.limbs();
+   if (carry)
+      pr[n] = carry;
+   for (std::size_t i = n - 1; i > 0; --i)
+      pr[i] = static_cast<limb_type>(pr[i] << bits) | (pr[i - 1] >> (bits_per_limb - bits));
+   pr[0] = static_cast<limb_type>(pr[0] << bits);
+}
+//
+// Returns an alias for limbs [offset, offset + len) of a, or zero when offset is beyond the end of a:
+//
+template <class CppInt>
+inline CppInt toom_part(const CppInt& a, std::size_t offset, std::size_t len, const limb_type* zero)
+{
+   CppInt r(offset < a.size() ? a.limbs() + offset : zero, 0, offset < a.size() ? (std::min)(len, a.size() - offset) : 1);
+   r.normalize();
+   return r;
+}
+//
+// Adds the coefficient c to result at the given limb offset, the total always fits
+// in result so there is never a carry out of the top:
+//
+template <class CppInt>
+inline void toom_accumulate(CppInt& result, const CppInt& c, std::size_t offset)
+{
+   BOOST_MP_ASSERT(!c.sign());
+   CppInt result_alias(result.limbs(), offset, result.size() - offset);
+   add_unsigned(result_alias, result_alias, c);
+}
+template <class CppInt>
+inline void toom_multiply(CppInt& result, const CppInt& a, const CppInt& b, typename CppInt::scoped_shared_storage& storage)
+{
+   result.resize(a.size() + b.size(), a.size() + b.size());
+   multiply_recursive(result, a, b, storage);
+}
+//
+// Toom-Cook 3-way multiplication: a and b are split into 3 parts each, and evaluated as
+// polynomials at 0, 1, -1, -2 and infinity; after the 5 pointwise products the result is
+// interpolated using the sequence due to Bodrato.  Storage requirements are as for
+// Karatsuba: all temporaries alias memory in storage, and result must have at least
+// a.size() + b.size() limbs.
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline void multiply_toom3(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   using cpp_int_type = cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>;
+
+   std::size_t as = a.size();
+   std::size_t bs = b.size();
+   std::size_t n  = ((std::max)(as, bs) + 2) / 3;
+   BOOST_MP_ASSERT(result.size() >= as + bs);
+   BOOST_MP_ASSERT((as > 2 * n) && (bs > 2 * n));
+
+   limb_type          zero = 0;
+   const cpp_int_type a0 = toom_part(a, 0, n, &zero), a1 = toom_part(a, n, n, &zero), a2 = toom_part(a, 2 * n, as, &zero);
+   const cpp_int_type b0 = toom_part(b, 0, n, &zero), b1 = toom_part(b, n, n, &zero), b2 = toom_part(b, 2 * n, bs, &zero);
+   //
+   // Evaluation points are at most n + 1 limbs, and products at most 2n + 2, with a little
+   // extra room for the interpolation:
+   //
+   cpp_int_type ea1(storage, n + 2), eam1(storage, n + 2), eam2(storage, n + 2);
+   cpp_int_type eb1(storage, n + 2), ebm1(storage, n + 2), ebm2(storage, n + 2);
+   cpp_int_type r1(storage, 2 * n + 5), rm1(storage, 2 * n + 5), rm2(storage, 2 * n + 5);
+   //
+   // p(1) = p0 + p1 + p2, p(-1) = p0 - p1 + p2, p(-2) = (p(-1) + p2) * 2 - p0:
+   //
+   eval_add(eam1, a0, a2);
+   eval_add(ea1, eam1, a1);
+   eval_subtract(eam1, a1);
+   eval_add(eam2, eam1, a2);
+   eval_left_shift(eam2, 1);
+   eval_subtract(eam2, a0);
+
+   const bool is_square = (a.limbs() == b.limbs()) && (as == bs);
+   if (!is_square)
+   {
+      eval_add(ebm1, b0, b2);
+      eval_add(eb1, ebm1, b1);
+      eval_subtract(ebm1, b1);
+      eval_add(ebm2, ebm1, b2);
+      eval_left_shift(ebm2, 1);
+      eval_subtract(ebm2, b0);
+   }
+   toom_multiply(r1, ea1, is_square ? ea1 : eb1, storage);
+   toom_multiply(rm1, eam1, is_square ? eam1 : ebm1, storage);
+   toom_multiply(rm2, eam2, is_square ? eam2 : ebm2, storage);
+   //
+   // The products at 0 and infinity go straight into the low and high parts of result:
+   //
+   cpp_int_type r0(result.limbs(), 0, 2 * n);
+   cpp_int_type rinf(result.limbs(), 4 * n, result.size() - 4 * n);
+   multiply_recursive(r0, a0, b0, storage);
+   for (std::size_t i = r0.size(); i < 4 * n; ++i)
+      result.limbs()[i] = 0;
+   multiply_recursive(rinf, a2, b2, storage);
+   for (std::size_t i = rinf.size() + 4 * n; i < result.size(); ++i)
+      result.limbs()[i] = 0;
+   //
+   // Interpolate, leaving the coefficients of x^1, x^2 and x^3 in r1, rm1 and rm2:
+   //
+   eval_subtract(rm2, r1);
+   toom_divide_exact(rm2, 3u); // (r(-2) - r(1)) / 3
+   eval_subtract(r1, rm1);
+   toom_shift_right(r1, 1u);   // (r(1) - r(-1)) / 2
+   eval_subtract(rm1, r0);     // r(-1) - r(0)
+   eval_subtract(rm2, rm1);
+   rm2.negate();
+   toom_shift_right(rm2, 1u);
+   eval_add(rm2, rinf);
+   eval_add(rm2, rinf);
+   eval_add(rm1, r1);
+   eval_subtract(rm1, rinf);
+   eval_subtract(r1, rm2);
+
+   toom_accumulate(result, r1, n);
+   toom_accumulate(result, rm1, 2 * n);
+   toom_accumulate(result, rm2, 3 * n);
+
+   storage.deallocate(6 * (n + 2) + 3 * (2 * n + 5));
+   result.normalize();
+}
+//
+// Toom-Cook 4-way multiplication: evaluation at 0, 1, -1, 2, -2, 1/2 and infinity,
+// the value at 1/2 is scaled by 8 in each argument to keep it integral.  With c0..c6
+// the coefficients of the result, the interpolation proceeds via the even and odd
+// parts of the values at +-1 and +-2, and uses exact division by 3 and 5 only.
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline void multiply_toom4(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   using cpp_int_type = cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>;
+
+   std::size_t as = a.size();
+   std::size_t bs = b.size();
+   std::size_t n  = ((std::max)(as, bs) + 3) / 4;
+   BOOST_MP_ASSERT(result.size() >= as + bs);
+   BOOST_MP_ASSERT((as > 3 * n) && (bs > 3 * n));
+
+   limb_type          zero = 0;
+   const cpp_int_type a0 = toom_part(a, 0, n, &zero), a1 = toom_part(a, n, n, &zero), a2 = toom_part(a, 2 * n, n, &zero), a3 = toom_part(a, 3 * n, as, &zero);
+   const cpp_int_type b0 = toom_part(b, 0, n, &zero), b1 = toom_part(b, n, n, &zero), b2 = toom_part(b, 2 * n, n, &zero), b3 = toom_part(b, 3 * n, bs, &zero);
+
+   cpp_int_type ea[5] = {cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2)};
+   cpp_int_type eb[5] = {cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2), cpp_int_type(storage, n + 2)};
+   cpp_int_type p1(storage, 2 * n + 5), m1(storage, 2 * n + 5), p2(storage, 2 * n + 5), m2(storage, 2 * n + 5), h(storage, 2 * n + 5), t(storage, 2 * n + 5);
+   //
+   // Sets e[0..4] to the values at 1, -1, 2, -2 and 8 times the value at 1/2:
+   //
+   const cpp_int_type* parts[2][4] = {{&a0, &a1, &a2, &a3}, {&b0, &b1, &b2, &b3}};
+   cpp_int_type*       evals[2]    = {ea, eb};
+   const bool          is_square   = (a.limbs() == b.limbs()) && (as == bs);
+   for (unsigned k = 0; k < (is_square ? 1u : 2u); ++k)
+   {
+      const cpp_int_type* const* x = parts[k];
+      cpp_int_type*              e = evals[k];
+      eval_add(e[1], *x[0], *x[2]);
+      eval_add(e[4], *x[1], *x[3]);
+      eval_add(e[0], e[1], e[4]);
+      eval_subtract(e[1], e[4]);
+      e[3] = *x[2];
+      toom_shift_left(e[3], 2u);
+      eval_add(e[3], *x[0]);
+      e[4] = *x[3];
+      toom_shift_left(e[4], 2u);
+      eval_add(e[4], *x[1]);
+      toom_shift_left(e[4], 1u);
+      eval_add(e[2], e[3], e[4]);
+      eval_subtract(e[3], e[4]);
+      e[4] = *x[0];
+      toom_shift_left(e[4], 1u);
+      eval_add(e[4], *x[1]);
+      toom_shift_left(e[4], 1u);
+      eval_add(e[4], *x[2]);
+      toom_shift_left(e[4], 1u);
+      eval_add(e[4], *x[3]);
+   }
+   const cpp_int_type* eb_used = is_square ? ea : eb;
+   toom_multiply(p1, ea[0], eb_used[0], storage);
+   toom_multiply(m1, ea[1], eb_used[1], storage);
+   toom_multiply(p2, ea[2], eb_used[2], storage);
+   toom_multiply(m2, ea[3], eb_used[3], storage);
+   toom_multiply(h, ea[4], eb_used[4], storage);
+
+   cpp_int_type c0(result.limbs(), 0, 2 * n);
+   cpp_int_type c6(result.limbs(), 6 * n, result.size() - 6 * n);
+   multiply_recursive(c0, a0, b0, storage);
+   for (std::size_t i = c0.size(); i < 6 * n; ++i)
+      result.limbs()[i] = 0;
+   multiply_recursive(c6, a3, b3, storage);
+   for (std::size_t i = c6.size() + 6 * n; i < result.size(); ++i)
+      result.limbs()[i] = 0;
+   //
+   // Odd and even parts: t = O1 = c1 + c3 + c5, p1 = E1 = c0 + c2 + c4 + c6,
+   // m1 = O2 = c1 + 4c3 + 16c5 and p2 = E2 = c0 + 4c2 + 16c4 + 64c6:
+   //
+   eval_subtract(t, p1, m1);
+   toom_shift_right(t, 1u);
+   eval_add(p1, m1);
+   toom_shift_right(p1, 1u);
+   eval_subtract(m1, p2, m2);
+   toom_shift_right(m1, 2u);
+   eval_add(p2, m2);
+   toom_shift_right(p2, 1u);
+   //
+   // Even coefficients: p1 = c2 + c4, p2 = c2 + 4c4, and then p2 = c4, p1 = c2:
+   //
+   eval_subtract(p1, c0);
+   eval_subtract(p1, c6);
+   eval_subtract(p2, c0);
+   m2 = c6;
+   toom_shift_left(m2, 6u);
+   eval_subtract(p2, m2);
+   toom_shift_right(p2, 2u);
+   eval_subtract(p2, p1);
+   toom_divide_exact(p2, 3u);
+   eval_subtract(p1, p2);
+   //
+   // h = 16c1 + 4c3 + c5:
+   //
+   m2 = c0;
+   toom_shift_left(m2, 6u);
+   eval_subtract(h, m2);
+   m2 = p1;
+   toom_shift_left(m2, 4u);
+   eval_subtract(h, m2);
+   m2 = p2;
+   toom_shift_left(m2, 2u);
+   eval_subtract(h, m2);
+   eval_subtract(h, c6);
+   toom_shift_right(h, 1u);
+   //
+   // Odd coefficients: m1 = (O2 - O1) / 3 = c3 + 5c5, m2 = (16 O1 - h) / 3 = 4c3 + 5c5,
+   // then m2 = c3, m1 = c5 and t = c1:
+   //
+   eval_subtract(m1, t);
+   toom_divide_exact(m1, 3u);
+   m2 = t;
+   toom_shift_left(m2, 4u);
+   eval_subtract(m2, h);
+   toom_divide_exact(m2, 3u);
+   eval_subtract(m2, m1);
+   toom_divide_exact(m2, 3u);
+   eval_subtract(m1, m2);
+   toom_divide_exact(m1, 5u);
+   eval_subtract(t, m2);
+   eval_subtract(t, m1);
+
+   toom_accumulate(result, t, n);
+   toom_accumulate(result, p1, 2 * n);
+   toom_accumulate(result, m2, 3 * n);
+   toom_accumulate(result, p2, 4 * n);
+   toom_accumulate(result, m1, 5 * n);
+
+   storage.deallocate(10 * (n + 2) + 6 * (2 * n + 5));
+   result.normalize();
+}
+
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline void multiply_ntt(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   std::size_t as = a.size();
+   std::size_t bs = b.size();
+   std::size_t ws = ntt_storage_size(as, bs);
+   BOOST_MP_ASSERT(result.size() >= as + bs);
+   ntt_multiply(result.limbs(), a.limbs(), as, b.limbs(), bs, storage.allocate(ws));
+   storage.deallocate(ws);
+   result.resize(as + bs, as + bs);
+   result.normalize();
+}
+#endif
+//
+// Picks the multiplication algorithm, the Toom-Cook variants are only used when
+// the arguments are balanced enough that all the parts are non-zero:
+//
+inline bool use_ntt_multiply(std::size_t as, std::size_t bs)
+{
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+   return (std::min)(as, bs) >= ntt_cutoff;
+#else
+   (void)as;
+   (void)bs;
+   return false;
+#endif
+}
+inline bool use_toom4_multiply(std::size_t as, std::size_t bs)
+{
+   std::size_t s = (std::min)(as, bs);
+   return (s >= toom4_cutoff) && (s > 3 * (((std::max)(as, bs) + 3) / 4));
+}
+inline bool use_toom3_multiply(std::size_t as, std::size_t bs)
+{
+   std::size_t s = (std::min)(as, bs);
+   return (s >= toom3_cutoff) && (s > 2 * (((std::max)(as, bs) + 2) / 3));
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline void multiply_recursive(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    typename cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>::scoped_shared_storage& storage)
+{
+   std::size_t as = a.size();
+   std::size_t bs = b.size();
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+   if (use_ntt_multiply(as, bs))
+      multiply_ntt(result, a, b, storage);
+   else
+#endif
+   if (use_toom4_multiply(as, bs))
+      multiply_toom4(result, a, b, storage);
+   else if (use_toom3_multiply(as, bs))
+      multiply_toom3(result, a, b, storage);
+   else
+      multiply_karatsuba(result, a, b, storage);
+   result.sign(a.sign() != b.sign());
+}
+
 inline std::size_t karatsuba_storage_size(std::size_t s)
 {
    // 
-   // This estimates how much memory we will need based on
-   // s-limb multiplication.  In an ideal world the number of limbs
-   // would halve with each recursion, and our storage requirements
-   // would be 4s in the limit, and rather less in practice since
-   // we bail out long before we reach one limb.  In the real world
-   // we don't quite halve s in each recursion, so this is an heuristic
-   // which over-estimates how much we need.  We could compute an exact
-   // value, but it would be rather time consuming.
+   // This computes how much memory we will need based on s-limb multiplication:
+   // at each level of recursion take the largest requirement of the algorithms which
+   // may be chosen, the largest sub-product at the next level has s/2+2 limbs
+   // (for Karatsuba, the Toom-Cook variants reduce s more quickly).  The number
+   // theoretic transform is never used below the outermost level, and is accounted
+   // for separately.
    //
-   return 5 * s;
+   std::size_t total = 0;
+   while (s >= karatsuba_cutoff)
+   {
+      std::size_t n    = s / 2 + 1;
+      std::size_t need = 4 * n + 4;
+      if (s >= toom3_cutoff)
+      {
+         n    = (s + 2) / 3;
+         need = (std::max)(need, 6 * (n + 2) + 3 * (2 * n + 5));
+      }
+      if (s >= toom4_cutoff)
+      {
+         n    = (s + 3) / 4;
+         need = (std::max)(need, 10 * (n + 2) + 6 * (2 * n + 5));
+      }
+      total += need;
+      s = s / 2 + 2;
+   }
+   return total;
+}
+inline std::size_t multiply_storage_size(std::size_t as, std::size_t bs)
+{
+#ifdef BOOST_MP_HAS_NTT_MULTIPLY
+   if (use_ntt_multiply(as, bs))
+      return ntt_storage_size(as, bs);
+#endif
+   return karatsuba_storage_size((std::max)(as, bs));
 }
 //
 // There are 2 entry point routines for Karatsuba multiplication:
@@ -245,8 +690,7 @@ setup_karatsuba(
 {
    std::size_t as = a.size();
    std::size_t bs = b.size();
-   std::size_t s = as > bs ? as : bs;
-   std::size_t storage_size = karatsuba_storage_size(s);
+   std::size_t storage_size = multiply_storage_size(as, bs);
    if (storage_size < 300)
    {
       //
@@ -256,12 +700,12 @@ setup_karatsuba(
       //
       limb_type limbs[300];
       typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::scoped_shared_storage storage(limbs, storage_size);
-      multiply_karatsuba(result, a, b, storage);
+      multiply_recursive(result, a, b, storage);
    }
    else
    {
       typename cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>::scoped_shared_storage storage(result.allocator(), storage_size);
-      multiply_karatsuba(result, a, b, storage);
+      multiply_recursive(result, a, b, storage);
    }
 }
 
@@ -284,9 +728,8 @@ setup_karatsuba(
    variable_precision_type a_t(a.limbs(), 0, a.size()), b_t(b.limbs(), 0, b.size());
    std::size_t as = a.size();
    std::size_t bs = b.size();
-   std::size_t s = as > bs ? as : bs;
    std::size_t sz = as + bs;
-   std::size_t storage_size = karatsuba_storage_size(s);
+   std::size_t storage_size = multiply_storage_size(as, bs);
 
    if (!is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value || (sz * sizeof(limb_type) * CHAR_BIT <= MaxBits1))
    {
@@ -294,7 +737,7 @@ setup_karatsuba(
       result.resize(sz, sz);
       variable_precision_type t(result.limbs(), 0, result.size());
       typename variable_precision_type::scoped_shared_storage storage(t.allocator(), storage_size);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_recursive(t, a_t, b_t, storage);
       result.resize(t.size(), t.size());
    }
    else
@@ -305,7 +748,7 @@ setup_karatsuba(
       //
       typename variable_precision_type::scoped_shared_storage storage(variable_precision_type::allocator_type(), sz + storage_size);
       variable_precision_type t(storage, sz);
-      multiply_karatsuba(t, a_t, b_t, storage);
+      multiply_recursive(t, a_t, b_t, storage);
       //
       // If there is truncation, and result is a checked type then this will throw:
       //
@@ -326,14 +769,13 @@ setup_karatsuba(
    variable_precision_type a_t(a.limbs(), 0, a.size()), b_t(b.limbs(), 0, b.size());
    std::size_t as = a.size();
    std::size_t bs = b.size();
-   std::size_t s = as > bs ? as : bs;
    std::size_t sz = as + bs;
-   std::size_t storage_size = karatsuba_storage_size(s);
+   std::size_t storage_size = multiply_storage_size(as, bs);
 
    result.resize(sz, sz);
    variable_precision_type t(result.limbs(), 0, result.size());
    typename variable_precision_type::scoped_shared_storage storage(t.allocator(), storage_size);
-   multiply_karatsuba(t, a_t, b_t, storage);
+   multiply_recursive(t, a_t, b_t, storage);
 }
 
 template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, std::size_t MinBits2, std::size_t MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, std::size_t MinBits3, std::size_t MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
@@ -386,6 +828,28 @@ eval_multiply_comba(
          *pr = static_cast<limb_type>(carry);
    }
 }
+//
+// Sets pr[0, 2 * as) to the square of the as limbs at pa, pr must be zeroed on entry.
+// Each cross product a[i] * a[j] with i < j is computed once and the sum doubled,
+// before adding in the squares of the individual limbs, which roughly halves the
+// number of limb multiplications compared to a general product:
+//
+inline BOOST_MP_CXX14_CONSTEXPR void eval_square_schoolbook(limb_type* pr, const limb_type* pa, std::size_t as) noexcept
+{
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+   {
+      for (std::size_t i = 0; i + 1 < as; ++i)
+         pr[i + as] = ::boost::multiprecision::detail::limb_addmul_1(pr + 2 * i + 1, pa + i + 1, as - i - 1, pa[i]);
+      ::boost::multiprecision::detail::limb_sqr_diag_addlsh1(pr, pa, as);
+      return;
+   }
+#endif
+   for (std::size_t i = 0; i + 1 < as; ++i)
+      pr[i + as] = ::boost::multiprecision::detail::limb_addmul_1_generic(pr + 2 * i + 1, pa + i + 1, as - i - 1, pa[i], 0);
+   ::boost::multiprecision::detail::limb_sqr_diag_addlsh1_generic(pr, pa, as);
+}
+
 template <std::size_t MinBits1, std::size_t MaxBits1, cpp_integer_type SignType1, cpp_int_check_type Checked1, class Allocator1, std::size_t MinBits2, std::size_t MaxBits2, cpp_integer_type SignType2, cpp_int_check_type Checked2, class Allocator2, std::size_t MinBits3, std::size_t MaxBits3, cpp_integer_type SignType3, cpp_int_check_type Checked3, class Allocator3>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits2, MaxBits2, SignType2, Checked2, Allocator2> >::value && !is_trivial_cpp_int<cpp_int_backend<MinBits3, MaxBits3, SignType3, Checked3, Allocator3> >::value>::type
 eval_multiply(
@@ -433,7 +897,10 @@ eval_multiply(
    if ((void*)&result == (void*)&a)
    {
       cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> t(a);
-      eval_multiply(result, t, b);
+      if ((void*)&a == (void*)&b)
+         eval_multiply(result, t, t); // keep squares on the squaring path
+      else
+         eval_multiply(result, t, b);
       return;
    }
    if ((void*)&result == (void*)&b)
@@ -473,6 +940,15 @@ eval_multiply(
 #endif
    std::memset(pr, 0, result.size() * sizeof(limb_type));   
 
+   if ((pa == pb) && (as == bs) && (result.size() == as + bs))
+   {
+      // Squaring, with room for the whole result:
+      eval_square_schoolbook(pr, pa, as);
+      result.normalize();
+      result.sign(false);
+      return;
+   }
+
 #if defined(BOOST_MP_COMBA)
        // 
        // Comba Multiplier might not be efficient because of less efficient assembly
@@ -482,6 +958,26 @@ eval_multiply(
        eval_multiply_comba(result, a, b);
 #else
 
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   if (!BOOST_MP_IS_CONST_EVALUATED(as))
+   {
+      for (std::size_t i = 0; i < as; ++i)
+      {
+         BOOST_MP_ASSERT(result.size() > i);
+         std::size_t inner_limit = !is_fixed_precision<cpp_int_backend<MinBits1, MaxBits1, SignType1, Checked1, Allocator1> >::value ? bs : (std::min)(result.size() - i, bs);
+         limb_type   carry       = ::boost::multiprecision::detail::limb_addmul_1(pr + i, pb, inner_limit, pa[i]);
+         if (carry)
+         {
+            resize_for_carry(result, i + inner_limit + 1); // May throw if checking is enabled
+            if (i + inner_limit < result.size())
+               pr[i + inner_limit] = carry;
+         }
+      }
+      result.normalize();
+      result.sign(a.sign() != b.sign());
+      return;
+   }
+#endif
    double_limb_type carry = 0;
    for (std::size_t i = 0; i < as; ++i)
    {
@@ -839,6 +1335,162 @@ eval_multiply(
    result = static_cast<double_limb_type>(a) * static_cast<double_limb_type>(b);
 }
 
+//
+// Fused multiply-accumulate, result += a * b, or result -= a * b when subtract is set.
+// Below the Karatsuba cutoff each row of the product is accumulated directly into
+// result, so no full width temporary is created and result is traversed only once
+// per row.  If the product and result have opposite signs the rows are subtracted
+// modulo 2^(limb_bits * n), and a negative final value is recovered from its two's
+// complement:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+void eval_multiply_accumulate(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    bool                                                                           subtract)
+{
+   using backend_type = cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>;
+
+   std::size_t as = a.size();
+   std::size_t bs = b.size();
+   if (((void*)&result == (void*)&a) || ((void*)&result == (void*)&b) || ((as >= karatsuba_cutoff) && (bs >= karatsuba_cutoff)))
+   {
+      backend_type t;
+      eval_multiply(t, a, b);
+      if (subtract)
+         eval_subtract(result, t);
+      else
+         eval_add(result, t);
+      return;
+   }
+   typename backend_type::const_limb_pointer pa = a.limbs();
+   typename backend_type::const_limb_pointer pb = b.limbs();
+   if (((as == 1) && !*pa) || ((bs == 1) && !*pb))
+      return;
+   if (as > bs)
+   {
+      std::swap(as, bs);
+      std::swap(pa, pb);
+   }
+   const bool        negative_product = (a.sign() != b.sign()) != subtract;
+   const std::size_t rs               = result.size();
+   const bool        result_zero      = (rs == 1) && !result.limbs()[0];
+   const bool        accumulate       = result_zero || (result.sign() == negative_product);
+   const bool        result_sign      = result_zero ? negative_product : result.sign();
+   const std::size_t n                = (std::max)(rs, as + bs) + 1;
+
+   result.resize(n, n);
+   typename backend_type::limb_pointer pr = result.limbs();
+   std::memset(pr + rs, 0, (n - rs) * sizeof(limb_type));
+
+   bool flip_sign = false;
+   if (accumulate)
+   {
+      for (std::size_t i = 0; i < as; ++i)
+      {
+         double_limb_type carry = ::boost::multiprecision::detail::limb_addmul_1(pr + i, pb, bs, pa[i]);
+         for (std::size_t k = i + bs; carry; ++k)
+         {
+            BOOST_MP_ASSERT(k < n);
+            carry += pr[k];
+            pr[k] = static_cast<limb_type>(carry);
+            carry >>= backend_type::limb_bits;
+         }
+      }
+   }
+   else
+   {
+      for (std::size_t i = 0; i < as; ++i)
+      {
+         double_limb_type borrow = ::boost::multiprecision::detail::limb_submul_1(pr + i, pb, bs, pa[i]);
+         for (std::size_t k = i + bs; borrow && (k < n); ++k)
+         {
+            limb_type low = static_cast<limb_type>(borrow);
+            borrow >>= backend_type::limb_bits;
+            borrow += pr[k] < low ? 1u : 0u;
+            pr[k] -= low;
+         }
+      }
+      //
+      // Both operands are less than 2^(limb_bits * (n - 1)), so the top bit tells us
+      // whether the subtraction went negative:
+      //
+      if (pr[n - 1] >> (backend_type::limb_bits - 1))
+      {
+         limb_type carry = 1;
+         for (std::size_t k = 0; k < n; ++k)
+         {
+            pr[k] = ~pr[k] + carry;
+            carry = carry && !pr[k] ? 1u : 0u;
+         }
+         flip_sign = true;
+      }
+   }
+   result.normalize();
+   result.sign(result_sign != flip_sign);
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value && !is_fixed_precision<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value>::type
+eval_multiply_add(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b)
+{
+   eval_multiply_accumulate(result, a, b, false);
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value && !is_fixed_precision<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value>::type
+eval_multiply_subtract(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b)
+{
+   eval_multiply_accumulate(result, a, b, true);
+}
+//
+// result = a * b + c, only the case where result is c benefits from fusion:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value && !is_fixed_precision<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value>::type
+eval_multiply_add(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& c)
+{
+   if ((void*)&result == (void*)&c)
+      eval_multiply_accumulate(result, a, b, false);
+   else
+   {
+      eval_multiply(result, a, b);
+      eval_add(result, c);
+   }
+}
+
+template <std::size_t MinBits, std::size_t MaxBits, cpp_int_check_type Checked, class Allocator>
+inline typename std::enable_if<!is_trivial_cpp_int<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value && !is_fixed_precision<cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator> >::value>::type
+eval_multiply_subtract(
+    cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>&       result,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& a,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& b,
+    const cpp_int_backend<MinBits, MaxBits, signed_magnitude, Checked, Allocator>& c)
+{
+   if ((void*)&result == (void*)&c)
+   {
+      // a * b - c == -(c - a * b):
+      eval_multiply_accumulate(result, a, b, true);
+      result.negate();
+   }
+   else
+   {
+      eval_multiply(result, a, b);
+      eval_subtract(result, c);
+   }
+}
+
 #ifdef BOOST_MSVC
 #pragma warning(pop)
 #endif
@@ -0,0 +1,262 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   https://www.boost.org/LICENSE_1_0.txt)
+//
+// Three prime number theoretic transform multiplication of limb arrays,
+// used by cpp_int for very large operands:
+//
+#ifndef BOOST_MP_CPP_INT_NTT_HPP
+#define BOOST_MP_CPP_INT_NTT_HPP
+
+#include <cstring>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+#ifdef BOOST_HAS_INT128
+//
+// The transform needs a double width product of two limbs, and limbs large enough that three
+// primes just below the limb size can hold every convolution coefficient, so it is only
+// available when limb_type is 64-bits.  Each prime has the form c * 2^k + 1 so that
+// there is a 2^k'th root of unity, and all arithmetic modulo the prime is in Montgomery form.
+//
+#define BOOST_MP_HAS_NTT_MULTIPLY
+
+struct ntt_prime
+{
+   limb_type   p;        // the prime
+   limb_type   inverse;  // -p^-1 mod 2^64
+   limb_type   r2;       // 2^128 mod p
+   limb_type   root;     // a primitive root mod p
+   std::size_t max_log2; // largest k such that 2^k divides p - 1
+
+   limb_type reduce(double_limb_type t) const noexcept
+   {
+      // REDC, t < p * 2^64:
+      limb_type        m = static_cast<limb_type>(t) * inverse;
+      double_limb_type s = t + static_cast<double_limb_type>(m) * p;
+      limb_type        r = static_cast<limb_type>(s >> bits_per_limb);
+      return r >= p ? r - p : r;
+   }
+   limb_type multiply(limb_type a, limb_type b) const noexcept
+   {
+      return reduce(static_cast<double_limb_type>(a) * b);
+   }
+   limb_type add(limb_type a, limb_type b) const noexcept
+   {
+      limb_type r = a + b;
+      return r >= p ? r - p : r;
+   }
+   limb_type subtract(limb_type a, limb_type b) const noexcept
+   {
+      return a >= b ? a - b : a + (p - b);
+   }
+   // Converts any limb into Montgomery form, and back again:
+   limb_type to_montgomery(limb_type a) const noexcept { return multiply(a, r2); }
+   limb_type from_montgomery(limb_type a) const noexcept { return reduce(a); }
+   limb_type one() const noexcept { return to_montgomery(1u); }
+   limb_type pow(limb_type a, limb_type e) const noexcept
+   {
+      // a is in Montgomery form and so is the result:
+      limb_type r = one();
+      while (e)
+      {
+         if (e & 1u)
+            r = multiply(r, a);
+         a = multiply(a, a);
+         e >>= 1;
+      }
+      return r;
+   }
+   limb_type invert(limb_type a) const noexcept { return pow(a, p - 2); }
+};
+
+inline const ntt_prime* ntt_primes() noexcept
+{
+   //
+   // 29 * 2^57 + 1, 69 * 2^55 + 1 and 27 * 2^56 + 1, whose product is a little over 2^183 so
+   // the transform is exact for operands of up to 2^55 limbs:
+   //
+   static const ntt_prime primes[3] = {
+       {4179340454199820289uLL, 4179340454199820287uLL, 1878466934230121386uLL, 3u, 57},
+       {2485986994308513793uLL, 2485986994308513791uLL, 1974795801822054070uLL, 5u, 55},
+       {1945555039024054273uLL, 1945555039024054271uLL, 269548777697434221uLL, 5u, 56},
+   };
+   return primes;
+}
+
+inline std::size_t ntt_transform_size(std::size_t as, std::size_t bs) noexcept
+{
+   std::size_t l = 1;
+   while (l < as + bs - 1)
+      l <<= 1;
+   return l;
+}
+//
+// Limbs of workspace required by ntt_multiply:
+//
+inline std::size_t ntt_storage_size(std::size_t as, std::size_t bs) noexcept
+{
+   std::size_t l = ntt_transform_size(as, bs);
+   return 2 * l + l / 2 + 2 * (as + bs);
+}
+//
+// w[k] = omega^k for k < l/2, where omega is a primitive l'th root of unity:
+//
+inline void ntt_twiddles(limb_type* w, std::size_t l, const ntt_prime& prime) noexcept
+{
+   limb_type omega = prime.pow(prime.to_montgomery(prime.root), (prime.p - 1) / l);
+   limb_type x     = prime.one();
+   for (std::size_t k = 0; k < l / 2; ++k)
+   {
+      w[k] = x;
+      x    = prime.multiply(x, omega);
+   }
+}
+//
+// Decimation in frequency: natural order in, bit reversed order out.
+//
+inline void ntt_forward(limb_type* f, std::size_t l, const limb_type* w, const ntt_prime& prime) noexcept
+{
+   for (std::size_t len = l / 2, step = 1; len; len >>= 1, step <<= 1)
+   {
+      for (std::size_t s = 0; s < l; s += 2 * len)
+      {
+         for (std::size_t j = 0; j < len; ++j)
+         {
+            limb_type u = f[s + j];
+            limb_type v = f[s + j + len];
+            f[s + j]       = prime.add(u, v);
+            f[s + j + len] = prime.multiply(prime.subtract(u, v), w[j * step]);
+         }
+      }
+   }
+}
+//
+// Decimation in time: bit reversed order in, natural order out, the result is
+// scaled by l and still needs dividing through.  The inverse twiddle for k > 0
+// is omega^(l-k) = -omega^(l/2-k):
+//
+inline void ntt_inverse(limb_type* f, std::size_t l, const limb_type* w, const ntt_prime& prime) noexcept
+{
+   for (std::size_t len = 1, step = l / 2; len < l; len <<= 1, step >>= 1)
+   {
+      for (std::size_t s = 0; s < l; s += 2 * len)
+      {
+         limb_type u = f[s];
+         limb_type v = f[s + len];
+         f[s]        = prime.add(u, v);
+         f[s + len]  = prime.subtract(u, v);
+         for (std::size_t j = 1; j < len; ++j)
+         {
+            u              = f[s + j];
+            v              = prime.multiply(f[s + j + len], prime.p - w[l / 2 - j * step]);
+            f[s + j]       = prime.add(u, v);
+            f[s + j + len] = prime.subtract(u, v);
+         }
+      }
+   }
+}
+//
+// Sets r[0, as+bs-1) to the convolution of a and b modulo prime, each value in normal form:
+//
+inline void ntt_convolution(limb_type* r, const limb_type* pa, std::size_t as, const limb_type* pb, std::size_t bs, const ntt_prime& prime, limb_type* workspace) noexcept
+{
+   const std::size_t l  = ntt_transform_size(as, bs);
+   limb_type*        fa = workspace;
+   limb_type*        fb = fa + l;
+   limb_type*        w  = fb + l;
+   const bool        square = (pa == pb) && (as == bs);
+
+   BOOST_MP_ASSERT(l <= (static_cast<std::size_t>(1u) << prime.max_log2));
+   ntt_twiddles(w, l, prime);
+
+   for (std::size_t i = 0; i < as; ++i)
+      fa[i] = prime.to_montgomery(pa[i]);
+   std::memset(fa + as, 0, (l - as) * sizeof(limb_type));
+   ntt_forward(fa, l, w, prime);
+   if (square)
+   {
+      for (std::size_t i = 0; i < l; ++i)
+         fa[i] = prime.multiply(fa[i], fa[i]);
+   }
+   else
+   {
+      for (std::size_t i = 0; i < bs; ++i)
+         fb[i] = prime.to_montgomery(pb[i]);
+      std::memset(fb + bs, 0, (l - bs) * sizeof(limb_type));
+      ntt_forward(fb, l, w, prime);
+      for (std::size_t i = 0; i < l; ++i)
+         fa[i] = prime.multiply(fa[i], fb[i]);
+   }
+   ntt_inverse(fa, l, w, prime);
+   //
+   // Multiplying by l^-1 in normal form also takes us out of Montgomery form:
+   //
+   limb_type scale = prime.from_montgomery(prime.invert(prime.to_montgomery(static_cast<limb_type>(l))));
+   for (std::size_t i = 0; i < as + bs - 1; ++i)
+      r[i] = prime.multiply(fa[i], scale);
+}
+//
+// Sets pr[0, as+bs) to the product of a and b.  pr must not overlap either argument:
+//
+inline void ntt_multiply(limb_type* pr, const limb_type* pa, std::size_t as, const limb_type* pb, std::size_t bs, limb_type* workspace) noexcept
+{
+   const ntt_prime*  primes = ntt_primes();
+   const std::size_t n      = as + bs - 1;
+   limb_type*        c1     = workspace;
+   limb_type*        c2     = c1 + n;
+   limb_type*        c3     = c2 + n;
+
+   ntt_convolution(c1, pa, as, pb, bs, primes[0], c3);
+   ntt_convolution(c2, pa, as, pb, bs, primes[1], c3);
+   ntt_convolution(c3, pa, as, pb, bs, primes[2], c3);
+   //
+   // Recombine with Garner's algorithm: coefficient = x1 + x2 * p1 + x3 * p1 * p2,
+   // then add the coefficients together with carry propagation:
+   //
+   const ntt_prime& q1 = primes[0];
+   const ntt_prime& q2 = primes[1];
+   const ntt_prime& q3 = primes[2];
+   // p1^-1 mod p2 and (p1 * p2)^-1 mod p3, in Montgomery form so that multiply() by them gives a normal result:
+   const limb_type        inv12   = q2.invert(q2.to_montgomery(q1.p));
+   const limb_type        p1_mod3 = q3.to_montgomery(q1.p);
+   const limb_type        inv123  = q3.invert(q3.multiply(p1_mod3, q3.to_montgomery(q2.p)));
+   const double_limb_type p12     = static_cast<double_limb_type>(q1.p) * q2.p;
+   const limb_type        p12_lo  = static_cast<limb_type>(p12);
+   const limb_type        p12_hi  = static_cast<limb_type>(p12 >> bits_per_limb);
+
+   limb_type carry0 = 0, carry1 = 0, carry2 = 0;
+   for (std::size_t k = 0; k < n; ++k)
+   {
+      limb_type x1 = c1[k];
+      limb_type x2 = q2.multiply(q2.subtract(c2[k], x1 % q2.p), inv12);
+      limb_type t  = q3.subtract(c3[k], x1 % q3.p);
+      t            = q3.subtract(t, q3.multiply(x2 % q3.p, p1_mod3));
+      limb_type x3 = q3.multiply(t, inv123);
+      //
+      // carry += x1 + x2 * p1 + x3 * p1p2, after which the low limb is final:
+      //
+      double_limb_type v  = static_cast<double_limb_type>(x2) * q1.p + x1;
+      double_limb_type u0 = static_cast<double_limb_type>(x3) * p12_lo;
+      double_limb_type u1 = static_cast<double_limb_type>(x3) * p12_hi;
+      double_limb_type s  = static_cast<double_limb_type>(carry0) + static_cast<limb_type>(v) + static_cast<limb_type>(u0);
+      pr[k]               = static_cast<limb_type>(s);
+      s                   = (s >> bits_per_limb) + carry1 + static_cast<limb_type>(v >> bits_per_limb) + static_cast<limb_type>(u0 >> bits_per_limb) + static_cast<limb_type>(u1);
+      carry0              = static_cast<limb_type>(s);
+      s                   = (s >> bits_per_limb) + carry2 + static_cast<limb_type>(u1 >> bits_per_limb);
+      carry1              = static_cast<limb_type>(s);
+      carry2              = static_cast<limb_type>(s >> bits_per_limb);
+   }
+   pr[n] = carry0;
+   BOOST_MP_ASSERT((carry1 == 0) && (carry2 == 0));
+}
+
+#endif // BOOST_HAS_INT128
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
@@ -0,0 +1,167 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost Software License, Version 1.0.
+//  (See accompanying file LICENSE_1_0.txt or copy at
+//   https://www.boost.org/LICENSE_1_0.txt)
+//
+// Divide and conquer conversion of large cpp_int's to and from decimal strings:
+//
+#ifndef BOOST_MP_CPP_INT_RADIX_CONVERSION_HPP
+#define BOOST_MP_CPP_INT_RADIX_CONVERSION_HPP
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <boost/multiprecision/cpp_int/cpp_int_config.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+
+namespace boost { namespace multiprecision { namespace backends {
+
+//
+// The powers 10^(digits_per_block_10 * 2^i), each the square of the last, are computed
+// once per conversion and shared by every level of the recursion:
+//
+template <class CppInt>
+class decimal_powers
+{
+ public:
+   decimal_powers()
+   {
+      m_powers.push_back(CppInt(max_block_10));
+   }
+   static std::size_t digits(std::size_t i) { return static_cast<std::size_t>(digits_per_block_10) << i; }
+   std::size_t        size() const { return m_powers.size(); }
+   const CppInt&      operator[](std::size_t i) const { return m_powers[i]; }
+   // Extends the table until it holds a power with at least the given number of limbs,
+   // or every power with fewer than the given number of decimal digits:
+   void extend_to_limbs(std::size_t limbs)
+   {
+      while (m_powers.back().size() < limbs)
+         square_last();
+   }
+   void extend_to_digits(std::size_t d)
+   {
+      while (digits(m_powers.size()) < d)
+         square_last();
+   }
+
+ private:
+   void square_last()
+   {
+      CppInt t;
+      eval_multiply(t, m_powers.back(), m_powers.back());
+      m_powers.push_back(t);
+   }
+   std::vector<CppInt> m_powers;
+};
+
+//
+// Writes the decimal digits of the positive value t so that the last digit is at *(last - 1),
+// never writing before first.  Positions which receive no digit must already hold '0':
+//
+template <class CppInt>
+void write_decimal(char* first, char* last, const CppInt& t, const decimal_powers<CppInt>& powers)
+{
+   if (!use_recursive_radix_conversion(t.size()))
+   {
+      CppInt q(t), r;
+      while ((q.size() > 1) || q.limbs()[0])
+      {
+         CppInt t2;
+         divide_unsigned_helper(&t2, q, max_block_10, r);
+         q           = t2;
+         limb_type v = r.limbs()[0];
+         for (std::size_t i = 0; (i < digits_per_block_10) && (last != first); ++i)
+         {
+            *--last = static_cast<char>('0' + static_cast<char>(v % 10));
+            v /= 10;
+         }
+      }
+      return;
+   }
+   //
+   // Split on the largest tabulated power with no more than half the limbs of t,
+   // the remainder then fills exactly digits(i) characters:
+   //
+   std::size_t i = powers.size() - 1;
+   while (i && (2 * powers[i].size() > t.size() + 1))
+      --i;
+   CppInt q, r;
+   divide_unsigned_helper(&q, t, powers[i], r);
+   write_decimal(first, last, r, powers);
+   if ((q.size() > 1) || q.limbs()[0])
+      write_decimal(first, last - decimal_powers<CppInt>::digits(i), q, powers);
+}
+
+//
+// Sets result to the value of the n decimal digits at s:
+//
+template <class CppInt>
+void read_decimal(CppInt& result, const char* s, std::size_t n, const decimal_powers<CppInt>& powers)
+{
+   if (!use_recursive_radix_conversion_digits(n))
+   {
+      result = static_cast<limb_type>(0u);
+      while (n)
+      {
+         std::size_t count = n < digits_per_block_10 ? n : static_cast<std::size_t>(digits_per_block_10);
+         limb_type   block = 0;
+         for (std::size_t i = 0; i < count; ++i, ++s)
+         {
+            if ((*s < '0') || (*s > '9'))
+               BOOST_MP_THROW_EXCEPTION(std::runtime_error("Unexpected character encountered in input."));
+            block *= 10;
+            block += static_cast<limb_type>(*s - '0');
+         }
+         eval_multiply(result, count == digits_per_block_10 ? max_block_10 : block_multiplier(count - 1));
+         eval_add(result, block);
+         n -= count;
+      }
+      return;
+   }
+   //
+   // The low part takes the largest tabulated power with fewer digits than the whole,
+   // so the high part is never the longer of the two:
+   //
+   std::size_t i = powers.size() - 1;
+   while (decimal_powers<CppInt>::digits(i) >= n)
+      --i;
+   const std::size_t low_digits = decimal_powers<CppInt>::digits(i);
+   CppInt            high, low;
+   read_decimal(high, s, n - low_digits, powers);
+   read_decimal(low, s + (n - low_digits), low_digits, powers);
+   eval_multiply(result, high, powers[i]);
+   eval_add(result, low);
+}
+
+//
+// Entry points used by cpp_int_backend, conversion is carried out in the variable
+// precision working type whatever the type of the value:
+//
+template <class CppInt>
+void radix_conversion_to_decimal(std::string& result, const CppInt& x)
+{
+   using working_type = cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> >;
+   working_type t(x);
+   t.sign(false);
+   decimal_powers<working_type> powers;
+   powers.extend_to_limbs(t.size() / 2 + 1);
+   write_decimal(&result[0], &result[0] + result.size(), t, powers);
+}
+
+template <class CppInt>
+void radix_conversion_from_decimal(CppInt& result, const char* s, std::size_t n)
+{
+   using working_type = cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<limb_type> >;
+   decimal_powers<working_type> powers;
+   powers.extend_to_digits(n);
+   working_type t;
+   read_decimal(t, s, n, powers);
+   result = t;
+}
+
+}}} // namespace boost::multiprecision::backends
+
+#endif
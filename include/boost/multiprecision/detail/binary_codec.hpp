@@ -0,0 +1,317 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_DETAIL_BINARY_CODEC_HPP
+#define BOOST_MP_DETAIL_BINARY_CODEC_HPP
+
+//
+// A compact binary encoding for multiprecision values which does not depend on
+// Boost.Serialization.  Each value is self delimiting:
+//
+// Integers:     varint (byte_count << 1 | sign) followed by byte_count bytes of
+//               magnitude, least significant first, with no leading zero bytes.
+// Binary float: a flags byte (class | sign << 2), and for finite non-zero values
+//               a zig-zag varint exponent e and the integer mantissa m as
+//               varint byte_count plus bytes, so that the value is m * 2^e.
+// Decimal float: the flags byte, and for finite non-zero values a zig-zag varint
+//               base 10 exponent, a varint element count and then that many
+//               base 10^8 elements as 4 byte little endian words.
+// Rationals:    the numerator then the denominator, in lowest terms, as integers.
+//
+// Varints are unsigned LEB128.  The encoding depends neither on the limb size nor on
+// the byte order of the host, and arrays of values carry a short header holding a
+// format version.  On little endian hosts limbs are copied straight to and from the
+// caller's buffer.
+//
+// The backends supply eval_binary_encoded_size, eval_binary_encode and eval_binary_decode.
+//
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+#include <boost/multiprecision/detail/endian.hpp>
+#include <boost/multiprecision/detail/number_base.hpp>
+
+#if defined(__cpp_lib_span) && (__cpp_lib_span >= 202002L)
+#include <span>
+#define BOOST_MP_HAS_STD_SPAN
+#endif
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Version of the format written by binary_encode_array, readers accept this version and earlier:
+//
+constexpr unsigned char binary_codec_version  = 1;
+constexpr unsigned char binary_codec_magic[2] = {'M', 'P'};
+
+//
+// Classification of floating point values, stored in the low 2 bits of the flags byte:
+//
+enum binary_codec_class
+{
+   binary_codec_zero     = 0,
+   binary_codec_finite   = 1,
+   binary_codec_infinity = 2,
+   binary_codec_nan      = 3
+};
+
+inline std::size_t binary_varint_size(std::uint64_t v) noexcept
+{
+   std::size_t result = 1;
+   while (v >= 0x80u)
+   {
+      v >>= 7;
+      ++result;
+   }
+   return result;
+}
+
+inline std::uint64_t binary_zigzag(std::int64_t v) noexcept
+{
+   return (static_cast<std::uint64_t>(v) << 1) ^ static_cast<std::uint64_t>(-static_cast<std::int64_t>(v < 0));
+}
+
+inline std::int64_t binary_unzigzag(std::uint64_t v) noexcept
+{
+   return static_cast<std::int64_t>(v >> 1) ^ -static_cast<std::int64_t>(v & 1u);
+}
+
+//
+// Writes into a caller supplied buffer, throwing std::length_error if it is too small:
+//
+class binary_writer
+{
+ public:
+   binary_writer(unsigned char* first, unsigned char* last) noexcept : m_pos(first), m_end(last) {}
+
+   unsigned char* position() const noexcept { return m_pos; }
+
+   unsigned char* reserve(std::size_t n)
+   {
+      if (static_cast<std::size_t>(m_end - m_pos) < n)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::length_error("Buffer too small for the binary encoding of a multiprecision value."));
+      }
+      unsigned char* p = m_pos;
+      m_pos += n;
+      return p;
+   }
+   void write_byte(unsigned char b)
+   {
+      *reserve(1) = b;
+   }
+   void write_varint(std::uint64_t v)
+   {
+      unsigned char* p = reserve(binary_varint_size(v));
+      while (v >= 0x80u)
+      {
+         *p++ = static_cast<unsigned char>(v | 0x80u);
+         v >>= 7;
+      }
+      *p = static_cast<unsigned char>(v);
+   }
+   void write_signed_varint(std::int64_t v)
+   {
+      write_varint(binary_zigzag(v));
+   }
+   void write_uint32(std::uint32_t v)
+   {
+      unsigned char* p = reserve(4);
+      p[0] = static_cast<unsigned char>(v);
+      p[1] = static_cast<unsigned char>(v >> 8);
+      p[2] = static_cast<unsigned char>(v >> 16);
+      p[3] = static_cast<unsigned char>(v >> 24);
+   }
+
+ private:
+   unsigned char* m_pos;
+   unsigned char* m_end;
+};
+
+//
+// Reads from a caller supplied buffer, throwing std::runtime_error on truncated or malformed input:
+//
+class binary_reader
+{
+ public:
+   binary_reader(const unsigned char* first, const unsigned char* last) noexcept : m_pos(first), m_end(last) {}
+
+   const unsigned char* position() const noexcept { return m_pos; }
+   std::size_t          remaining() const noexcept { return static_cast<std::size_t>(m_end - m_pos); }
+
+   const unsigned char* read(std::size_t n)
+   {
+      if (remaining() < n)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("Unexpected end of input while decoding a multiprecision value."));
+      }
+      const unsigned char* p = m_pos;
+      m_pos += n;
+      return p;
+   }
+   unsigned char read_byte()
+   {
+      return *read(1);
+   }
+   std::uint64_t read_varint()
+   {
+      std::uint64_t result = 0;
+      for (unsigned shift = 0; shift < 64; shift += 7)
+      {
+         unsigned char b = read_byte();
+         if ((shift == 63) && (b > 1))
+            break;
+         result |= static_cast<std::uint64_t>(b & 0x7Fu) << shift;
+         if (!(b & 0x80u))
+            return result;
+      }
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed length or exponent while decoding a multiprecision value."));
+      return result;
+   }
+   std::int64_t read_signed_varint()
+   {
+      return binary_unzigzag(read_varint());
+   }
+   std::uint32_t read_uint32()
+   {
+      const unsigned char* p = read(4);
+      return static_cast<std::uint32_t>(p[0]) | (static_cast<std::uint32_t>(p[1]) << 8) | (static_cast<std::uint32_t>(p[2]) << 16) | (static_cast<std::uint32_t>(p[3]) << 24);
+   }
+   //
+   // Reads a varint byte count, and checks that that many bytes follow:
+   //
+   std::size_t read_size()
+   {
+      std::uint64_t n = read_varint();
+      if (n > remaining())
+      {
+         BOOST_MP_THROW_EXCEPTION(std::runtime_error("Unexpected end of input while decoding a multiprecision value."));
+      }
+      return static_cast<std::size_t>(n);
+   }
+
+ private:
+   const unsigned char* m_pos;
+   const unsigned char* m_end;
+};
+
+inline std::size_t binary_array_header_size(std::size_t count) noexcept
+{
+   return sizeof(binary_codec_magic) + 1 + binary_varint_size(count);
+}
+
+} // namespace detail
+
+//
+// Single values:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::size_t binary_encoded_size(const number<Backend, ExpressionTemplates>& val)
+{
+   return eval_binary_encoded_size(val.backend());
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline unsigned char* binary_encode(const number<Backend, ExpressionTemplates>& val, unsigned char* first, unsigned char* last)
+{
+   detail::binary_writer w(first, last);
+   eval_binary_encode(w, val.backend());
+   return w.position();
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline const unsigned char* binary_decode(number<Backend, ExpressionTemplates>& val, const unsigned char* first, const unsigned char* last)
+{
+   detail::binary_reader r(first, last);
+   eval_binary_decode(r, val.backend());
+   return r.position();
+}
+
+//
+// Arrays of values, preceded by a header holding the format version and the number of values:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+std::size_t binary_encoded_array_size(const number<Backend, ExpressionTemplates>* values, std::size_t count)
+{
+   std::size_t result = detail::binary_array_header_size(count);
+   for (std::size_t i = 0; i < count; ++i)
+      result += eval_binary_encoded_size(values[i].backend());
+   return result;
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+unsigned char* binary_encode_array(const number<Backend, ExpressionTemplates>* values, std::size_t count, unsigned char* first, unsigned char* last)
+{
+   detail::binary_writer w(first, last);
+   unsigned char*        p = w.reserve(sizeof(detail::binary_codec_magic) + 1);
+   p[0]                    = detail::binary_codec_magic[0];
+   p[1]                    = detail::binary_codec_magic[1];
+   p[2]                    = detail::binary_codec_version;
+   w.write_varint(count);
+   for (std::size_t i = 0; i < count; ++i)
+      eval_binary_encode(w, values[i].backend());
+   return w.position();
+}
+
+template <class Backend, expression_template_option ExpressionTemplates, class Allocator>
+const unsigned char* binary_decode_array(std::vector<number<Backend, ExpressionTemplates>, Allocator>& values, const unsigned char* first, const unsigned char* last)
+{
+   detail::binary_reader r(first, last);
+   const unsigned char*  p = r.read(sizeof(detail::binary_codec_magic) + 1);
+   if ((p[0] != detail::binary_codec_magic[0]) || (p[1] != detail::binary_codec_magic[1]))
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Input is not a binary encoded array of multiprecision values."));
+   }
+   if ((p[2] == 0) || (p[2] > detail::binary_codec_version))
+   {
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Unsupported version of the multiprecision binary encoding."));
+   }
+   // Every value takes at least one byte, which bounds the count before we allocate anything:
+   std::size_t count = r.read_size();
+   values.resize(count);
+   for (std::size_t i = 0; i < count; ++i)
+      eval_binary_decode(r, values[i].backend());
+   return r.position();
+}
+
+#ifdef BOOST_MP_HAS_STD_SPAN
+//
+// std::span versions return the part of the buffer that was not used:
+//
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::span<unsigned char> binary_encode(const number<Backend, ExpressionTemplates>& val, std::span<unsigned char> buffer)
+{
+   return buffer.subspan(static_cast<std::size_t>(binary_encode(val, buffer.data(), buffer.data() + buffer.size()) - buffer.data()));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::span<const unsigned char> binary_decode(number<Backend, ExpressionTemplates>& val, std::span<const unsigned char> buffer)
+{
+   return buffer.subspan(static_cast<std::size_t>(binary_decode(val, buffer.data(), buffer.data() + buffer.size()) - buffer.data()));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates>
+inline std::span<unsigned char> binary_encode_array(std::span<const number<Backend, ExpressionTemplates> > values, std::span<unsigned char> buffer)
+{
+   return buffer.subspan(static_cast<std::size_t>(binary_encode_array(values.data(), values.size(), buffer.data(), buffer.data() + buffer.size()) - buffer.data()));
+}
+
+template <class Backend, expression_template_option ExpressionTemplates, class Allocator>
+inline std::span<const unsigned char> binary_decode_array(std::vector<number<Backend, ExpressionTemplates>, Allocator>& values, std::span<const unsigned char> buffer)
+{
+   return buffer.subspan(static_cast<std::size_t>(binary_decode_array(values, buffer.data(), buffer.data() + buffer.size()) - buffer.data()));
+}
+#endif
+
+}} // namespace boost::multiprecision
+
+#endif // BOOST_MP_DETAIL_BINARY_CODEC_HPP
@@ -0,0 +1,205 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MP_DETAIL_BINARY_SPLITTING_HPP
+#define BOOST_MP_DETAIL_BINARY_SPLITTING_HPP
+
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cmath>
+#include <cstdint>
+
+#ifdef BOOST_HAS_THREADS
+#include <future>
+#include <thread>
+#endif
+
+namespace boost { namespace multiprecision { namespace detail {
+
+//
+// Evaluation of pi, ln(2) and e to high precision by binary splitting, see:
+//
+// Haible, B., and Papanikolaou, T. Fast multiprecision evaluation of series of rational numbers, 1997.
+//
+// A series SUM[n] a(n)/b(n) p(0)...p(n)/q(0)...q(n) with small integer a, b, p and q is
+// summed over n in [n1, n2) as the integers
+//
+// P = p(n1)...p(n2-1), Q = q(n1)...q(n2-1), B = b(n1)...b(n2-1)
+//
+// T = B Q SUM[n1 <= n < n2] a(n)/b(n) p(n1)...p(n)/q(n1)...q(n)
+//
+// which are found by splitting the range in two and combining the halves, so that the
+// work is dominated by a few multiplications of large numbers at the top of the tree.
+// The two halves are independent, and the largest subtrees are evaluated in parallel
+// when threads are available.  Each function returns its constant scaled by an integer
+// and truncated, the caller rounds this to the precision of the type.
+//
+struct binary_splitting_terms
+{
+   cpp_int P, Q, B, T;
+};
+
+//
+// Ranges with fewer terms than this are never split between threads:
+//
+constexpr std::uint64_t binary_splitting_thread_min_terms = 2000;
+
+template <class Leaf>
+void binary_split(binary_splitting_terms& result, std::uint64_t n1, std::uint64_t n2, const Leaf& leaf, unsigned threads)
+{
+   if (n2 - n1 == 1)
+   {
+      leaf(result, n1);
+      return;
+   }
+   const std::uint64_t    mid = n1 + (n2 - n1) / 2;
+   binary_splitting_terms right;
+#ifdef BOOST_HAS_THREADS
+   if ((threads > 1) && (n2 - n1 >= binary_splitting_thread_min_terms))
+   {
+      std::future<void> f = std::async(std::launch::async, [&right, mid, n2, &leaf, threads]() { binary_split(right, mid, n2, leaf, threads - threads / 2); });
+      binary_split(result, n1, mid, leaf, threads / 2);
+      f.get();
+   }
+   else
+#endif
+   {
+      binary_split(result, n1, mid, leaf, threads);
+      binary_split(right, mid, n2, leaf, threads);
+   }
+   //
+   // T = B(right) Q(right) T(left) + B(left) P(left) T(right):
+   //
+   result.T *= right.B;
+   result.T *= right.Q;
+   right.T *= result.B;
+   right.T *= result.P;
+   result.T += right.T;
+   result.P *= right.P;
+   result.Q *= right.Q;
+   result.B *= right.B;
+}
+
+template <class Leaf>
+void binary_split(binary_splitting_terms& result, std::uint64_t terms, const Leaf& leaf)
+{
+   unsigned threads = 1;
+#ifdef BOOST_HAS_THREADS
+   threads = (std::max)(std::thread::hardware_concurrency(), 1u);
+#endif
+   binary_split(result, 0, terms, leaf, threads);
+}
+
+//
+// Returns floor(pi * scale), computed to at least bits binary digits, from the
+// Chudnovsky series:
+//
+// 1/pi = 12 SUM[n>=0] (-1)^n (6n)! (13591409 + 545140134n) / ((3n)! n!^3 640320^(3n+3/2))
+//
+// which gives a little over 14 decimal digits per term.
+//
+inline cpp_int binary_splitting_pi(const cpp_int& scale, std::size_t bits)
+{
+   const std::uint64_t terms = static_cast<std::uint64_t>(static_cast<double>(bits) / 47.11) + 2;
+
+   binary_splitting_terms r;
+   binary_split(r, terms, [](binary_splitting_terms& t, std::uint64_t n) {
+      t.B = 1u;
+      if (n == 0)
+      {
+         t.P = 1u;
+         t.Q = 1u;
+      }
+      else
+      {
+         t.P = 6 * n - 5;
+         t.P *= 2 * n - 1;
+         t.P *= 6 * n - 1;
+         t.Q = n;
+         t.Q *= n;
+         t.Q *= n;
+         t.Q *= static_cast<std::uint64_t>(10939058860032000uLL); // 640320^3 / 24
+      }
+      t.T = 545140134u;
+      t.T *= n;
+      t.T += 13591409u;
+      t.T *= t.P;
+      if (n & 1u)
+         t.T = -t.T;
+   });
+   //
+   // pi = 426880 sqrt(10005) Q / T:
+   //
+   cpp_int result = sqrt(cpp_int(scale * scale * 10005u));
+   result *= 426880u;
+   result *= r.Q;
+   result /= r.T;
+   return result;
+}
+
+//
+// Returns floor(atanh(1/k) * scale) computed to at least bits binary digits, from:
+//
+// atanh(1/k) = SUM[n>=0] 1 / ((2n+1) k^(2n+1))
+//
+inline cpp_int binary_splitting_atanh_inverse(std::uint32_t k, const cpp_int& scale, std::size_t bits)
+{
+   const std::uint64_t terms = static_cast<std::uint64_t>(static_cast<double>(bits) / (2 * std::log2(static_cast<double>(k)))) + 2;
+
+   binary_splitting_terms r;
+   binary_split(r, terms, [k](binary_splitting_terms& t, std::uint64_t n) {
+      t.P = 1u;
+      t.Q = k;
+      if (n)
+         t.Q *= k;
+      t.B = 2 * n + 1;
+      t.T = 1u;
+   });
+   cpp_int result = scale * r.T;
+   result /= r.Q;
+   result /= r.B;
+   return result;
+}
+
+//
+// Returns floor(ln(2) * scale), computed to at least bits binary digits, from:
+//
+// ln(2) = 18 atanh(1/26) - 2 atanh(1/4801) + 8 atanh(1/8749)
+//
+inline cpp_int binary_splitting_ln2(const cpp_int& scale, std::size_t bits)
+{
+   cpp_int result = binary_splitting_atanh_inverse(26u, scale, bits) * 18u;
+   result -= binary_splitting_atanh_inverse(4801u, scale, bits) * 2u;
+   result += binary_splitting_atanh_inverse(8749u, scale, bits) * 8u;
+   return result;
+}
+
+//
+// Returns floor(e * scale), computed to at least bits binary digits, from:
+//
+// e = SUM[n>=0] 1 / n!
+//
+inline cpp_int binary_splitting_e(const cpp_int& scale, std::size_t bits)
+{
+   std::uint64_t terms  = 2;
+   double        log2_f = 0;
+   while (log2_f < static_cast<double>(bits) + 2)
+      log2_f += std::log2(static_cast<double>(terms++));
+
+   binary_splitting_terms r;
+   binary_split(r, terms, [](binary_splitting_terms& t, std::uint64_t n) {
+      t.P = 1u;
+      t.Q = n ? n : 1u;
+      t.B = 1u;
+      t.T = 1u;
+   });
+   cpp_int result = scale * r.T;
+   result /= r.Q;
+   return result;
+}
+
+}}} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_DETAIL_BINARY_SPLITTING_HPP
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MP_DETAIL_CONSTANT_CACHE_HPP
+#define BOOST_MP_DETAIL_CONSTANT_CACHE_HPP
+
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/precision.hpp>
+#include <algorithm>
+#include <memory>
+
+#ifdef BOOST_HAS_THREADS
+#include <atomic>
+#include <mutex>
+#endif
+
+namespace boost { namespace multiprecision { namespace detail {
+
+//
+// Process wide storage for a mathematical constant of type T, shared by all threads.
+// Each value computed is published as an immutable node which is not freed until
+// program exit, so finding an existing value requires only an acquire load.  The
+// head of the list always holds the most precise value computed so far.  A more
+// precise value is computed under a lock, so threads needing it wait for the first
+// rather than repeating the work; the computation must not use the same cache.
+//
+template <class T, class Tag>
+class constant_cache
+{
+ public:
+   struct node
+   {
+      T           value;
+      long        digits; // binary digits in value
+      const node* next;
+   };
+
+   //
+   // Returns the most precise value, or null if there is none with at least digits bits:
+   //
+   static const node* find(long digits) noexcept
+   {
+#ifdef BOOST_HAS_THREADS
+      const node* p = instance().m_head.load(std::memory_order_acquire);
+#else
+      const node* p = instance().m_head;
+#endif
+      return p && (p->digits >= digits) ? p : nullptr;
+   }
+   //
+   // As above, but computes the value when needed by calling calc(value, bits), at
+   // least digits bits and, for variable precision types, with value and the thread
+   // default precision set to bits.  To make repeated upgrades cheap, each new value
+   // has at least 1.5 times the precision of the last:
+   //
+   template <class F>
+   static const node* get(long digits, F calc)
+   {
+      if (const node* p = find(digits))
+         return p;
+      constant_cache& c = instance();
+#ifdef BOOST_HAS_THREADS
+      std::lock_guard<std::mutex> lock(c.m_mutex);
+      const node*                 head = c.m_head.load(std::memory_order_relaxed);
+#else
+      const node* head = c.m_head;
+#endif
+      if (head && (head->digits >= digits))
+         return head;
+      if (head && is_variable_precision<T>::value)
+         digits = (std::max)(digits, head->digits + head->digits / 2);
+
+      scoped_precision_options<number<T> > scope(static_cast<unsigned>(digits2_2_10(digits) + 1));
+      std::unique_ptr<node> n(new node{T(), digits2<number<T> >::value(), head});
+      calc(n->value, n->digits);
+#ifdef BOOST_HAS_THREADS
+      c.m_head.store(n.get(), std::memory_order_release);
+#else
+      c.m_head = n.get();
+#endif
+      return n.release();
+   }
+
+ private:
+   constant_cache() noexcept : m_head(nullptr) {}
+   ~constant_cache()
+   {
+#ifdef BOOST_HAS_THREADS
+      const node* p = m_head.load(std::memory_order_relaxed);
+#else
+      const node* p = m_head;
+#endif
+      while (p)
+      {
+         const node* next = p->next;
+         delete p;
+         p = next;
+      }
+   }
+   constant_cache(const constant_cache&)            = delete;
+   constant_cache& operator=(const constant_cache&) = delete;
+
+   static constant_cache& instance() noexcept
+   {
+      static constant_cache c;
+      return c;
+   }
+
+#ifdef BOOST_HAS_THREADS
+   std::atomic<const node*> m_head;
+   std::mutex               m_mutex;
+#else
+   const node* m_head;
+#endif
+};
+
+}}} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_DETAIL_CONSTANT_CACHE_HPP
@@ -13,6 +13,7 @@
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/traits/is_backend.hpp>
 #include <boost/multiprecision/detail/fpclassify.hpp>
+#include <boost/multiprecision/detail/constant_cache.hpp>
 #include <cstdint>
 #include <complex>
 #ifndef BOOST_NO_CXX17_HDR_STRING_VIEW
@@ -2125,6 +2126,19 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_imag(To& to, const From&)
    using ui_type = typename std::tuple_element<0, typename To::unsigned_types>::type;
    to = ui_type(0);
 }
+//
+// Squared magnitude of a complex number, backends may overload this to save copying the parts:
+//
+template <class To, class From>
+inline BOOST_MP_CXX14_CONSTEXPR void eval_norm(To& to, const From& from)
+{
+   To t;
+   eval_real(to, from);
+   eval_multiply(to, to);
+   eval_imag(t, from);
+   eval_multiply(t, t);
+   eval_add(to, t);
+}
 
 } // namespace default_ops
 namespace default_ops_adl {
@@ -2187,6 +2201,36 @@ void BOOST_MP_CXX14_CONSTEXPR eval_set_imag(T&, const T&)
 
 } // namespace default_ops
 
+namespace detail {
+
+template <class Number>
+inline void preload_constants(unsigned, const std::integral_constant<bool, false>&)
+{
+   using backend_type = typename Number::backend_type;
+   default_ops::get_constant_pi<backend_type>();
+   default_ops::get_constant_e<backend_type>();
+   default_ops::get_constant_ln2<backend_type>();
+}
+template <class Number>
+inline void preload_constants(unsigned digits10, const std::integral_constant<bool, true>&)
+{
+   scoped_precision_options<Number> scope(digits10 ? digits10 : Number::thread_default_precision());
+   preload_constants<Number>(digits10, std::integral_constant<bool, false>());
+}
+
+} // namespace detail
+
+//
+// Computes pi, e and ln(2) for type Number and stores them in the process wide cache, so
+// that later use from any thread need not compute them.  For variable precision types,
+// digits10 is the precision required, or zero for the current default precision:
+//
+template <class Number>
+inline void preload_constants(unsigned digits10 = 0)
+{
+   detail::preload_constants<Number>(digits10, std::integral_constant<bool, detail::is_variable_precision<Number>::value>());
+}
+
 //
 // Default versions of floating point classification routines:
 //
@@ -2395,8 +2439,12 @@ template <class T, expression_template_option ExpressionTemplates>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<T>::value == number_kind_complex, component_type<number<T, ExpressionTemplates>>>::type::type
 norm(const number<T, ExpressionTemplates>& v)
 {
-   typename component_type<number<T, ExpressionTemplates> >::type a(real(v)), b(imag(v));
-   return a * a + b * b;
+   using default_ops::eval_norm;
+   using result_type = typename component_type<number<T, ExpressionTemplates> >::type;
+   boost::multiprecision::detail::scoped_default_precision<result_type> precision_guard(v);
+   result_type                                                          result;
+   eval_norm(result.backend(), v.backend());
+   return result;
 }
 template <class T, expression_template_option ExpressionTemplates>
 inline BOOST_MP_CXX14_CONSTEXPR typename std::enable_if<number_category<T>::value != number_kind_complex, typename scalar_result_from_possible_complex<number<T, ExpressionTemplates> >::type>::type
@@ -6,6 +6,12 @@
 // This file has no include guards or namespaces - it's expanded inline inside default_ops.hpp
 //
 
+//
+// Below this many binary digits the constants are read from the strings stored here,
+// 3640 binary digits being about 1100 decimal digits:
+//
+constexpr unsigned constant_string_bits = 3640;
+
 template <class T>
 void calc_log2(T& num, unsigned digits)
 {
@@ -30,7 +36,7 @@ void calc_log2(T& num, unsigned digits)
    //
    // Check if we can just construct from string:
    //
-   if (digits < 3640) // 3640 binary digits ~ 1100 decimal digits
+   if (digits < constant_string_bits)
    {
       num = string_val;
       return;
@@ -99,7 +105,7 @@ void calc_e(T& result, unsigned digits)
    //
    // Check if we can just construct from string:
    //
-   if (digits < 3640) // 3640 binary digits ~ 1100 decimal digits
+   if (digits < constant_string_bits)
    {
       result = string_val;
       return;
@@ -149,7 +155,7 @@ void calc_pi(T& result, unsigned digits)
    //
    // Check if we can just construct from string:
    //
-   if (digits < 3640) // 3640 binary digits ~ 1100 decimal digits
+   if (digits < constant_string_bits)
    {
       result = string_val;
       return;
@@ -216,49 +222,65 @@ void calc_pi(T& result, unsigned digits)
    eval_divide(result, B, D);
 }
 
-template <class T>
-const T& get_constant_ln2()
+//
+// Constants are computed once per process and shared between threads (see constant_cache).
+// Fixed precision types refer to the shared value directly, variable precision types keep
+// a thread local copy rounded from it, so that a change of precision usually costs only a
+// copy.  The shared value carries guard bits so that this second rounding is all but
+// certain to give the same result as computing at the current precision:
+//
+struct constant_ln2_tag {};
+struct constant_e_tag {};
+struct constant_pi_tag {};
+
+constexpr long constant_guard_bits = 64;
+
+template <class T, class Tag, class F>
+const T& get_cached_constant(F calc, const std::integral_constant<bool, false>&)
+{
+   return boost::multiprecision::detail::constant_cache<T, Tag>::get(boost::multiprecision::detail::digits2<number<T> >::value(), calc)->value;
+}
+
+template <class T, class Tag, class F>
+const T& get_cached_constant(F calc, const std::integral_constant<bool, true>&)
 {
    static BOOST_MP_THREAD_LOCAL T    result;
    static BOOST_MP_THREAD_LOCAL long digits = 0;
-   if ((digits != boost::multiprecision::detail::digits2<number<T> >::value()))
+   const long                        current = boost::multiprecision::detail::digits2<number<T> >::value();
+   if (digits != current)
    {
+      const T& value = boost::multiprecision::detail::constant_cache<T, Tag>::get(current + constant_guard_bits, calc)->value;
       boost::multiprecision::detail::maybe_promote_precision(&result);
-      calc_log2(result, boost::multiprecision::detail::digits2<number<T, et_on> >::value());
-      digits = boost::multiprecision::detail::digits2<number<T> >::value();
+      boost::multiprecision::detail::scoped_target_precision<number<T> > scope;
+      result = value;
+      digits = current;
    }
 
    return result;
 }
 
+template <class T, class Tag, class F>
+inline const T& get_cached_constant(F calc)
+{
+   return get_cached_constant<T, Tag>(calc, std::integral_constant<bool, boost::multiprecision::detail::is_variable_precision<T>::value>());
+}
+
 template <class T>
-const T& get_constant_e()
+const T& get_constant_ln2()
 {
-   static BOOST_MP_THREAD_LOCAL T    result;
-   static BOOST_MP_THREAD_LOCAL long digits = 0;
-   if ((digits != boost::multiprecision::detail::digits2<number<T> >::value()))
-   {
-      boost::multiprecision::detail::maybe_promote_precision(&result);
-      calc_e(result, boost::multiprecision::detail::digits2<number<T, et_on> >::value());
-      digits = boost::multiprecision::detail::digits2<number<T> >::value();
-   }
+   return get_cached_constant<T, constant_ln2_tag>([](T& result, long digits) { calc_log2(result, static_cast<unsigned>(digits)); });
+}
 
-   return result;
+template <class T>
+const T& get_constant_e()
+{
+   return get_cached_constant<T, constant_e_tag>([](T& result, long digits) { calc_e(result, static_cast<unsigned>(digits)); });
 }
 
 template <class T>
 const T& get_constant_pi()
 {
-   static BOOST_MP_THREAD_LOCAL T             result;
-   static BOOST_MP_THREAD_LOCAL long digits = 0;
-   if ((digits != boost::multiprecision::detail::digits2<number<T> >::value()))
-   {
-      boost::multiprecision::detail::maybe_promote_precision(&result);
-      calc_pi(result, boost::multiprecision::detail::digits2<number<T, et_on> >::value());
-      digits = boost::multiprecision::detail::digits2<number<T> >::value();
-   }
-
-   return result;
+   return get_cached_constant<T, constant_pi_tag>([](T& result, long digits) { calc_pi(result, static_cast<unsigned>(digits)); });
 }
 #ifdef BOOST_MSVC
 #pragma warning(push)
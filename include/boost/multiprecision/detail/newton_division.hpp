@@ -0,0 +1,185 @@
+///////////////////////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MP_DETAIL_NEWTON_DIVISION_HPP
+#define BOOST_MP_DETAIL_NEWTON_DIVISION_HPP
+
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <cstddef>
+
+namespace boost { namespace multiprecision { namespace detail {
+
+//
+// Integer division and square root by Newton iteration, for operands so large that
+// the cost of a multiplication grows more slowly than that of long (or recursive)
+// division, see:
+//
+// Brent, R. P., and Zimmermann, P. Modern Computer Arithmetic, 2010, sections 3.4 and 3.5.
+//
+// The reciprocal and inverse square root are found to half the precision of the
+// result with the precision doubling at each step, then a single Karp-Markstein step
+// extends the quotient or root to full precision.  The result is within a few units
+// in the last place, so the caller computes a few bits more than it needs and falls
+// back on exact division (or square root) in the rare cases where those bits lie too
+// close to a rounding boundary to be sure which way to round.
+//
+// Below this many bits the reciprocal and inverse square root are found directly:
+//
+#ifdef BOOST_MP_NEWTON_BASE_BITS
+constexpr std::size_t newton_base_bits = BOOST_MP_NEWTON_BASE_BITS;
+#else
+constexpr std::size_t newton_base_bits = 4000;
+#endif
+//
+// Extra bits carried at each step, so that the errors in each approximation stay
+// within a few units in the last place:
+//
+constexpr std::size_t newton_guard_bits = 8;
+//
+// The largest error in the quotient or root, in units of the last place:
+//
+constexpr unsigned newton_max_error = 8;
+
+//
+// Returns a value within a few units of 2^(2n) / v, where 2^(n-1) <= v < 2^n.
+//
+inline cpp_int newton_reciprocal(const cpp_int& v, std::size_t n)
+{
+   cpp_int x(1u);
+   if (n <= newton_base_bits)
+   {
+      x <<= 2 * n;
+      return x / v;
+   }
+   const std::size_t h = n / 2 + newton_guard_bits;
+   x = newton_reciprocal(cpp_int(v >> (n - h)), h);
+   //
+   // x is close to 2^(n+h) / v, and one Newton step gives:
+   //
+   // x 2^(n-h) + x (2^(n+h) - v x) / 2^(2h)
+   //
+   // where only the leading h bits or so of the correction are needed:
+   //
+   cpp_int e(1u);
+   e <<= n + h;
+   e -= v * x;
+   const std::size_t s = h - 2 * newton_guard_bits;
+   e >>= s;
+   e *= x;
+   e >>= 2 * h - s;
+   x <<= n - h;
+   x += e;
+   return x;
+}
+
+//
+// Returns a value within a few units of 2^(2n) / sqrt(a), where 2^(2n-2) <= a < 2^(2n).
+//
+inline cpp_int newton_inverse_sqrt(const cpp_int& a, std::size_t n)
+{
+   cpp_int z(1u);
+   if (n <= newton_base_bits)
+   {
+      z <<= 4 * n;
+      z /= a;
+      return sqrt(z);
+   }
+   const std::size_t h = n / 2 + newton_guard_bits;
+   z = newton_inverse_sqrt(cpp_int(a >> 2 * (n - h)), h);
+   //
+   // z is close to 2^(n+h) / sqrt(a), and one Newton step gives:
+   //
+   // z 2^(n-h) + z (2^(2n+2h) - a z^2) / 2^(n+3h+1)
+   //
+   // where a is truncated to the bits that affect the leading h bits of the correction:
+   //
+   const std::size_t s = 2 * n - 2 * h - newton_guard_bits;
+   cpp_int           e(1u);
+   e <<= 2 * n + 2 * h - s;
+   e -= (a >> s) * (z * z);
+   e >>= 2 * h;
+   e *= z;
+   e >>= n + h + 1 - s;
+   z <<= n - h;
+   z += e;
+   return z;
+}
+
+//
+// Returns a value within newton_max_error of t / v, where 2^(n-1) <= v < 2^n and 0 <= t < 2^(2n).
+//
+inline cpp_int newton_quotient(const cpp_int& t, const cpp_int& v, std::size_t n)
+{
+   const std::size_t h = n / 2 + newton_guard_bits;
+   const std::size_t l = n - h + newton_guard_bits;
+   const cpp_int     x = newton_reciprocal(cpp_int(v >> (n - h)), h);
+   //
+   // x is close to 2^(n+h) / v, giving the leading h bits or so of the quotient
+   // from the leading bits of t:
+   //
+   const std::size_t s1 = 2 * n - h - newton_guard_bits;
+   cpp_int           q  = t >> s1;
+   q *= x;
+   q >>= n + h + l - s1;
+   cpp_int r = q * v;
+   r <<= l;
+   r = t - r;
+   //
+   // Then the remaining l bits from the leading bits of the remainder:
+   //
+   const std::size_t s2 = n - newton_guard_bits;
+   r >>= s2;
+   r *= x;
+   r >>= n + h - s2;
+   q <<= l;
+   q += r;
+   return q;
+}
+
+//
+// Returns a value within newton_max_error of sqrt(a), where 2^(2n-2) <= a < 2^(2n).
+//
+inline cpp_int newton_root(const cpp_int& a, std::size_t n)
+{
+   const std::size_t h = n / 2 + newton_guard_bits;
+   const std::size_t l = n - h + newton_guard_bits;
+   const cpp_int     z = newton_inverse_sqrt(cpp_int(a >> 2 * (n - h)), h);
+   //
+   // z is close to 2^(n+h) / sqrt(a), and sqrt(a) = a / sqrt(a) gives the leading
+   // h bits or so of the root from the leading bits of a:
+   //
+   const std::size_t s1 = 2 * n - h - newton_guard_bits;
+   cpp_int           s  = a >> s1;
+   s *= z;
+   s >>= n + h + l - s1;
+   s <<= l;
+   cpp_int r = a - s * s;
+   //
+   // Then the remaining l bits from r / (2 sqrt(a)):
+   //
+   const std::size_t s2 = n - newton_guard_bits;
+   r >>= s2;
+   r *= z;
+   r >>= n + h + 1 - s2;
+   s += r;
+   return s;
+}
+
+//
+// Returns true if every value within newton_max_error of x rounds the same way,
+// when the low bits of x are discarded: that is when no multiple of 2^(bits - 1)
+// lies within newton_max_error of x.
+//
+inline bool newton_can_round(const cpp_int& x, std::size_t bits)
+{
+   const cpp_int lo = (x - newton_max_error) >> (bits - 1);
+   const cpp_int hi = (x + newton_max_error) >> (bits - 1);
+   return (lo == hi) && ((lo << (bits - 1)) != x - newton_max_error);
+}
+
+}}} // namespace boost::multiprecision::detail
+
+#endif // BOOST_MP_DETAIL_NEWTON_DIVISION_HPP
@@ -14,8 +14,14 @@
 #ifndef BOOST_MP_UNIFORM_INT_DISTRIBUTION_HPP
 #define BOOST_MP_UNIFORM_INT_DISTRIBUTION_HPP
 
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <iterator>
 #include <limits>
 #include <type_traits>
+#include <utility>
+#include <boost/multiprecision/fwd.hpp>
 #include <boost/multiprecision/detail/standalone_config.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/traits/std_integer_traits.hpp>
@@ -147,6 +153,171 @@ T generate_uniform_int (Engine& eng, T min_value, T max_value)
     }
 }
 
+//
+// Fast path for multiprecision integers whose backend exposes its limbs: rather than
+// building the result up one engine word at a time with multiprecision arithmetic,
+// engine output is written straight into the limbs of the result.  This requires an
+// engine whose range is 2^k - 1 for some k (true of all the usual engines), the
+// backend supplies:
+//
+//    void eval_uniform_int(uniform_limb_source<Engine>&, Backend& result, const Backend& range);
+//
+// which sets result to a uniformly distributed value in [0, range] for range > 0,
+// usually by calling generate_uniform_limbs below.
+//
+template <typename Engine>
+class uniform_limb_source
+{
+    using base_result = typename Engine::result_type;
+    using base_unsigned = typename boost::multiprecision::detail::make_unsigned_mp<base_result>::type;
+
+    Engine&     m_eng;
+    base_result m_min;
+    unsigned    m_bits;
+
+public:
+    explicit uniform_limb_source(Engine& eng) : m_eng(eng), m_min((eng.min)()), m_bits(0)
+    {
+        const base_unsigned brange = static_cast<base_unsigned>((eng.max)() - (eng.min)());
+        if ((brange & static_cast<base_unsigned>(brange + 1)) == 0)
+        {
+            for (base_unsigned r = brange; r; r >>= 1)
+                ++m_bits;
+        }
+    }
+
+    // True if each engine call yields whole random bits:
+    bool valid() const { return m_bits != 0; }
+
+    // A uniformly distributed limb, from as many engine calls as are needed to fill it:
+    template <typename Limb>
+    Limb next()
+    {
+        Limb result = static_cast<Limb>(static_cast<base_unsigned>(m_eng() - m_min));
+        for (unsigned shift = m_bits; shift < sizeof(Limb) * CHAR_BIT; shift += m_bits)
+            result |= static_cast<Limb>(static_cast<Limb>(static_cast<base_unsigned>(m_eng() - m_min)) << shift);
+        return result;
+    }
+};
+
+//
+// Sets the n limbs at p (least significant first) to a uniformly distributed value in [0, range],
+// where range[n - 1] is non-zero.  Candidates are drawn with the top limb masked to the bit length
+// of the range, so each is accepted with probability greater than 1/2, and a top limb which is
+// too large is rejected before any of the lower limbs are drawn.
+//
+template <typename Engine, typename Limb>
+void generate_uniform_limbs(uniform_limb_source<Engine>& src, Limb* p, const Limb* range, std::size_t n)
+{
+    const Limb top = range[n - 1];
+    Limb       mask = top;
+    for (unsigned shift = 1; shift < sizeof(Limb) * CHAR_BIT; shift <<= 1)
+        mask |= static_cast<Limb>(mask >> shift);
+
+    for (;;)
+    {
+        const Limb t = static_cast<Limb>(src.template next<Limb>() & mask);
+        if (t > top)
+            continue;
+        for (std::size_t i = 0; i < n - 1; ++i)
+            p[i] = src.template next<Limb>();
+        p[n - 1] = t;
+        if (t < top)
+            return;
+        // The top limbs are equal, so the first lower limb which differs decides:
+        std::size_t i = n - 1;
+        while (i && (p[i - 1] == range[i - 1]))
+            --i;
+        if (!i || (p[i - 1] < range[i - 1]))
+            return;
+    }
+}
+
+template <typename Engine, typename Backend>
+struct has_uniform_limb_fill
+{
+    template <typename B>
+    static auto check(B* b) -> decltype(eval_uniform_int(std::declval<uniform_limb_source<Engine>&>(), *b, static_cast<const B&>(*b)), std::true_type());
+    static std::false_type check(...);
+
+    // Engines returning multiprecision values (independent_bits_engine for example) use the generic version:
+    static constexpr bool value = boost::multiprecision::detail::is_integral<typename Engine::result_type>::value && decltype(check(static_cast<Backend*>(nullptr)))::value;
+};
+
+template <typename Engine, typename Backend, expression_template_option ExpressionTemplates>
+inline number<Backend, ExpressionTemplates> generate_uniform_number(Engine& eng, const number<Backend, ExpressionTemplates>& min_value, const number<Backend, ExpressionTemplates>& max_value, const std::integral_constant<bool, false>&)
+{
+    return generate_uniform_int<Engine, number<Backend, ExpressionTemplates> >(eng, min_value, max_value);
+}
+
+template <typename Engine, typename Backend, expression_template_option ExpressionTemplates>
+inline number<Backend, ExpressionTemplates> generate_uniform_number(Engine& eng, const number<Backend, ExpressionTemplates>& min_value, const number<Backend, ExpressionTemplates>& max_value, const std::integral_constant<bool, true>&)
+{
+    uniform_limb_source<Engine> src(eng);
+    if (!src.valid())
+        return generate_uniform_int<Engine, number<Backend, ExpressionTemplates> >(eng, min_value, max_value);
+
+    const number<Backend, ExpressionTemplates> range = max_value - min_value;
+    if (range == 0)
+        return min_value;
+    number<Backend, ExpressionTemplates> result;
+    eval_uniform_int(src, result.backend(), range.backend());
+    result += min_value;
+    return result;
+}
+
+template <typename Engine, typename Backend, expression_template_option ExpressionTemplates>
+inline number<Backend, ExpressionTemplates> generate_uniform_int(Engine& eng, number<Backend, ExpressionTemplates> min_value, number<Backend, ExpressionTemplates> max_value)
+{
+    return generate_uniform_number(eng, min_value, max_value, std::integral_constant<bool, has_uniform_limb_fill<Engine, Backend>::value>());
+}
+
+//
+// Bulk generation, the limb filling version calculates the range just once and reuses
+// the storage of the values already in [first, last):
+//
+template <typename Engine, typename ForwardIterator, typename T>
+inline void generate_uniform_ints(Engine& eng, ForwardIterator first, ForwardIterator last, const T& min_value, const T& max_value, const std::integral_constant<bool, false>&)
+{
+    for (; first != last; ++first)
+        *first = generate_uniform_int(eng, min_value, max_value);
+}
+
+template <typename Engine, typename ForwardIterator, typename Backend, expression_template_option ExpressionTemplates>
+void generate_uniform_ints(Engine& eng, ForwardIterator first, ForwardIterator last, const number<Backend, ExpressionTemplates>& min_value, const number<Backend, ExpressionTemplates>& max_value, const std::integral_constant<bool, true>&)
+{
+    uniform_limb_source<Engine> src(eng);
+    if (!src.valid())
+        return generate_uniform_ints(eng, first, last, min_value, max_value, std::integral_constant<bool, false>());
+
+    const number<Backend, ExpressionTemplates> range = max_value - min_value;
+    if (range == 0)
+    {
+        std::fill(first, last, min_value);
+        return;
+    }
+    const bool offset = min_value != 0;
+    for (; first != last; ++first)
+    {
+        eval_uniform_int(src, (*first).backend(), range.backend());
+        if (offset)
+            *first += min_value;
+    }
+}
+
+template <typename Engine, typename ForwardIterator, typename T>
+inline void generate_uniform_ints(Engine& eng, ForwardIterator first, ForwardIterator last, const T& min_value, const T& max_value)
+{
+    generate_uniform_ints(eng, first, last, min_value, max_value, std::integral_constant<bool, false>());
+}
+
+template <typename Engine, typename ForwardIterator, typename Backend, expression_template_option ExpressionTemplates>
+inline void generate_uniform_ints(Engine& eng, ForwardIterator first, ForwardIterator last, const number<Backend, ExpressionTemplates>& min_value, const number<Backend, ExpressionTemplates>& max_value)
+{
+    using tag_type = std::integral_constant<bool, has_uniform_limb_fill<Engine, Backend>::value && std::is_same<typename std::iterator_traits<ForwardIterator>::value_type, number<Backend, ExpressionTemplates> >::value>;
+    generate_uniform_ints(eng, first, last, min_value, max_value, tag_type());
+}
+
 } // Namespace detail
 
 template <typename Integer = int>
@@ -205,6 +376,20 @@ public:
     {
         return detail::generate_uniform_int(eng, param_arg.a(), param_arg.b());
     }
+
+    // Fills [first, last) with independent samples, for multiprecision integers this avoids
+    // recalculating the range, and reuses the storage of the existing values:
+    template <typename ForwardIterator, typename Engine>
+    void generate(ForwardIterator first, ForwardIterator last, Engine& eng) const
+    {
+        detail::generate_uniform_ints(eng, first, last, min_, max_);
+    }
+
+    template <typename ForwardIterator, typename Engine>
+    void generate(ForwardIterator first, ForwardIterator last, Engine& eng, const param_type& param_arg) const
+    {
+        detail::generate_uniform_ints(eng, first, last, param_arg.a(), param_arg.b());
+    }
 };
 
 }} // Namespaces
@@ -0,0 +1,216 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_MP_FIXED_MODULUS_HPP
+#define BOOST_MP_FIXED_MODULUS_HPP
+
+#include <climits>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+//
+// Barrett reduction needs intermediates of a little over twice the width of
+// the modulus.  Unbounded types can use themselves, fixed precision types
+// need an unchecked unsigned cpp_int wide enough to hold the products:
+//
+template <class Number, bool Bounded = std::numeric_limits<Number>::is_bounded>
+struct barrett_intermediate
+{
+   using type = Number;
+};
+template <class Number>
+struct barrett_intermediate<Number, true>
+{
+   static constexpr std::size_t bits = 2 * static_cast<std::size_t>(std::numeric_limits<Number>::digits) + 2 * sizeof(limb_type) * CHAR_BIT;
+   using type = number<cpp_int_backend<bits, bits, unsigned_magnitude, unchecked, void>, et_off>;
+};
+//
+// Backends whose own division is already sub-quadratic (or otherwise faster than
+// two multiplications) gain nothing from Barrett reduction, for these fixed_modulus
+// simply stores the modulus and uses operator%:
+//
+template <class Backend>
+struct prefers_native_modulus : public std::integral_constant<bool, false>
+{};
+template <>
+struct prefers_native_modulus<backends::gmp_int> : public std::integral_constant<bool, true>
+{};
+
+} // namespace detail
+
+//
+// Reduces integers by a fixed positive modulus m.  The generic version uses Barrett's
+// method on whole numbers: the reciprocal mu = floor(4^k / m), with k the bit count of m,
+// is computed once on construction, after which each reduction of a value smaller
+// than 4^k costs two multiplications, two shifts and at most two subtractions.
+// Larger values fall back to ordinary division.
+//
+template <class Number>
+class fixed_modulus
+{
+   static_assert(number_category<Number>::value == number_kind_integer, "fixed_modulus requires an integer type.");
+   using native_tag = std::integral_constant<bool, detail::prefers_native_modulus<typename Number::backend_type>::value>;
+
+ public:
+   using number_type       = Number;
+   using intermediate_type = typename detail::barrett_intermediate<Number>::type;
+
+   explicit fixed_modulus(const number_type& m) : m_modulus(m)
+   {
+      if (m <= 0)
+      {
+         BOOST_MP_THROW_EXCEPTION(std::domain_error("fixed_modulus requires a positive modulus."));
+      }
+      m_bits       = msb(m) + 1;
+      m_wide       = static_cast<intermediate_type>(m);
+      if (!native_tag::value)
+      {
+         m_reciprocal = intermediate_type(1);
+         m_reciprocal <<= 2 * m_bits;
+         m_reciprocal /= m_wide;
+      }
+   }
+
+   const number_type& modulus() const noexcept { return m_modulus; }
+   //
+   // Returns x % modulus(), the sign of the result follows that of x
+   // just as it does for operator%:
+   //
+   number_type reduce(const number_type& x) const
+   {
+      return reduce(x, native_tag());
+   }
+   //
+   // Returns (a * b) % modulus(), the product is formed at double width
+   // so fixed precision types do not overflow:
+   //
+   number_type multiply(const number_type& a, const number_type& b) const
+   {
+      return multiply(a, b, native_tag());
+   }
+
+   friend number_type operator%(const number_type& x, const fixed_modulus& m) { return m.reduce(x); }
+
+ private:
+   static intermediate_type magnitude(const number_type& x)
+   {
+      return x.sign() < 0 ? static_cast<intermediate_type>(negate(x)) : static_cast<intermediate_type>(x);
+   }
+   static number_type negate(const number_type& x)
+   {
+      return negate(x, std::integral_constant<bool, std::numeric_limits<number_type>::is_signed>());
+   }
+   static number_type negate(const number_type& x, const std::integral_constant<bool, true>&) { return -x; }
+   static number_type negate(const number_type& x, const std::integral_constant<bool, false>&) { return x; }
+
+   number_type reduce(const number_type& x, const std::integral_constant<bool, true>&) const
+   {
+      return x % m_modulus;
+   }
+   number_type reduce(const number_type& x, const std::integral_constant<bool, false>&) const
+   {
+      number_type r = reduce_positive(magnitude(x));
+      return x.sign() < 0 ? negate(r) : r;
+   }
+   number_type multiply(const number_type& a, const number_type& b, const std::integral_constant<bool, true>&) const
+   {
+      return static_cast<number_type>((static_cast<intermediate_type>(a) * static_cast<intermediate_type>(b)) % m_wide);
+   }
+   number_type multiply(const number_type& a, const number_type& b, const std::integral_constant<bool, false>&) const
+   {
+      intermediate_type t = magnitude(a);
+      t *= magnitude(b);
+      number_type r = reduce_positive(t);
+      return (a.sign() < 0) != (b.sign() < 0) ? negate(r) : r;
+   }
+   number_type reduce_positive(intermediate_type x) const
+   {
+      if (x < m_wide)
+         return static_cast<number_type>(x);
+      if (msb(x) >= 2 * m_bits)
+      {
+         x %= m_wide;
+         return static_cast<number_type>(x);
+      }
+      intermediate_type q = x >> (m_bits - 1);
+      q *= m_reciprocal;
+      q >>= m_bits + 1;
+      q *= m_wide;
+      x -= q;
+      //
+      // The estimated quotient is never too large and at most 2 too small:
+      //
+      while (x >= m_wide)
+         x -= m_wide;
+      return static_cast<number_type>(x);
+   }
+
+   number_type       m_modulus;
+   intermediate_type m_wide, m_reciprocal;
+   std::size_t       m_bits;
+};
+//
+// cpp_int reduces directly on the limbs, see backends::barrett_engine:
+//
+template <std::size_t MinBits, std::size_t MaxBits, cpp_integer_type SignType, cpp_int_check_type Checked, class Allocator, expression_template_option ExpressionTemplates>
+class fixed_modulus<number<backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>, ExpressionTemplates> >
+{
+   using backend_type = backends::cpp_int_backend<MinBits, MaxBits, SignType, Checked, Allocator>;
+   using wide_type    = typename std::conditional<
+       backends::is_trivial_cpp_int<backend_type>::value,
+       backends::barrett_engine::backend_type,
+       typename default_ops::double_precision_type<backend_type>::type>::type;
+
+ public:
+   using number_type = number<backend_type, ExpressionTemplates>;
+
+   explicit fixed_modulus(const number_type& m) : m_modulus(m), m_engine(wide_type(m.backend())) {}
+
+   const number_type& modulus() const noexcept { return m_modulus; }
+
+   number_type reduce(const number_type& x) const
+   {
+      return reduce(x, std::integral_constant<bool, backends::is_trivial_cpp_int<backend_type>::value>());
+   }
+   number_type multiply(const number_type& a, const number_type& b) const
+   {
+      wide_type t;
+      eval_multiply(t, wide_type(a.backend()), wide_type(b.backend()));
+      m_engine.reduce(t, t);
+      number_type r;
+      r.backend() = t;
+      return r;
+   }
+
+   friend number_type operator%(const number_type& x, const fixed_modulus& m) { return m.reduce(x); }
+
+ private:
+   number_type reduce(const number_type& x, const std::integral_constant<bool, false>&) const
+   {
+      number_type r;
+      m_engine.reduce(r.backend(), x.backend());
+      return r;
+   }
+   number_type reduce(const number_type& x, const std::integral_constant<bool, true>&) const
+   {
+      // Single word types have nothing to gain:
+      return x % m_modulus;
+   }
+
+   number_type              m_modulus;
+   backends::barrett_engine m_engine;
+};
+
+}} // namespace boost::multiprecision
+
+#endif
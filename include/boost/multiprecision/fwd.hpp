@@ -121,7 +121,12 @@ namespace boost {
          template <>
          struct mpfr_float_backend<0, allocate_stack>;
 
-         template <class Backend>
+         struct eager_normalize;
+
+         template <std::size_t ThresholdBits = 2048>
+         struct lazy_normalize;
+
+         template <class Backend, class NormalizePolicy = eager_normalize>
          struct rational_adaptor;
 
          struct tommath_int;
@@ -143,6 +148,8 @@ namespace boost {
       using boost::multiprecision::backends::mpfi_float_backend;
       using boost::multiprecision::backends::mpfr_float_backend;
       using boost::multiprecision::backends::rational_adaptor;
+      using boost::multiprecision::backends::eager_normalize;
+      using boost::multiprecision::backends::lazy_normalize;
       using boost::multiprecision::backends::tommath_int;
 
       template <unsigned Digits, backends::digit_base_type DigitBase, class Allocator, class Exponent, Exponent MinE, Exponent MaxE>
@@ -157,8 +164,8 @@ namespace boost {
          static constexpr expression_template_option value = et_off;
       };
 
-      template <class IntBackend>
-      struct expression_template_default<backends::rational_adaptor<IntBackend> > : public expression_template_default<IntBackend>
+      template <class IntBackend, class NormalizePolicy>
+      struct expression_template_default<backends::rational_adaptor<IntBackend, NormalizePolicy> > : public expression_template_default<IntBackend>
       {};
 
       using complex128 = number<complex_adaptor<float128_backend>, et_off>;
@@ -19,6 +19,7 @@
 #include <boost/multiprecision/detail/assert.hpp>
 #include <boost/multiprecision/detail/fpclassify.hpp>
 #include <boost/multiprecision/detail/string_helpers.hpp>
+#include <boost/multiprecision/detail/uniform_int_distribution.hpp>
 #include <algorithm>
 #include <cctype>
 #include <cfloat>
@@ -2363,6 +2364,23 @@ inline std::size_t hash_value(const gmp_int& val)
    return result;
 }
 
+//
+// Limb filling for uniform_int_distribution, range is positive.  As above we avoid
+// mpz_limbs_write for the sake of older versions:
+//
+template <class Engine>
+inline void eval_uniform_int(boost::multiprecision::detail::uniform_limb_source<Engine>& src, gmp_int& result, const gmp_int& range)
+{
+   const int n = range.data()[0]._mp_size;
+   if (result.data()[0]._mp_alloc < n)
+      mpz_realloc2(result.data(), static_cast<mp_bitcnt_t>(n) * GMP_NUMB_BITS);
+   boost::multiprecision::detail::generate_uniform_limbs(src, result.data()[0]._mp_d, range.data()[0]._mp_d, static_cast<std::size_t>(n));
+   int size = n;
+   while (size && !result.data()[0]._mp_d[size - 1])
+      --size;
+   result.data()[0]._mp_size = size;
+}
+
 struct gmp_rational;
 void eval_add(gmp_rational& t, const gmp_rational& o);
 
@@ -0,0 +1,206 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// A thread local arena from which cpp_int's using limb_arena_allocator draw
+// their storage while a scoped_limb_arena is active:
+//
+
+#ifndef BOOST_MP_LIMB_ARENA_HPP
+#define BOOST_MP_LIMB_ARENA_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/detail/assert.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+struct limb_arena_block;
+//
+// Storage is handed out in whole units, each allocation is preceded by one unit
+// recording the block it came from (null for allocations made outside any arena):
+//
+union limb_arena_unit
+{
+   limb_arena_block* block;
+   limb_type         limb;
+};
+
+struct limb_arena_block
+{
+   std::size_t       references; // live allocations, plus one while the arena is alive
+   std::size_t       capacity;   // units in data()
+   std::size_t       used;
+   limb_arena_block* previous;
+   bool              owned;      // the arena is still alive
+   limb_arena_unit*  data() noexcept { return reinterpret_cast<limb_arena_unit*>(this + 1); }
+};
+static_assert(sizeof(limb_arena_block) % sizeof(limb_arena_unit) == 0, "Arena block header must be a whole number of units");
+
+class limb_arena
+{
+ public:
+   explicit limb_arena(std::size_t initial_units) noexcept : m_block(nullptr), m_next_size(initial_units), m_enclosing(current())
+   {
+      current() = this;
+   }
+   ~limb_arena()
+   {
+      BOOST_MP_ASSERT(current() == this);
+      current() = m_enclosing;
+      //
+      // Blocks still holding live allocations (values which escaped the scope) are
+      // kept until the last of those is released:
+      //
+      while (m_block)
+      {
+         limb_arena_block* b = m_block;
+         m_block             = b->previous;
+         release(b);
+      }
+   }
+   limb_arena(const limb_arena&)            = delete;
+   limb_arena& operator=(const limb_arena&) = delete;
+
+   static limb_arena*& current() noexcept
+   {
+      static BOOST_MP_THREAD_LOCAL limb_arena* p = nullptr;
+      return p;
+   }
+
+   limb_arena_unit* allocate(std::size_t units)
+   {
+      ++units; // header
+      if (!m_block || (m_block->capacity - m_block->used < units))
+         new_block(units);
+      limb_arena_unit* p = m_block->data() + m_block->used;
+      m_block->used += units;
+      ++m_block->references;
+      p->block = m_block;
+      return p + 1;
+   }
+   static void deallocate(limb_arena_unit* p, std::size_t units) noexcept
+   {
+      limb_arena_block* b = (--p)->block;
+      ++units;
+      // Temporaries are mostly released in the reverse order of allocation, so the
+      // space can be reused immediately just as with scoped_shared_storage:
+      if (p + units == b->data() + b->used)
+         b->used -= units;
+      if (!--b->references)
+         ::operator delete(b);
+      else if (b->owned && (b->references == 1))
+         b->used = 0; // only the arena itself still refers to this block
+   }
+
+ private:
+   void new_block(std::size_t units)
+   {
+      std::size_t capacity = (std::max)(units, m_next_size);
+      if (m_next_size < max_block_units)
+         m_next_size *= 2;
+      limb_arena_block* b = static_cast<limb_arena_block*>(::operator new(sizeof(limb_arena_block) + capacity * sizeof(limb_arena_unit)));
+      b->references       = 1;
+      b->capacity         = capacity;
+      b->used             = 0;
+      b->previous         = m_block;
+      b->owned            = true;
+      m_block             = b;
+   }
+   static void release(limb_arena_block* b) noexcept
+   {
+      b->owned = false;
+      if (!--b->references)
+         ::operator delete(b);
+   }
+
+   static constexpr std::size_t max_block_units = (std::size_t(1) << 20) / sizeof(limb_arena_unit);
+
+   limb_arena_block* m_block;
+   std::size_t       m_next_size;
+   limb_arena*       m_enclosing;
+};
+
+} // namespace detail
+
+//
+// A stateless allocator which draws from the innermost scoped_limb_arena active on the
+// current thread, or from the global heap when there is none:
+//
+template <class T>
+class limb_arena_allocator
+{
+   static_assert(alignof(T) <= alignof(detail::limb_arena_unit), "limb_arena_allocator can not provide the alignment required by T");
+
+   static std::size_t units(std::size_t n) noexcept
+   {
+      return (n * sizeof(T) + sizeof(detail::limb_arena_unit) - 1) / sizeof(detail::limb_arena_unit);
+   }
+
+ public:
+   using value_type                             = T;
+   using propagate_on_container_move_assignment = std::true_type;
+   using is_always_equal                        = std::true_type;
+
+   limb_arena_allocator() noexcept = default;
+   template <class U>
+   limb_arena_allocator(const limb_arena_allocator<U>&) noexcept {}
+
+   T* allocate(std::size_t n)
+   {
+      detail::limb_arena_unit* p;
+      if (detail::limb_arena* a = detail::limb_arena::current())
+         p = a->allocate(units(n));
+      else
+      {
+         p        = std::allocator<detail::limb_arena_unit>().allocate(units(n) + 1);
+         p->block = nullptr;
+         ++p;
+      }
+      return reinterpret_cast<T*>(p);
+   }
+   void deallocate(T* ptr, std::size_t n) noexcept
+   {
+      detail::limb_arena_unit* p = reinterpret_cast<detail::limb_arena_unit*>(ptr);
+      if (p[-1].block)
+         detail::limb_arena::deallocate(p, units(n));
+      else
+         std::allocator<detail::limb_arena_unit>().deallocate(p - 1, units(n) + 1);
+   }
+};
+
+template <class T, class U>
+inline constexpr bool operator==(const limb_arena_allocator<T>&, const limb_arena_allocator<U>&) noexcept { return true; }
+template <class T, class U>
+inline constexpr bool operator!=(const limb_arena_allocator<T>&, const limb_arena_allocator<U>&) noexcept { return false; }
+
+//
+// While an object of this type is alive, all limb_arena_allocator allocations on the
+// constructing thread come from a bump allocated arena, which is released in bulk when
+// the scope ends.  Scopes may be nested, but must be destroyed in the reverse order of
+// construction on the thread which created them.  Values which outlive the scope remain
+// valid, the memory they use is freed when the last of them is destroyed.  Values using
+// arena storage must be destroyed on the thread that created them.
+//
+class scoped_limb_arena
+{
+ public:
+   explicit scoped_limb_arena(std::size_t initial_bytes = 16384) noexcept
+       : m_arena(initial_bytes / sizeof(detail::limb_arena_unit) + 1) {}
+
+ private:
+   detail::limb_arena m_arena;
+};
+
+using arena_cpp_int_backend = cpp_int_backend<0, 0, signed_magnitude, unchecked, limb_arena_allocator<limb_type> >;
+using arena_cpp_int         = number<arena_cpp_int_backend>;
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -10,6 +10,19 @@
 #include <boost/multiprecision/traits/extract_exponent_type.hpp>
 #include <boost/multiprecision/detail/integer_ops.hpp>
 
+#ifdef BOOST_MP_LOGGED_ADAPTOR_PROFILE
+#include <boost/multiprecision/logged_adaptor_profile.hpp>
+//
+// Counts and times the rest of the enclosing function against the backend type and event
+// description, recording the size of the largest operand:
+//
+#define BOOST_MP_LOGGED_PROFILE(Backend, description, ...)                                                                     \
+   static const std::size_t logged_profile_site = boost::multiprecision::detail::logged_profile_site<Backend>(description); \
+   const boost::multiprecision::detail::logged_profile_scope logged_profile_scope_guard(logged_profile_site, boost::multiprecision::detail::logged_profile_max_bits(__VA_ARGS__))
+#else
+#define BOOST_MP_LOGGED_PROFILE(Backend, description, ...)
+#endif
+
 namespace boost {
 namespace multiprecision {
 
@@ -54,10 +67,12 @@ struct logged_adaptor
  public:
    logged_adaptor()
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Default construct", m_value);
       log_postfix_event(m_value, "Default construct");
    }
    logged_adaptor(const logged_adaptor& o)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Copy construct", m_value, o.value());
       log_prefix_event(m_value, o.value(), "Copy construct");
       m_value = o.m_value;
       log_postfix_event(m_value, "Copy construct");
@@ -65,12 +80,14 @@ struct logged_adaptor
    // rvalue copy
    logged_adaptor(logged_adaptor&& o)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Move construct", m_value, o.value());
       log_prefix_event(m_value, o.value(), "Move construct");
       m_value = static_cast<Backend&&>(o.m_value);
       log_postfix_event(m_value, "Move construct");
    }
    logged_adaptor& operator=(logged_adaptor&& o)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Move Assignment", m_value, o.value());
       log_prefix_event(m_value, o.value(), "Move Assignment");
       m_value = static_cast<Backend&&>(o.m_value);
       log_postfix_event(m_value, "Move construct");
@@ -78,6 +95,7 @@ struct logged_adaptor
    }
    logged_adaptor& operator=(const logged_adaptor& o)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Assignment", m_value, o.value());
       log_prefix_event(m_value, o.value(), "Assignment");
       m_value = o.m_value;
       log_postfix_event(m_value, "Copy construct");
@@ -87,35 +105,41 @@ struct logged_adaptor
    logged_adaptor(const T& i, const typename std::enable_if<std::is_convertible<T, Backend>::value>::type* = nullptr)
        : m_value(i)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "construct from arithmetic type", m_value);
       log_postfix_event(m_value, "construct from arithmetic type");
    }
    template <class T>
    logged_adaptor(const logged_adaptor<T>& i, const typename std::enable_if<std::is_convertible<T, Backend>::value>::type* = nullptr)
        : m_value(i.value())
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "construct from arithmetic type", m_value);
       log_postfix_event(m_value, "construct from arithmetic type");
    }
    template <class T, class U>
    logged_adaptor(const T& i, const U& j, typename std::enable_if<std::is_constructible<Backend, const T&, const U&>::value>::type* = nullptr)
       : m_value(i, j)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "construct from a pair of arithmetic types", m_value);
       log_postfix_event(m_value, "construct from a pair of arithmetic types");
    }
    template <class D = Backend>
    logged_adaptor(const Backend& i, unsigned digits10, typename std::enable_if<std::is_constructible<D, Backend const&, unsigned>::value>::type const* = nullptr)
       : m_value(i, digits10)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "construct from arithmetic type and precision", m_value);
       log_postfix_event(m_value, "construct from arithmetic type and precision");
    }
    template <class D = Backend>
    logged_adaptor(const logged_adaptor<Backend>& i, unsigned digits10, typename std::enable_if<std::is_constructible<D, Backend const&, unsigned>::value>::type const* = nullptr)
       : m_value(i.value(), digits10)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "construct from arithmetic type and precision", m_value);
       log_postfix_event(m_value, "construct from arithmetic type and precision");
    }
    template <class T>
    typename std::enable_if<boost::multiprecision::detail::is_arithmetic<T>::value || std::is_assignable<Backend, T>::value, logged_adaptor&>::type operator=(const T& i)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Assignment from arithmetic type", m_value, i);
       log_prefix_event(m_value, i, "Assignment from arithmetic type");
       m_value = i;
       log_postfix_event(m_value, "Assignment from arithmetic type");
@@ -123,6 +147,7 @@ struct logged_adaptor
    }
    logged_adaptor& operator=(const char* s)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Assignment from string type", m_value, s);
       log_prefix_event(m_value, s, "Assignment from string type");
       m_value = s;
       log_postfix_event(m_value, "Assignment from string type");
@@ -130,12 +155,14 @@ struct logged_adaptor
    }
    void swap(logged_adaptor& o)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "swap", m_value, o.value());
       log_prefix_event(m_value, o.value(), "swap");
       std::swap(m_value, o.value());
       log_postfix_event(m_value, "swap");
    }
    std::string str(std::streamsize digits, std::ios_base::fmtflags f) const
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "Conversion to string", m_value);
       log_prefix_event(m_value, "Conversion to string");
       std::string s = m_value.str(digits, f);
       log_postfix_event(m_value, s, "Conversion to string");
@@ -143,12 +170,14 @@ struct logged_adaptor
    }
    void negate()
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "negate", m_value);
       log_prefix_event(m_value, "negate");
       m_value.negate();
       log_postfix_event(m_value, "negate");
    }
    int compare(const logged_adaptor& o) const
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "compare", m_value, o.value());
       log_prefix_event(m_value, o.value(), "compare");
       int r = m_value.compare(o.value());
       log_postfix_event(m_value, r, "compare");
@@ -157,6 +186,7 @@ struct logged_adaptor
    template <class T>
    int compare(const T& i) const
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "compare", m_value, i);
       log_prefix_event(m_value, i, "compare");
       int r = m_value.compare(i);
       log_postfix_event(m_value, r, "compare");
@@ -175,6 +205,7 @@ struct logged_adaptor
    template <class Archive>
    void serialize(Archive& ar, const unsigned int /*version*/)
    {
+      BOOST_MP_LOGGED_PROFILE(Backend, "serialize", m_value);
       log_prefix_event(m_value, "serialize");
       ar& boost::make_nvp("value", m_value);
       log_postfix_event(m_value, "serialize");
@@ -236,6 +267,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result) \
    {                                                                     \
       using default_ops::BOOST_JOIN(eval_, name);                        \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, result.value());             \
       log_prefix_event(result.value(), str);                             \
       BOOST_JOIN(eval_, name)                                            \
       (result.value());                                                  \
@@ -247,6 +279,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const T& a)                       \
    {                                                                                                       \
       using default_ops::BOOST_JOIN(eval_, name);                                                          \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, result.value(), unwrap_logged_type(a));                        \
       log_prefix_event(result.value(), unwrap_logged_type(a), str);                                        \
       BOOST_JOIN(eval_, name)                                                                              \
       (result.value(), unwrap_logged_type(a));                                                             \
@@ -256,6 +289,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a) \
    {                                                                                                       \
       using default_ops::BOOST_JOIN(eval_, name);                                                          \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, result.value(), unwrap_logged_type(a));                        \
       log_prefix_event(result.value(), unwrap_logged_type(a), str);                                        \
       BOOST_JOIN(eval_, name)                                                                              \
       (result.value(), unwrap_logged_type(a));                                                             \
@@ -267,6 +301,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const T& a, const U& b)                                             \
    {                                                                                                                                         \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                            \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b));                                                   \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), str);                                                   \
       BOOST_JOIN(eval_, name)                                                                                                                \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b));                                                                        \
@@ -276,6 +311,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const T& b)                       \
    {                                                                                                                                         \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                            \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b));                                                   \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), str);                                                   \
       BOOST_JOIN(eval_, name)                                                                                                                \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b));                                                                        \
@@ -285,6 +321,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const T& a, const logged_adaptor<Backend>& b)                       \
    {                                                                                                                                         \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                            \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b));                                                   \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), str);                                                   \
       BOOST_JOIN(eval_, name)                                                                                                                \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b));                                                                        \
@@ -294,6 +331,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const logged_adaptor<Backend>& b) \
    {                                                                                                                                         \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                            \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b));                                                   \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), str);                                                   \
       BOOST_JOIN(eval_, name)                                                                                                                \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b));                                                                        \
@@ -305,6 +343,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const T& a, const U& b, const V& c)                                                                   \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -314,6 +353,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const logged_adaptor<Backend>& b, const T& c)                       \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -323,6 +363,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const T& b, const logged_adaptor<Backend>& c)                       \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -332,6 +373,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const T& a, const logged_adaptor<Backend>& b, const logged_adaptor<Backend>& c)                       \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -341,6 +383,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const logged_adaptor<Backend>& b, const logged_adaptor<Backend>& c) \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -350,6 +393,7 @@ inline const Backend& unwrap_logged_type(const logged_adaptor<Backend>& a) { ret
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<Backend> & result, const logged_adaptor<Backend>& a, const T& b, const U& c)                                             \
    {                                                                                                                                                                           \
       using default_ops::BOOST_JOIN(eval_, name);                                                                                                                              \
+      BOOST_MP_LOGGED_PROFILE(Backend, str, unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                              \
       log_prefix_event(result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c), str);                                                              \
       BOOST_JOIN(eval_, name)                                                                                                                                                  \
       (result.value(), unwrap_logged_type(a), unwrap_logged_type(b), unwrap_logged_type(c));                                                                                   \
@@ -365,6 +409,7 @@ template <class Backend, class R>
 inline void eval_convert_to(R* result, const logged_adaptor<Backend>& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(Backend, "convert_to", val.value());
    log_prefix_event(val.value(), "convert_to");
    eval_convert_to(result, val.value());
    log_postfix_event(val.value(), *result, "convert_to");
@@ -374,6 +419,7 @@ template <class Backend, class R>
 inline void eval_convert_to(logged_adaptor<R>* result, const logged_adaptor<Backend>& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(Backend, "convert_to", val.value());
    log_prefix_event(val.value(), "convert_to");
    eval_convert_to(&result->value(), val.value());
    log_postfix_event(val.value(), &result->value(), "convert_to");
@@ -382,6 +428,7 @@ template <class Backend, class R>
 inline void eval_convert_to(logged_adaptor<R>* result, const Backend& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(R, "convert_to", val);
    log_prefix_event(val, "convert_to");
    eval_convert_to(&result->value(), val);
    log_postfix_event(val, &result->value(), "convert_to");
@@ -391,6 +438,7 @@ template <class Backend>
 inline void eval_convert_to(std::complex<float>* result, const logged_adaptor<Backend>& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(Backend, "convert_to", val.value());
    log_prefix_event(val.value(), "convert_to");
    eval_convert_to(result, val.value());
    log_postfix_event(val.value(), *result, "convert_to");
@@ -399,6 +447,7 @@ template <class Backend>
 inline void eval_convert_to(std::complex<double>* result, const logged_adaptor<Backend>& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(Backend, "convert_to", val.value());
    log_prefix_event(val.value(), "convert_to");
    eval_convert_to(result, val.value());
    log_postfix_event(val.value(), *result, "convert_to");
@@ -407,6 +456,7 @@ template <class Backend>
 inline void eval_convert_to(std::complex<long double>* result, const logged_adaptor<Backend>& val)
 {
    using default_ops::eval_convert_to;
+   BOOST_MP_LOGGED_PROFILE(Backend, "convert_to", val.value());
    log_prefix_event(val.value(), "convert_to");
    eval_convert_to(result, val.value());
    log_postfix_event(val.value(), *result, "convert_to");
@@ -416,6 +466,7 @@ inline void eval_convert_to(std::complex<long double>* result, const logged_adap
 template <class Backend, class Exp>
 inline void eval_frexp(logged_adaptor<Backend>& result, const logged_adaptor<Backend>& arg, Exp* exp)
 {
+   BOOST_MP_LOGGED_PROFILE(Backend, "frexp", arg.value());
    log_prefix_event(arg.value(), "frexp");
    eval_frexp(result.value(), arg.value(), exp);
    log_postfix_event(result.value(), *exp, "frexp");
@@ -424,6 +475,7 @@ inline void eval_frexp(logged_adaptor<Backend>& result, const logged_adaptor<Bac
 template <class Backend, class Exp>
 inline void eval_ldexp(logged_adaptor<Backend>& result, const logged_adaptor<Backend>& arg, Exp exp)
 {
+   BOOST_MP_LOGGED_PROFILE(Backend, "ldexp", arg.value());
    log_prefix_event(arg.value(), "ldexp");
    eval_ldexp(result.value(), arg.value(), exp);
    log_postfix_event(result.value(), exp, "ldexp");
@@ -433,6 +485,7 @@ template <class Backend, class Exp>
 inline void eval_scalbn(logged_adaptor<Backend>& result, const logged_adaptor<Backend>& arg, Exp exp)
 {
    using default_ops::eval_scalbn;
+   BOOST_MP_LOGGED_PROFILE(Backend, "scalbn", arg.value());
    log_prefix_event(arg.value(), "scalbn");
    eval_scalbn(result.value(), arg.value(), exp);
    log_postfix_event(result.value(), exp, "scalbn");
@@ -442,6 +495,7 @@ template <class Backend>
 inline typename Backend::exponent_type eval_ilogb(const logged_adaptor<Backend>& arg)
 {
    using default_ops::eval_ilogb;
+   BOOST_MP_LOGGED_PROFILE(Backend, "ilogb", arg.value());
    log_prefix_event(arg.value(), "ilogb");
    typename Backend::exponent_type r = eval_ilogb(arg.value());
    log_postfix_event(arg.value(), "ilogb");
@@ -456,6 +510,7 @@ template <class Backend>
 inline int eval_fpclassify(const logged_adaptor<Backend>& arg)
 {
    using default_ops::eval_fpclassify;
+   BOOST_MP_LOGGED_PROFILE(Backend, "fpclassify", arg.value());
    log_prefix_event(arg.value(), "fpclassify");
    int r = eval_fpclassify(arg.value());
    log_postfix_event(arg.value(), r, "fpclassify");
@@ -501,6 +556,7 @@ template <class Backend>
 inline void eval_left_shift(logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_left_shift;
+   BOOST_MP_LOGGED_PROFILE(Backend, "<<=", arg.value(), a);
    log_prefix_event(arg.value(), a, "<<=");
    eval_left_shift(arg.value(), a);
    log_postfix_event(arg.value(), "<<=");
@@ -509,6 +565,7 @@ template <class Backend>
 inline void eval_left_shift(logged_adaptor<Backend>& arg, const logged_adaptor<Backend>& a, std::size_t b)
 {
    using default_ops::eval_left_shift;
+   BOOST_MP_LOGGED_PROFILE(Backend, "<<", a.value(), b);
    log_prefix_event(arg.value(), a, b, "<<");
    eval_left_shift(arg.value(), a.value(), b);
    log_postfix_event(arg.value(), "<<");
@@ -517,6 +574,7 @@ template <class Backend>
 inline void eval_right_shift(logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_right_shift;
+   BOOST_MP_LOGGED_PROFILE(Backend, ">>=", arg.value(), a);
    log_prefix_event(arg.value(), a, ">>=");
    eval_right_shift(arg.value(), a);
    log_postfix_event(arg.value(), ">>=");
@@ -525,6 +583,7 @@ template <class Backend>
 inline void eval_right_shift(logged_adaptor<Backend>& arg, const logged_adaptor<Backend>& a, std::size_t b)
 {
    using default_ops::eval_right_shift;
+   BOOST_MP_LOGGED_PROFILE(Backend, ">>", a.value(), b);
    log_prefix_event(arg.value(), a, b, ">>");
    eval_right_shift(arg.value(), a.value(), b);
    log_postfix_event(arg.value(), ">>");
@@ -534,6 +593,7 @@ template <class Backend, class T>
 inline T eval_integer_modulus(const logged_adaptor<Backend>& arg, const T& a)
 {
    using default_ops::eval_integer_modulus;
+   BOOST_MP_LOGGED_PROFILE(Backend, "integer-modulus", arg.value(), a);
    log_prefix_event(arg.value(), a, "integer-modulus");
    T r = eval_integer_modulus(arg.value(), a);
    log_postfix_event(arg.value(), r, "integer-modulus");
@@ -544,6 +604,7 @@ template <class Backend>
 inline std::size_t eval_lsb(const logged_adaptor<Backend>& arg)
 {
    using default_ops::eval_lsb;
+   BOOST_MP_LOGGED_PROFILE(Backend, "least-significant-bit", arg.value());
    log_prefix_event(arg.value(), "least-significant-bit");
    std::size_t r = eval_lsb(arg.value());
    log_postfix_event(arg.value(), r, "least-significant-bit");
@@ -554,6 +615,7 @@ template <class Backend>
 inline std::size_t eval_msb(const logged_adaptor<Backend>& arg)
 {
    using default_ops::eval_msb;
+   BOOST_MP_LOGGED_PROFILE(Backend, "most-significant-bit", arg.value());
    log_prefix_event(arg.value(), "most-significant-bit");
    std::size_t r = eval_msb(arg.value());
    log_postfix_event(arg.value(), r, "most-significant-bit");
@@ -564,6 +626,7 @@ template <class Backend>
 inline bool eval_bit_test(const logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_bit_test;
+   BOOST_MP_LOGGED_PROFILE(Backend, "bit-test", arg.value(), a);
    log_prefix_event(arg.value(), a, "bit-test");
    bool r = eval_bit_test(arg.value(), a);
    log_postfix_event(arg.value(), r, "bit-test");
@@ -574,6 +637,7 @@ template <class Backend>
 inline void eval_bit_set(const logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_bit_set;
+   BOOST_MP_LOGGED_PROFILE(Backend, "bit-set", arg.value(), a);
    log_prefix_event(arg.value(), a, "bit-set");
    eval_bit_set(arg.value(), a);
    log_postfix_event(arg.value(), arg, "bit-set");
@@ -582,6 +646,7 @@ template <class Backend>
 inline void eval_bit_unset(const logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_bit_unset;
+   BOOST_MP_LOGGED_PROFILE(Backend, "bit-unset", arg.value(), a);
    log_prefix_event(arg.value(), a, "bit-unset");
    eval_bit_unset(arg.value(), a);
    log_postfix_event(arg.value(), arg, "bit-unset");
@@ -590,6 +655,7 @@ template <class Backend>
 inline void eval_bit_flip(const logged_adaptor<Backend>& arg, std::size_t a)
 {
    using default_ops::eval_bit_flip;
+   BOOST_MP_LOGGED_PROFILE(Backend, "bit-flip", arg.value(), a);
    log_prefix_event(arg.value(), a, "bit-flip");
    eval_bit_flip(arg.value(), a);
    log_postfix_event(arg.value(), arg, "bit-flip");
@@ -721,6 +787,7 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_set_imag(logged_adaptor<To>& to, const
    inline void BOOST_JOIN(eval_, name)(logged_adaptor<B1> & result, const logged_adaptor<B2>& a) \
    {                                                                                             \
       using default_ops::BOOST_JOIN(eval_, name);                                                \
+      BOOST_MP_LOGGED_PROFILE(B2, str, a.value());                                               \
       log_prefix_event(a.value(), a.value(), str);                                               \
       BOOST_JOIN(eval_, name)                                                                    \
       (result.value(), a.value());                                                               \
@@ -730,6 +797,7 @@ inline BOOST_MP_CXX14_CONSTEXPR void eval_set_imag(logged_adaptor<To>& to, const
    inline void BOOST_JOIN(eval_, name)(B1 & result, const logged_adaptor<B2>& a)                 \
    {                                                                                             \
       using default_ops::BOOST_JOIN(eval_, name);                                                \
+      BOOST_MP_LOGGED_PROFILE(B2, str, a.value());                                               \
       log_prefix_event(a.value(), a.value(), str);                                               \
       BOOST_JOIN(eval_, name)                                                                    \
       (result, a.value());                                                                       \
@@ -830,5 +898,6 @@ struct precision<boost::multiprecision::number<boost::multiprecision::logged_ada
 #undef NON_MEMBER_OP2
 #undef NON_MEMBER_OP3
 #undef NON_MEMBER_OP4
+#undef BOOST_MP_LOGGED_PROFILE
 
 #endif
@@ -0,0 +1,498 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Per operation counters for logged_adaptor: when BOOST_MP_LOGGED_ADAPTOR_PROFILE is defined
+// every operation which logged_adaptor logs is also counted and timed, per backend type and
+// operation, and the results may be obtained at any time from the functions at the end of this
+// file.  Each thread records into its own counters without locking, which are merged when a
+// report is requested.
+//
+
+#ifndef BOOST_MP_LOGGED_ADAPTOR_PROFILE_HPP
+#define BOOST_MP_LOGGED_ADAPTOR_PROFILE_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+#include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/number_base.hpp>
+#include <boost/multiprecision/detail/bitscan.hpp>
+#include <boost/multiprecision/traits/is_variable_precision.hpp>
+
+#ifndef BOOST_MP_STANDALONE
+#include <boost/core/demangle.hpp>
+#endif
+
+//
+// The maximum number of distinct (backend, operation) pairs which are recorded, any more are ignored:
+//
+#ifndef BOOST_MP_LOGGED_ADAPTOR_PROFILE_MAX_SITES
+#define BOOST_MP_LOGGED_ADAPTOR_PROFILE_MAX_SITES 1024
+#endif
+//
+// Time in cycles from the time stamp counter where there is one, otherwise in nanoseconds from steady_clock:
+//
+#if !defined(BOOST_MP_LOGGED_ADAPTOR_PROFILE_USE_STEADY_CLOCK)
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)) && !defined(_M_ARM64EC)
+#include <intrin.h>
+#define BOOST_MP_LOGGED_ADAPTOR_PROFILE_HAS_RDTSC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define BOOST_MP_LOGGED_ADAPTOR_PROFILE_HAS_RDTSC
+#endif
+#endif
+
+namespace boost {
+namespace multiprecision {
+
+//
+// Operand sizes are recorded in logged_adaptor_profile_bit_buckets buckets: bucket 0 counts operands
+// of up to 64 bits, bucket i those of up to 64 * 2^i bits, and the last bucket everything larger:
+//
+constexpr std::size_t logged_adaptor_profile_bit_buckets = 16;
+
+struct logged_adaptor_profile_entry
+{
+   std::string   backend;   // the backend type wrapped by logged_adaptor
+   std::string   operation; // the event description passed to log_prefix_event
+   std::uint64_t count;
+   std::uint64_t ticks;     // including any nested logged operations, see logged_adaptor_profile_tick_unit()
+   std::uint64_t bits[logged_adaptor_profile_bit_buckets];
+};
+
+namespace detail {
+
+constexpr std::size_t logged_profile_max_sites   = BOOST_MP_LOGGED_ADAPTOR_PROFILE_MAX_SITES;
+constexpr std::size_t logged_profile_chunk_sites = 64;
+constexpr std::size_t logged_profile_chunks      = (logged_profile_max_sites + logged_profile_chunk_sites - 1) / logged_profile_chunk_sites;
+
+inline std::uint64_t logged_profile_ticks() noexcept
+{
+#ifdef BOOST_MP_LOGGED_ADAPTOR_PROFILE_HAS_RDTSC
+   return __rdtsc();
+#else
+   return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+inline std::size_t logged_profile_bucket(std::size_t bits) noexcept
+{
+   if (bits <= 64)
+      return 0;
+   std::size_t b = find_msb(static_cast<unsigned long long>(bits - 1)) - 5;
+   return b < logged_adaptor_profile_bit_buckets ? b : logged_adaptor_profile_bit_buckets - 1;
+}
+
+struct logged_profile_totals
+{
+   std::uint64_t count = 0;
+   std::uint64_t ticks = 0;
+   std::uint64_t bits[logged_adaptor_profile_bit_buckets] = {};
+};
+
+//
+// Only the owning thread ever writes to these, so a relaxed load and store is enough to update
+// them, and avoids a locked instruction.  Other threads may read them at any time:
+//
+struct logged_profile_counters
+{
+   std::atomic<std::uint64_t> count;
+   std::atomic<std::uint64_t> ticks;
+   std::atomic<std::uint64_t> bits[logged_adaptor_profile_bit_buckets];
+
+   logged_profile_counters() noexcept : count(0), ticks(0)
+   {
+      for (std::atomic<std::uint64_t>& b : bits)
+         b.store(0, std::memory_order_relaxed);
+   }
+   static void bump(std::atomic<std::uint64_t>& c, std::uint64_t n) noexcept
+   {
+      c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+   }
+   void add_to(logged_profile_totals& t) const noexcept
+   {
+      t.count += count.load(std::memory_order_relaxed);
+      t.ticks += ticks.load(std::memory_order_relaxed);
+      for (std::size_t i = 0; i < logged_adaptor_profile_bit_buckets; ++i)
+         t.bits[i] += bits[i].load(std::memory_order_relaxed);
+   }
+};
+
+class logged_profile_thread;
+
+class logged_profile_registry
+{
+ public:
+   static logged_profile_registry& instance()
+   {
+      static logged_profile_registry r;
+      return r;
+   }
+   //
+   // Returns the index of the counters for this backend and operation, or logged_profile_max_sites
+   // if there are already too many:
+   //
+   std::size_t site(const std::string& backend, const char* operation)
+   {
+      std::lock_guard<std::mutex> l(m_mutex);
+      for (std::size_t i = 0; i < m_sites.size(); ++i)
+      {
+         if ((m_sites[i].first == backend) && (m_sites[i].second == operation))
+            return i;
+      }
+      if (m_sites.size() >= logged_profile_max_sites)
+         return logged_profile_max_sites;
+      m_sites.emplace_back(backend, operation);
+      return m_sites.size() - 1;
+   }
+   inline void add_thread(logged_profile_thread* t);
+   inline void remove_thread(logged_profile_thread* t);
+
+   std::vector<logged_adaptor_profile_entry> snapshot()
+   {
+      std::lock_guard<std::mutex>        l(m_mutex);
+      std::vector<logged_profile_totals> totals = current_totals();
+      std::vector<logged_adaptor_profile_entry> result;
+      for (std::size_t i = 0; i < totals.size(); ++i)
+      {
+         logged_adaptor_profile_entry e;
+         e.backend   = m_sites[i].first;
+         e.operation = m_sites[i].second;
+         e.count     = totals[i].count;
+         e.ticks     = totals[i].ticks;
+         for (std::size_t j = 0; j < logged_adaptor_profile_bit_buckets; ++j)
+            e.bits[j] = totals[i].bits[j];
+         if (i < m_baseline.size())
+         {
+            e.count -= m_baseline[i].count;
+            e.ticks -= m_baseline[i].ticks;
+            for (std::size_t j = 0; j < logged_adaptor_profile_bit_buckets; ++j)
+               e.bits[j] -= m_baseline[i].bits[j];
+         }
+         if (e.count)
+            result.push_back(e);
+      }
+      return result;
+   }
+   //
+   // Counters are never written by other threads, so rather than clearing them we remember
+   // their current values and subtract those from later reports:
+   //
+   void reset()
+   {
+      std::lock_guard<std::mutex> l(m_mutex);
+      m_baseline = current_totals();
+   }
+
+ private:
+   logged_profile_registry() = default;
+   inline std::vector<logged_profile_totals> current_totals() const;
+
+   std::mutex                                       m_mutex;
+   std::vector<std::pair<std::string, std::string> > m_sites;
+   std::vector<logged_profile_thread*>               m_threads;
+   std::vector<logged_profile_totals>                m_retired; // from threads which have exited
+   std::vector<logged_profile_totals>                m_baseline;
+};
+
+class logged_profile_thread
+{
+ public:
+   logged_profile_thread()
+   {
+      for (std::atomic<logged_profile_counters*>& c : m_chunks)
+         c.store(nullptr, std::memory_order_relaxed);
+      logged_profile_registry::instance().add_thread(this);
+   }
+   ~logged_profile_thread()
+   {
+      logged_profile_registry::instance().remove_thread(this);
+      for (std::atomic<logged_profile_counters*>& c : m_chunks)
+         delete[] c.load(std::memory_order_relaxed);
+   }
+   logged_profile_thread(const logged_profile_thread&)            = delete;
+   logged_profile_thread& operator=(const logged_profile_thread&) = delete;
+
+   static logged_profile_thread& current()
+   {
+      static BOOST_MP_THREAD_LOCAL logged_profile_thread t;
+      return t;
+   }
+   void record(std::size_t site, std::size_t bits, std::uint64_t ticks)
+   {
+      std::atomic<logged_profile_counters*>& chunk = m_chunks[site / logged_profile_chunk_sites];
+      logged_profile_counters*               p     = chunk.load(std::memory_order_relaxed);
+      if (!p)
+      {
+         p = new logged_profile_counters[logged_profile_chunk_sites];
+         chunk.store(p, std::memory_order_release);
+      }
+      logged_profile_counters& c = p[site % logged_profile_chunk_sites];
+      logged_profile_counters::bump(c.count, 1);
+      logged_profile_counters::bump(c.ticks, ticks);
+      logged_profile_counters::bump(c.bits[logged_profile_bucket(bits)], 1);
+   }
+   void add_to(std::vector<logged_profile_totals>& totals) const
+   {
+      for (std::size_t i = 0; i < logged_profile_chunks; ++i)
+      {
+         if (const logged_profile_counters* p = m_chunks[i].load(std::memory_order_acquire))
+         {
+            for (std::size_t j = 0; (j < logged_profile_chunk_sites) && (i * logged_profile_chunk_sites + j < totals.size()); ++j)
+               p[j].add_to(totals[i * logged_profile_chunk_sites + j]);
+         }
+      }
+   }
+
+ private:
+   std::atomic<logged_profile_counters*> m_chunks[logged_profile_chunks];
+};
+
+inline void logged_profile_registry::add_thread(logged_profile_thread* t)
+{
+   std::lock_guard<std::mutex> l(m_mutex);
+   m_threads.push_back(t);
+}
+
+inline void logged_profile_registry::remove_thread(logged_profile_thread* t)
+{
+   std::lock_guard<std::mutex> l(m_mutex);
+   m_retired.resize(m_sites.size());
+   t->add_to(m_retired);
+   m_threads.erase(std::find(m_threads.begin(), m_threads.end(), t));
+}
+
+inline std::vector<logged_profile_totals> logged_profile_registry::current_totals() const
+{
+   std::vector<logged_profile_totals> totals(m_retired);
+   totals.resize(m_sites.size());
+   for (const logged_profile_thread* t : m_threads)
+      t->add_to(totals);
+   return totals;
+}
+
+template <class Backend>
+std::string logged_profile_backend_name()
+{
+#if defined(BOOST_NO_RTTI)
+   return "unknown";
+#elif defined(BOOST_MP_STANDALONE)
+   return typeid(Backend).name();
+#else
+   return boost::core::demangle(typeid(Backend).name());
+#endif
+}
+
+template <class Backend>
+std::size_t logged_profile_site(const char* operation)
+{
+   return logged_profile_registry::instance().site(logged_profile_backend_name<Backend>(), operation);
+}
+
+//
+// The size of an operand in bits: for integers the magnitude (in whole limbs for cpp_int), for
+// floating point types the precision, and zero for anything else:
+//
+template <class T, class = void>
+struct logged_profile_has_limbs : public std::false_type
+{};
+template <class T>
+struct logged_profile_has_limbs<T, decltype(static_cast<void>(std::declval<const T&>().size() * T::limb_bits))> : public std::true_type
+{};
+
+template <class Backend>
+std::size_t logged_profile_integer_bits(const Backend& b, const std::true_type&)
+{
+   return b.size() * Backend::limb_bits;
+}
+template <class Backend>
+std::size_t logged_profile_integer_bits(const Backend& b, const std::false_type&)
+{
+   using default_ops::eval_get_sign;
+   using default_ops::eval_msb;
+   int s = eval_get_sign(b);
+   if (s == 0)
+      return 0;
+   if (s > 0)
+      return eval_msb(b) + 1;
+   Backend t(b);
+   t.negate();
+   return eval_msb(t) + 1;
+}
+template <class Backend>
+std::size_t logged_profile_bits(const Backend& b, const std::integral_constant<int, number_kind_integer>&)
+{
+   return logged_profile_integer_bits(b, logged_profile_has_limbs<Backend>());
+}
+template <class Backend>
+std::size_t logged_profile_float_bits(const Backend& b, const std::true_type&)
+{
+   return b.precision() * 1000uL / 301uL + 1;
+}
+template <class Backend>
+std::size_t logged_profile_float_bits(const Backend&, const std::false_type&)
+{
+   using limits = std::numeric_limits<number<Backend> >;
+   return limits::radix == 2 ? limits::digits : limits::digits * 1000uL / 301uL + 1;
+}
+template <class Backend>
+std::size_t logged_profile_bits(const Backend& b, const std::integral_constant<int, number_kind_floating_point>&)
+{
+   return logged_profile_float_bits(b, std::integral_constant<bool, is_variable_precision<Backend>::value>());
+}
+template <class Backend, int Kind>
+std::size_t logged_profile_bits(const Backend&, const std::integral_constant<int, Kind>&)
+{
+   return 0;
+}
+
+template <class T>
+std::size_t logged_profile_operand_bits(const T& a, const std::true_type&)
+{
+   return logged_profile_bits(a, number_category<T>());
+}
+template <class T>
+std::size_t logged_profile_operand_bits(const T&, const std::false_type&)
+{
+   return 0;
+}
+template <class T>
+std::size_t logged_profile_operand_bits(const T& a)
+{
+   // Other operands are arithmetic types or strings:
+   using is_backend = std::integral_constant<bool, std::is_class<T>::value && !boost::multiprecision::detail::is_arithmetic<T>::value>;
+   return logged_profile_operand_bits(a, is_backend());
+}
+
+inline std::size_t logged_profile_max_bits()
+{
+   return 0;
+}
+template <class T, class... Args>
+std::size_t logged_profile_max_bits(const T& a, const Args&... args)
+{
+   return (std::max)(logged_profile_operand_bits(a), logged_profile_max_bits(args...));
+}
+
+//
+// Times the enclosing scope, and records it against site when it ends:
+//
+class logged_profile_scope
+{
+ public:
+   logged_profile_scope(std::size_t site, std::size_t bits) noexcept : m_site(site), m_bits(bits), m_start(logged_profile_ticks()) {}
+   ~logged_profile_scope()
+   {
+      if (m_site < logged_profile_max_sites)
+         logged_profile_thread::current().record(m_site, m_bits, logged_profile_ticks() - m_start);
+   }
+   logged_profile_scope(const logged_profile_scope&)            = delete;
+   logged_profile_scope& operator=(const logged_profile_scope&) = delete;
+
+ private:
+   std::size_t   m_site;
+   std::size_t   m_bits;
+   std::uint64_t m_start;
+};
+
+inline void logged_profile_print_json_string(std::ostream& os, const std::string& s)
+{
+   os << '"';
+   for (char c : s)
+   {
+      if ((c == '"') || (c == '\\'))
+         os << '\\' << c;
+      else if (static_cast<unsigned char>(c) < 0x20)
+         os << ' ';
+      else
+         os << c;
+   }
+   os << '"';
+}
+
+} // namespace detail
+
+//
+// The unit of logged_adaptor_profile_entry::ticks, either "cycles" or "ns":
+//
+inline const char* logged_adaptor_profile_tick_unit() noexcept
+{
+#ifdef BOOST_MP_LOGGED_ADAPTOR_PROFILE_HAS_RDTSC
+   return "cycles";
+#else
+   return "ns";
+#endif
+}
+
+//
+// The totals from all threads, including those which have exited, since the program started
+// or the last call to reset_logged_adaptor_profile():
+//
+inline std::vector<logged_adaptor_profile_entry> logged_adaptor_profile()
+{
+   return detail::logged_profile_registry::instance().snapshot();
+}
+
+inline void reset_logged_adaptor_profile()
+{
+   detail::logged_profile_registry::instance().reset();
+}
+
+//
+// Prints one line per backend and operation, most expensive first, with the non-empty operand size buckets:
+//
+inline void print_logged_adaptor_profile(std::ostream& os)
+{
+   std::vector<logged_adaptor_profile_entry> entries = logged_adaptor_profile();
+   std::sort(entries.begin(), entries.end(), [](const logged_adaptor_profile_entry& a, const logged_adaptor_profile_entry& b) { return a.ticks > b.ticks; });
+   for (const logged_adaptor_profile_entry& e : entries)
+   {
+      os << e.backend << " " << e.operation << ": " << e.count << " calls, " << e.ticks << " " << logged_adaptor_profile_tick_unit()
+         << " (" << e.ticks / e.count << " per call), operand bits";
+      for (std::size_t i = 0; i < logged_adaptor_profile_bit_buckets; ++i)
+      {
+         if (!e.bits[i])
+            continue;
+         if (i + 1 < logged_adaptor_profile_bit_buckets)
+            os << " <=" << (64uLL << i);
+         else
+            os << " >" << (64uLL << (i - 1));
+         os << ":" << e.bits[i];
+      }
+      os << "\n";
+   }
+}
+
+inline void print_logged_adaptor_profile_json(std::ostream& os)
+{
+   std::vector<logged_adaptor_profile_entry> entries = logged_adaptor_profile();
+   os << "{\"tick_unit\":\"" << logged_adaptor_profile_tick_unit() << "\",\"entries\":[";
+   for (std::size_t i = 0; i < entries.size(); ++i)
+   {
+      const logged_adaptor_profile_entry& e = entries[i];
+      os << (i ? "," : "") << "{\"backend\":";
+      detail::logged_profile_print_json_string(os, e.backend);
+      os << ",\"operation\":";
+      detail::logged_profile_print_json_string(os, e.operation);
+      os << ",\"count\":" << e.count << ",\"ticks\":" << e.ticks << ",\"bits\":[";
+      for (std::size_t j = 0; j < logged_adaptor_profile_bit_buckets; ++j)
+         os << (j ? "," : "") << e.bits[j];
+      os << "]}";
+   }
+   os << "]}\n";
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -8,8 +8,10 @@
 
 #include <random>
 #include <cstdint>
+#include <stdexcept>
 #include <type_traits>
 #include <boost/multiprecision/detail/standalone_config.hpp>
+#include <boost/multiprecision/detail/no_exceptions_support.hpp>
 #include <boost/multiprecision/integer.hpp>
 #include <boost/multiprecision/detail/uniform_int_distribution.hpp>
 #include <boost/multiprecision/detail/assert.hpp>
@@ -134,6 +136,54 @@ cast_to_unsigned(const I& val)
    return val.template convert_to<unsigned>();
 }
 
+//
+// Settles whatever can be decided without a Miller-Rabin round: returns 0 if n is
+// composite, 1 if n is prime, or 2 if n is odd with no small factors:
+//
+template <class I>
+int miller_rabin_screen(const I& n)
+{
+   if (n == 2)
+      return 1; // Trivial special case.
+   if (bit_test(n, 0) == 0)
+      return 0; // n is even
+   if (n <= 227)
+      return detail::is_small_prime(detail::cast_to_unsigned(n)) ? 1 : 0;
+   return detail::check_small_factors(n) ? 2 : 0;
+}
+//
+// A single Miller-Rabin round with witness x, for odd n where nm1 = n - 1 = q * 2^k.
+// Returns false if x proves n composite.  stop() is polled between squarings, and
+// the round is abandoned (returning true) as soon as it returns true:
+//
+template <class I, class Stop>
+bool miller_rabin_witness(const I& n, const I& nm1, const I& q, std::size_t k, const I& x, Stop stop)
+{
+   I           y = powm(x, q, n);
+   std::size_t j = 0;
+   while (true)
+   {
+      if (y == nm1)
+         return true;
+      if (y == 1)
+         return j == 0; // anything else is a non-trivial square root of 1
+      if (++j == k)
+         return false;
+      if (stop())
+         return true;
+      y = powm(y, 2, n);
+   }
+}
+struct miller_rabin_never_stop
+{
+   bool operator()() const { return false; }
+};
+//
+// The first 12 primes as witnesses decide primality for all n < 3.18 * 10^23,
+// see Sorenson and Webster, "Strong pseudoprimes to twelve prime bases", Math. Comp. 86 (2017):
+//
+constexpr unsigned deterministic_witnesses[] = {2u, 3u, 5u, 7u, 11u, 13u, 17u, 19u, 23u, 29u, 31u, 37u};
+
 } // namespace detail
 
 template <class I, class Engine>
@@ -142,21 +192,15 @@ miller_rabin_test(const I& n, std::size_t trials, Engine& gen)
 {
    using number_type = I;
 
-   if (n == 2)
-      return true; // Trivial special case.
-   if (bit_test(n, 0) == 0)
-      return false; // n is even
-   if (n <= 227)
-      return detail::is_small_prime(detail::cast_to_unsigned(n));
-
-   if (!detail::check_small_factors(n))
-      return false;
+   int screen = detail::miller_rabin_screen(n);
+   if (screen != 2)
+      return screen == 1;
 
    number_type nm1 = n - 1;
    //
    // Begin with a single Fermat test - it excludes a lot of candidates:
    //
-   number_type q(228), x, y; // We know n is greater than this, as we've excluded small factors
+   number_type q(228), x; // We know n is greater than this, as we've excluded small factors
    x = powm(q, nm1, n);
    if (x != 1u)
       return false;
@@ -173,26 +217,41 @@ miller_rabin_test(const I& n, std::size_t trials, Engine& gen)
    //
    for (std::size_t i = 0; i < trials; ++i)
    {
-      x          = dist(gen);
-      y          = powm(x, q, n);
-      std::size_t j = 0;
-      while (true)
-      {
-         if (y == nm1)
-            break;
-         if (y == 1)
-         {
-            if (j == 0)
-               break;
-            return false; // test failed
-         }
-         if (++j == k)
-            return false; // failed
-         y = powm(y, 2, n);
-      }
+      x = dist(gen);
+      if (!detail::miller_rabin_witness(n, nm1, q, k, x, detail::miller_rabin_never_stop()))
+         return false; // test failed
    }
    return true; // Yeheh! probably prime.
 }
+//
+// Tests n against a fixed set of witnesses, which decides primality exactly for all n < 2^64,
+// larger values result in a std::domain_error:
+//
+template <class I>
+typename std::enable_if<number_category<I>::value == number_kind_integer, bool>::type
+miller_rabin_test_deterministic(const I& n)
+{
+   using number_type = I;
+
+   if ((n > 0) && (msb(n) >= 64))
+   {
+      BOOST_MP_THROW_EXCEPTION(std::domain_error("Deterministic Miller-Rabin testing requires a value less than 2^64."));
+   }
+   int screen = detail::miller_rabin_screen(n);
+   if (screen != 2)
+      return screen == 1;
+
+   number_type nm1 = n - 1;
+   number_type q   = nm1;
+   std::size_t k   = lsb(q);
+   q >>= k;
+   for (unsigned w : detail::deterministic_witnesses)
+   {
+      if (!detail::miller_rabin_witness(n, nm1, q, k, number_type(w), detail::miller_rabin_never_stop()))
+         return false;
+   }
+   return true;
+}
 
 template <class I>
 typename std::enable_if<number_category<I>::value == number_kind_integer, bool>::type
@@ -216,6 +275,13 @@ bool miller_rabin_test(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n,
    return miller_rabin_test(number_type(n), trials);
 }
 
+template <class tag, class Arg1, class Arg2, class Arg3, class Arg4>
+bool miller_rabin_test_deterministic(const detail::expression<tag, Arg1, Arg2, Arg3, Arg4>& n)
+{
+   using number_type = typename detail::expression<tag, Arg1, Arg2, Arg3, Arg4>::result_type;
+   return miller_rabin_test_deterministic(number_type(n));
+}
+
 }} // namespace boost::multiprecision
 
 #endif
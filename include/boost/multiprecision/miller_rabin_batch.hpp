@@ -0,0 +1,220 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Miller-Rabin testing of many candidates at once, with the individual rounds
+// handed to a user supplied executor so they may run concurrently:
+//
+
+#ifndef BOOST_MP_MR_BATCH_HPP
+#define BOOST_MP_MR_BATCH_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <boost/multiprecision/miller_rabin.hpp>
+
+namespace boost {
+namespace multiprecision {
+namespace detail {
+
+template <class I>
+struct miller_rabin_batch_candidate
+{
+   std::size_t       index; // position in the input range
+   I                 n, nm1, q;
+   std::size_t       k;
+   std::vector<I>    witnesses;
+   std::atomic<bool> composite{false};
+};
+//
+// Counts outstanding rounds, and records the first exception thrown by any of them:
+//
+class miller_rabin_batch_state
+{
+ public:
+   explicit miller_rabin_batch_state(std::size_t pending) : m_pending(pending) {}
+   void finish(std::size_t count, std::exception_ptr e)
+   {
+      std::lock_guard<std::mutex> l(m_mutex);
+      if (e && !m_error)
+         m_error = e;
+      m_pending -= count;
+      if (m_pending == 0)
+         m_done.notify_all();
+   }
+   void wait()
+   {
+      std::unique_lock<std::mutex> l(m_mutex);
+      m_done.wait(l, [this]() { return m_pending == 0; });
+   }
+   // Only meaningful once wait() has returned:
+   std::exception_ptr error() const { return m_error; }
+
+ private:
+   std::mutex              m_mutex;
+   std::condition_variable m_done;
+   std::size_t             m_pending;
+   std::exception_ptr      m_error;
+};
+
+template <class I>
+class miller_rabin_batch_round
+{
+ public:
+   miller_rabin_batch_round(miller_rabin_batch_candidate<I>& c, std::size_t w, miller_rabin_batch_state& s)
+       : m_candidate(&c), m_witness(w), m_state(&s) {}
+   void operator()() const
+   {
+      miller_rabin_batch_candidate<I>& c = *m_candidate;
+      std::exception_ptr               e;
+      //
+      // Once any round has rejected the candidate, rounds yet to start are skipped
+      // and rounds in progress are abandoned at their next squaring:
+      //
+      if (!c.composite.load(std::memory_order_relaxed))
+      {
+#ifndef BOOST_NO_EXCEPTIONS
+         try
+         {
+#endif
+            if (!miller_rabin_witness(c.n, c.nm1, c.q, c.k, c.witnesses[m_witness], [&c]() { return c.composite.load(std::memory_order_relaxed); }))
+               c.composite.store(true, std::memory_order_relaxed);
+#ifndef BOOST_NO_EXCEPTIONS
+         }
+         catch (...)
+         {
+            e = std::current_exception();
+         }
+#endif
+      }
+      m_state->finish(1, e);
+   }
+
+ private:
+   miller_rabin_batch_candidate<I>* m_candidate;
+   std::size_t                      m_witness;
+   miller_rabin_batch_state*        m_state;
+};
+
+struct miller_rabin_inline_executor
+{
+   template <class F>
+   void operator()(F&& f) const { f(); }
+};
+
+} // namespace detail
+
+//
+// Tests every value in candidates, returning one result per value in the same order.
+//
+// Values below 2^64 are decided exactly using the witnesses of miller_rabin_test_deterministic,
+// larger values receive trials rounds with random witnesses drawn from gen - which is only
+// ever used by the calling thread.  Each round is passed to exec as a nullary callable
+// (copyable, and safe to invoke from any thread); exec may run it immediately or queue it
+// on a thread pool, this function returns once every round has completed.
+// Rounds are submitted one witness at a time across all the candidates, so that a candidate
+// rejected by an early round normally has its remaining rounds cancelled before they start.
+//
+template <class Range, class Engine, class Executor>
+std::vector<bool> miller_rabin_test_batch(const Range& candidates, std::size_t trials, Engine& gen, Executor&& exec)
+{
+   using number_type    = typename std::iterator_traits<decltype(std::begin(candidates))>::value_type;
+   using candidate_type = detail::miller_rabin_batch_candidate<number_type>;
+
+   static_assert(number_category<number_type>::value == number_kind_integer, "miller_rabin_test_batch requires integer values");
+
+   std::vector<bool>                            result;
+   std::vector<std::unique_ptr<candidate_type> > pending;
+   std::size_t                                  max_rounds = 0;
+   std::size_t                                  rounds     = 0;
+
+   for (auto i = std::begin(candidates); i != std::end(candidates); ++i)
+   {
+      const number_type& n      = *i;
+      int                screen = detail::miller_rabin_screen(n);
+      result.push_back(screen == 1);
+      if (screen != 2)
+         continue;
+
+      std::unique_ptr<candidate_type> c(new candidate_type());
+      c->index = result.size() - 1;
+      c->n     = n;
+      c->nm1   = n - 1;
+      c->q     = c->nm1;
+      c->k     = lsb(c->q);
+      c->q >>= c->k;
+      if (msb(n) < 64)
+      {
+         for (unsigned w : detail::deterministic_witnesses)
+            c->witnesses.push_back(number_type(w));
+      }
+      else
+      {
+         boost::multiprecision::uniform_int_distribution<number_type> dist(number_type(2), number_type(n - 2));
+         for (std::size_t t = 0; t < trials; ++t)
+            c->witnesses.push_back(dist(gen));
+      }
+      if (c->witnesses.size() > max_rounds)
+         max_rounds = c->witnesses.size();
+      rounds += c->witnesses.size();
+      pending.push_back(std::move(c));
+   }
+   if (!rounds)
+      return result;
+
+   detail::miller_rabin_batch_state state(rounds);
+#ifndef BOOST_NO_EXCEPTIONS
+   try
+   {
+#endif
+      for (std::size_t w = 0; w < max_rounds; ++w)
+      {
+         for (const std::unique_ptr<candidate_type>& c : pending)
+         {
+            if (w < c->witnesses.size())
+            {
+               exec(detail::miller_rabin_batch_round<number_type>(*c, w, state));
+               --rounds;
+            }
+         }
+      }
+#ifndef BOOST_NO_EXCEPTIONS
+   }
+   catch (...)
+   {
+      // Rounds already submitted refer to our local state, so must finish before we leave,
+      // a round whose submission threw is taken never to have been queued:
+      state.finish(rounds, std::exception_ptr());
+      state.wait();
+      throw;
+   }
+#endif
+   state.wait();
+#ifndef BOOST_NO_EXCEPTIONS
+   if (state.error())
+      std::rethrow_exception(state.error());
+#endif
+
+   for (const std::unique_ptr<candidate_type>& c : pending)
+      result[c->index] = !c->composite.load(std::memory_order_relaxed);
+   return result;
+}
+//
+// As above, but with every round run on the calling thread:
+//
+template <class Range, class Engine>
+std::vector<bool> miller_rabin_test_batch(const Range& candidates, std::size_t trials, Engine& gen)
+{
+   return miller_rabin_test_batch(candidates, trials, gen, detail::miller_rabin_inline_executor());
+}
+
+}} // namespace boost::multiprecision
+
+#endif
@@ -1839,6 +1839,16 @@ class number
       eval_subtract(m_backend, canonical_value(e.right().value()));
    }
    template <class Exp>
+   BOOST_MP_CXX14_CONSTEXPR void do_add(const Exp& e, const detail::multiply_immediates&)
+   {
+      //
+      // Fused multiply-add, so that sums of products such as a*b + c*d need no temporary:
+      //
+      using default_ops::eval_multiply_add;
+      boost::multiprecision::detail::maybe_promote_precision(this);
+      eval_multiply_add(m_backend, canonical_value(e.left().value()), canonical_value(e.right().value()));
+   }
+   template <class Exp>
    BOOST_MP_CXX14_CONSTEXPR void do_subtract(const Exp& e, const detail::terminal&)
    {
       using default_ops::eval_subtract;
@@ -1886,6 +1896,13 @@ class number
       eval_subtract(m_backend, canonical_value(e.left().value()));
       eval_add(m_backend, canonical_value(e.right().value()));
    }
+   template <class Exp>
+   BOOST_MP_CXX14_CONSTEXPR void do_subtract(const Exp& e, const detail::multiply_immediates&)
+   {
+      using default_ops::eval_multiply_subtract;
+      boost::multiprecision::detail::maybe_promote_precision(this);
+      eval_multiply_subtract(m_backend, canonical_value(e.left().value()), canonical_value(e.right().value()));
+   }
    template <class Exp, class unknown>
    BOOST_MP_CXX14_CONSTEXPR void do_subtract(const Exp& e, const unknown&)
    {
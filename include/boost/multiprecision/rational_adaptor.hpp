@@ -8,6 +8,7 @@
 
 #include <boost/multiprecision/number.hpp>
 #include <boost/multiprecision/detail/hash.hpp>
+#include <boost/multiprecision/detail/binary_codec.hpp>
 #include <boost/multiprecision/detail/float128_functions.hpp>
 #include <boost/multiprecision/detail/no_exceptions_support.hpp>
 
@@ -15,7 +16,32 @@ namespace boost {
 namespace multiprecision {
 namespace backends {
 
-template <class Backend>
+//
+// Normalization policies for rational_adaptor.  By default the numerator and denominator
+// are reduced to lowest terms by every operation.  With lazy_normalize they are allowed to
+// grow unreduced until the denominator reaches ThresholdBits bits, after which the eager
+// algorithms take over, and are otherwise reduced only when the value is printed or hashed,
+// when the numerator or denominator is requested, or when normalize() is called explicitly.  This saves most of the gcd's in long chains of
+// additions and multiplications, provided the values in lowest terms are well below the
+// threshold.
+//
+struct eager_normalize
+{};
+
+template <std::size_t ThresholdBits>
+struct lazy_normalize
+{
+   static constexpr std::size_t threshold_bits = ThresholdBits;
+};
+
+template <class NormalizePolicy>
+struct is_lazy_normalize : public std::false_type
+{};
+template <std::size_t ThresholdBits>
+struct is_lazy_normalize<lazy_normalize<ThresholdBits> > : public std::true_type
+{};
+
+template <class Backend, class NormalizePolicy>
 struct rational_adaptor
 {
    //
@@ -236,16 +262,18 @@ struct rational_adaptor
    std::string str(std::streamsize digits, std::ios_base::fmtflags f) const
    {
       using default_ops::eval_eq;
-      //
-      // We format the string ourselves so we can match what GMP's mpq type does:
-      //
-      std::string result = num().str(digits, f);
-      if (!eval_eq(denom(), one()))
+
+      BOOST_IF_CONSTEXPR(is_lazy_normalize<NormalizePolicy>::value)
       {
-         result.append(1, '/');
-         result.append(denom().str(digits, f));
+         if (!eval_eq(denom(), one()))
+         {
+            // Always print in lowest terms:
+            rational_adaptor t(*this);
+            t.normalize();
+            return t.str_imp(digits, f);
+         }
       }
-      return result;
+      return str_imp(digits, f);
    }
    void negate()
    {
@@ -334,6 +362,20 @@ struct rational_adaptor
    #endif // BOOST_MP_STANDALONE
    
  private:
+   std::string str_imp(std::streamsize digits, std::ios_base::fmtflags f) const
+   {
+      using default_ops::eval_eq;
+      //
+      // We format the string ourselves so we can match what GMP's mpq type does:
+      //
+      std::string result = num().str(digits, f);
+      if (!eval_eq(denom(), one()))
+      {
+         result.append(1, '/');
+         result.append(denom().str(digits, f));
+      }
+      return result;
+   }
    Backend m_num, m_denom;
 };
 
@@ -384,8 +426,8 @@ void eval_divide(rational_adaptor<Backend>& a, const rational_adaptor<Backend>&
 //
 // Conversions:
 //
-template <class R, class IntBackend>
-inline typename std::enable_if<number_category<R>::value == number_kind_floating_point>::type eval_convert_to(R* result, const rational_adaptor<IntBackend>& backend)
+template <class R, class IntBackend, class NormalizePolicy>
+inline typename std::enable_if<number_category<R>::value == number_kind_floating_point>::type eval_convert_to(R* result, const rational_adaptor<IntBackend, NormalizePolicy>& backend)
 {
    //
    // The generic conversion is as good as anything we can write here:
@@ -393,8 +435,8 @@ inline typename std::enable_if<number_category<R>::value == number_kind_floating
    ::boost::multiprecision::detail::generic_convert_rational_to_float(*result, backend);
 }
 
-template <class R, class IntBackend>
-inline typename std::enable_if<(number_category<R>::value != number_kind_integer) && (number_category<R>::value != number_kind_floating_point) && !std::is_enum<R>::value>::type eval_convert_to(R* result, const rational_adaptor<IntBackend>& backend)
+template <class R, class IntBackend, class NormalizePolicy>
+inline typename std::enable_if<(number_category<R>::value != number_kind_integer) && (number_category<R>::value != number_kind_floating_point) && !std::is_enum<R>::value>::type eval_convert_to(R* result, const rational_adaptor<IntBackend, NormalizePolicy>& backend)
 {
    using default_ops::eval_convert_to;
    R d;
@@ -403,8 +445,8 @@ inline typename std::enable_if<(number_category<R>::value != number_kind_integer
    *result /= d;
 }
 
-template <class R, class Backend>
-inline typename std::enable_if<number_category<R>::value == number_kind_integer>::type eval_convert_to(R* result, const rational_adaptor<Backend>& backend)
+template <class R, class Backend, class NormalizePolicy>
+inline typename std::enable_if<number_category<R>::value == number_kind_integer>::type eval_convert_to(R* result, const rational_adaptor<Backend, NormalizePolicy>& backend)
 {
    using default_ops::eval_divide;
    using default_ops::eval_convert_to;
@@ -425,10 +467,38 @@ inline std::size_t hash_value(const rational_adaptor<Backend>& arg)
    return result;
 }
 //
-// assign_components:
+// Binary encoding, the numerator and then the denominator, in lowest terms:
 //
 template <class Backend>
-void assign_components(rational_adaptor<Backend>& result, Backend const& a, Backend const& b)
+inline std::size_t eval_binary_encoded_size(const rational_adaptor<Backend>& arg)
+{
+   return eval_binary_encoded_size(arg.num()) + eval_binary_encoded_size(arg.denom());
+}
+template <class Backend>
+inline void eval_binary_encode(boost::multiprecision::detail::binary_writer& w, const rational_adaptor<Backend>& arg)
+{
+   eval_binary_encode(w, arg.num());
+   eval_binary_encode(w, arg.denom());
+}
+template <class Backend, class NormalizePolicy>
+inline void eval_binary_decode(boost::multiprecision::detail::binary_reader& r, rational_adaptor<Backend, NormalizePolicy>& result)
+{
+   using default_ops::eval_get_sign;
+   // As with Boost.Serialization we trust the input to be in lowest terms, but a
+   // denominator which is not positive would break the invariants:
+   eval_binary_decode(r, result.num());
+   eval_binary_decode(r, result.denom());
+   if (eval_get_sign(result.denom()) <= 0)
+   {
+      result.denom() = rational_adaptor<Backend, NormalizePolicy>::one();
+      BOOST_MP_THROW_EXCEPTION(std::runtime_error("Malformed rational value encountered while decoding."));
+   }
+}
+//
+// assign_components:
+//
+template <class Backend, class NormalizePolicy>
+void assign_components(rational_adaptor<Backend, NormalizePolicy>& result, Backend const& a, Backend const& b)
 {
    using default_ops::eval_gcd;
    using default_ops::eval_divide;
@@ -522,15 +592,15 @@ inline void assign_components(rational_adaptor<Backend>& result, const Arithmeti
 //
 // Optional comparison operators:
 //
-template <class Backend>
-inline bool eval_is_zero(const rational_adaptor<Backend>& arg)
+template <class Backend, class NormalizePolicy>
+inline bool eval_is_zero(const rational_adaptor<Backend, NormalizePolicy>& arg)
 {
    using default_ops::eval_is_zero;
    return eval_is_zero(arg.num());
 }
 
-template <class Backend>
-inline int eval_get_sign(const rational_adaptor<Backend>& arg)
+template <class Backend, class NormalizePolicy>
+inline int eval_get_sign(const rational_adaptor<Backend, NormalizePolicy>& arg)
 {
    using default_ops::eval_get_sign;
    return eval_get_sign(arg.num());
@@ -607,8 +677,8 @@ inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value &
    eval_add_subtract_imp(result, arg, false);
 }
 
-template <class Backend>
-void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_adaptor<Backend>& a, const rational_adaptor<Backend>& b, bool isaddition)
+template <class Backend, class NormalizePolicy>
+void eval_add_subtract_imp(rational_adaptor<Backend, NormalizePolicy>& result, const rational_adaptor<Backend, NormalizePolicy>& a, const rational_adaptor<Backend, NormalizePolicy>& b, bool isaddition)
 {
    using default_ops::eval_eq;
    using default_ops::eval_multiply;
@@ -707,8 +777,8 @@ inline void eval_subtract(rational_adaptor<Backend>& result, const rational_adap
    eval_add_subtract_imp(result, a, b, false);
 }
 
-template <class Backend, class Arithmetic>
-void eval_add_subtract_imp(rational_adaptor<Backend>& result, const rational_adaptor<Backend>& a, const Arithmetic& b, bool isaddition)
+template <class Backend, class NormalizePolicy, class Arithmetic>
+void eval_add_subtract_imp(rational_adaptor<Backend, NormalizePolicy>& result, const rational_adaptor<Backend, NormalizePolicy>& a, const Arithmetic& b, bool isaddition)
 {
    using default_ops::eval_add;
    using default_ops::eval_subtract;
@@ -755,8 +825,8 @@ inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value &
 //
 // Multiplication:
 //
-template <class Backend> 
-void eval_multiply_imp(rational_adaptor<Backend>& result, const rational_adaptor<Backend>& a, const Backend& b_num, const Backend& b_denom)
+template <class Backend, class NormalizePolicy> 
+void eval_multiply_imp(rational_adaptor<Backend, NormalizePolicy>& result, const rational_adaptor<Backend, NormalizePolicy>& a, const Backend& b_num, const Backend& b_denom)
 {
    using default_ops::eval_multiply;
    using default_ops::eval_divide;
@@ -1191,17 +1261,406 @@ typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && std::
    }
 }
 
+//
+// Arithmetic with lazy normalization.  Results are exact and have a positive denominator,
+// but are not reduced to lowest terms while the denominator stays below the threshold.
+// Values whose denominator has reached the threshold are always in lowest terms: operations
+// which might produce one fall back on the eager algorithms above (after reducing any small
+// operands), which cancel common factors before multiplying out, and are much cheaper than
+// a gcd of the unreduced result.
+//
+template <std::size_t ThresholdBits, class Backend>
+inline bool eval_lazy_fits(const Backend& a, const Backend& b)
+{
+   // true when |a * b| is certainly below the threshold, a must be positive:
+   using default_ops::eval_msb;
+   using default_ops::eval_get_sign;
+   if (eval_get_sign(b) < 0)
+   {
+      Backend t(b);
+      t.negate();
+      return eval_lazy_fits<ThresholdBits>(a, t);
+   }
+   return eval_msb(a) + eval_msb(b) + 1 < ThresholdBits;
+}
+
+template <class Backend, std::size_t ThresholdBits>
+inline const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& eval_lazy_reduced(const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& storage)
+{
+   using default_ops::eval_msb;
+   using default_ops::eval_eq;
+   if ((eval_msb(a.denom()) >= ThresholdBits) || eval_eq(a.denom(), rational_adaptor<Backend, lazy_normalize<ThresholdBits> >::one()))
+      return a;
+   storage = a;
+   storage.normalize();
+   return storage;
+}
+
+template <class Backend, std::size_t ThresholdBits>
+void eval_lazy_add_subtract_imp(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b, bool isaddition)
+{
+   using default_ops::eval_eq;
+   using default_ops::eval_msb;
+   using default_ops::eval_multiply;
+   using default_ops::eval_add;
+   using default_ops::eval_subtract;
+
+   Backend t1, t2;
+   if (eval_eq(a.denom(), b.denom()) && (eval_msb(a.denom()) < ThresholdBits))
+   {
+      //
+      // Common when summing values with the same denominator, or integers:
+      //
+      if (isaddition)
+         eval_add(t1, a.num(), b.num());
+      else
+         eval_subtract(t1, a.num(), b.num());
+      result.num().swap(t1);
+      if (&result != &a)
+         result.denom() = a.denom();
+   }
+   else if (eval_lazy_fits<ThresholdBits>(a.denom(), b.denom()))
+   {
+      eval_multiply(t1, a.num(), b.denom());
+      eval_multiply(t2, a.denom(), b.num());
+      if (isaddition)
+         eval_add(t1, t2);
+      else
+         eval_subtract(t1, t2);
+      eval_multiply(t2, a.denom(), b.denom());
+      result.num().swap(t1);
+      result.denom().swap(t2);
+   }
+   else
+   {
+      rational_adaptor<Backend, lazy_normalize<ThresholdBits> > ta, tb;
+      eval_add_subtract_imp(result, eval_lazy_reduced(a, ta), eval_lazy_reduced(b, tb), isaddition);
+   }
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_add(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b)
+{
+   eval_lazy_add_subtract_imp(result, a, b, true);
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_subtract(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b)
+{
+   eval_lazy_add_subtract_imp(result, a, b, false);
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_add(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   eval_lazy_add_subtract_imp(result, result, a, true);
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_subtract(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   eval_lazy_add_subtract_imp(result, result, a, false);
+}
+
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+void eval_lazy_add_subtract_imp(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const Arithmetic& b, bool isaddition)
+{
+   using default_ops::eval_multiply;
+   using default_ops::eval_add;
+   using default_ops::eval_subtract;
+   //
+   // (an + b ad) / ad, which is no further from lowest terms than a was:
+   //
+   Backend t;
+   eval_multiply(t, a.denom(), b);
+   if (isaddition)
+      eval_add(t, a.num());
+   else
+   {
+      eval_subtract(t, a.num());
+      t.negate();
+   }
+   result.num().swap(t);
+   if (&result != &a)
+      result.denom() = a.denom();
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_add(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b)
+{
+   eval_lazy_add_subtract_imp(result, result, b, true);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_subtract(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b)
+{
+   eval_lazy_add_subtract_imp(result, result, b, false);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_add(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const Arithmetic& b)
+{
+   eval_lazy_add_subtract_imp(result, a, b, true);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_subtract(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const Arithmetic& b)
+{
+   eval_lazy_add_subtract_imp(result, a, b, false);
+}
+
+template <class Backend, std::size_t ThresholdBits>
+void eval_multiply(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b)
+{
+   using default_ops::eval_multiply;
+
+   if (eval_lazy_fits<ThresholdBits>(a.denom(), b.denom()))
+   {
+      Backend n, d;
+      eval_multiply(n, a.num(), b.num());
+      eval_multiply(d, a.denom(), b.denom());
+      result.num().swap(n);
+      result.denom().swap(d);
+      return;
+   }
+   rational_adaptor<Backend, lazy_normalize<ThresholdBits> > ta, tb;
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(a, ta);
+   if (&a == &b)
+   {
+      // squaring, gcd's are 1:
+      eval_multiply(result.num(), ra.num(), ra.num());
+      eval_multiply(result.denom(), ra.denom(), ra.denom());
+      return;
+   }
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& rb = eval_lazy_reduced(b, tb);
+   eval_multiply_imp(result, ra, rb.num(), rb.denom());
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_multiply(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   eval_multiply(result, result, a);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_multiply(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const Arithmetic& b)
+{
+   using default_ops::eval_multiply;
+   using default_ops::eval_msb;
+
+   if (&result != &a)
+      result = a;
+   if (eval_msb(result.denom()) >= ThresholdBits)
+      eval_multiply_imp(result.num(), result.denom(), b);
+   else
+   {
+      Backend t;
+      eval_multiply(t, result.num(), b);
+      result.num().swap(t);
+   }
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_multiply(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b)
+{
+   eval_multiply(result, result, b);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_multiply(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   eval_multiply(result, a, b);
+}
+
+template <class Backend, std::size_t ThresholdBits>
+void eval_divide(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b)
+{
+   using default_ops::eval_multiply;
+   using default_ops::eval_get_sign;
+
+   if (eval_get_sign(b.num()) == 0)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Integer division by zero"));
+      return;
+   }
+   if (&a == &b)
+   {
+      result.num() = result.denom() = rational_adaptor<Backend, lazy_normalize<ThresholdBits> >::one();
+      return;
+   }
+   if (eval_lazy_fits<ThresholdBits>(a.denom(), b.num()))
+   {
+      Backend n, d;
+      eval_multiply(n, a.num(), b.denom());
+      eval_multiply(d, a.denom(), b.num());
+      if (eval_get_sign(d) < 0)
+      {
+         n.negate();
+         d.negate();
+      }
+      result.num().swap(n);
+      result.denom().swap(d);
+      return;
+   }
+   rational_adaptor<Backend, lazy_normalize<ThresholdBits> > ta, tb;
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(a, ta);
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& rb = eval_lazy_reduced(b, tb);
+   if (&result == &rb)
+   {
+      tb = b;
+      eval_multiply_imp(result, ra, tb.denom(), tb.num());
+   }
+   else
+      eval_multiply_imp(result, ra, rb.denom(), rb.num());
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_divide(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   eval_divide(result, result, a);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_divide(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const Arithmetic& b)
+{
+   using default_ops::eval_multiply;
+   using default_ops::eval_get_sign;
+
+   Backend d;
+   d = b;
+   const int s = eval_get_sign(d);
+   if (s == 0)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Integer division by zero"));
+      return;
+   }
+   if (s < 0)
+      d.negate();
+   if (eval_lazy_fits<ThresholdBits>(a.denom(), d))
+   {
+      Backend t;
+      eval_multiply(t, a.denom(), d);
+      result.denom().swap(t);
+      if (&result != &a)
+         result.num() = a.num();
+   }
+   else
+   {
+      rational_adaptor<Backend, lazy_normalize<ThresholdBits> > ta;
+      const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(a, ta);
+      if (&result != &ra)
+         result = ra;
+      // Multiply the reciprocal by d:
+      eval_multiply_imp(result.denom(), result.num(), d);
+   }
+   if (s < 0)
+      result.num().negate();
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_divide(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b)
+{
+   eval_divide(result, result, b);
+}
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value && (std::is_integral<Arithmetic>::value || std::is_same<Arithmetic, Backend>::value)>::type
+   eval_divide(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& result, const Arithmetic& b, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   using default_ops::eval_multiply;
+   using default_ops::eval_get_sign;
+
+   if (eval_get_sign(a.num()) == 0)
+   {
+      BOOST_MP_THROW_EXCEPTION(std::overflow_error("Integer division by zero"));
+      return;
+   }
+   if (eval_lazy_fits<ThresholdBits>(rational_adaptor<Backend, lazy_normalize<ThresholdBits> >::one(), a.num()))
+   {
+      Backend n, d(a.num());
+      eval_multiply(n, a.denom(), b);
+      result.num().swap(n);
+      result.denom().swap(d);
+   }
+   else
+   {
+      rational_adaptor<Backend, lazy_normalize<ThresholdBits> > ta;
+      const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(a, ta);
+      if (&result != &ra)
+         result = ra;
+      result.num().swap(result.denom());
+      eval_multiply_imp(result.num(), result.denom(), b);
+   }
+   if (eval_get_sign(result.denom()) < 0)
+   {
+      result.num().negate();
+      result.denom().negate();
+   }
+}
+
+//
+// Comparisons and hashing see the value, not the representation:
+//
+template <class Backend, std::size_t ThresholdBits>
+inline bool eval_eq(const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& b)
+{
+   using default_ops::eval_eq;
+   if (eval_eq(a.denom(), b.denom()))
+      return eval_eq(a.num(), b.num());
+   return a.compare(b) == 0;
+}
+
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value&& std::is_integral<Arithmetic>::value, bool>::type
+   eval_eq(const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a, Arithmetic b)
+{
+   using default_ops::eval_eq;
+   using default_ops::eval_multiply;
+   if (eval_eq(a.denom(), rational_adaptor<Backend, lazy_normalize<ThresholdBits> >::one()))
+      return eval_eq(a.num(), b);
+   Backend t;
+   eval_multiply(t, a.denom(), b);
+   return eval_eq(t, a.num());
+}
+
+template <class Backend, std::size_t ThresholdBits, class Arithmetic>
+inline typename std::enable_if<std::is_convertible<Arithmetic, Backend>::value&& std::is_integral<Arithmetic>::value, bool>::type
+   eval_eq(Arithmetic b, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& a)
+{
+   return eval_eq(a, b);
+}
+
+template <class Backend, std::size_t ThresholdBits>
+inline std::size_t hash_value(const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& arg)
+{
+   rational_adaptor<Backend, lazy_normalize<ThresholdBits> > t(arg);
+   t.normalize();
+   std::size_t result = hash_value(t.num());
+   std::size_t result2 = hash_value(t.denom());
+   boost::multiprecision::detail::hash_combine(result, result2);
+   return result;
+}
+
+template <class Backend, std::size_t ThresholdBits>
+inline std::size_t eval_binary_encoded_size(const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& arg)
+{
+   rational_adaptor<Backend, lazy_normalize<ThresholdBits> > t;
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(arg, t);
+   return eval_binary_encoded_size(ra.num()) + eval_binary_encoded_size(ra.denom());
+}
+template <class Backend, std::size_t ThresholdBits>
+inline void eval_binary_encode(boost::multiprecision::detail::binary_writer& w, const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& arg)
+{
+   rational_adaptor<Backend, lazy_normalize<ThresholdBits> > t;
+   const rational_adaptor<Backend, lazy_normalize<ThresholdBits> >& ra = eval_lazy_reduced(arg, t);
+   eval_binary_encode(w, ra.num());
+   eval_binary_encode(w, ra.denom());
+}
+
 //
 // Increment and decrement:
 //
-template <class Backend> 
-inline void eval_increment(rational_adaptor<Backend>& arg)
+template <class Backend, class NormalizePolicy>
+inline void eval_increment(rational_adaptor<Backend, NormalizePolicy>& arg)
 {
    using default_ops::eval_add;
    eval_add(arg.num(), arg.denom());
 }
-template <class Backend> 
-inline void eval_decrement(rational_adaptor<Backend>& arg)
+template <class Backend, class NormalizePolicy>
+inline void eval_decrement(rational_adaptor<Backend, NormalizePolicy>& arg)
 {
    using default_ops::eval_subtract;
    eval_subtract(arg.num(), arg.denom());
@@ -1210,8 +1669,8 @@ inline void eval_decrement(rational_adaptor<Backend>& arg)
 //
 // abs:
 //
-template <class Backend> 
-inline void eval_abs(rational_adaptor<Backend>& result, const rational_adaptor<Backend>& arg)
+template <class Backend, class NormalizePolicy>
+inline void eval_abs(rational_adaptor<Backend, NormalizePolicy>& result, const rational_adaptor<Backend, NormalizePolicy>& arg)
 {
    using default_ops::eval_abs;
    eval_abs(result.num(), arg.num());
@@ -1229,12 +1688,12 @@ inline void eval_abs(rational_adaptor<Backend>& result, const rational_adaptor<B
 //    number_kind_fixed_point
 //    number_kind_complex
 //
-template<class Backend>
-struct number_category<rational_adaptor<Backend> > : public std::integral_constant<int, number_kind_rational>
+template<class Backend, class NormalizePolicy>
+struct number_category<rational_adaptor<Backend, NormalizePolicy> > : public std::integral_constant<int, number_kind_rational>
 {};
 
-template <class Backend, expression_template_option ExpressionTemplates>
-struct component_type<number<rational_adaptor<Backend>, ExpressionTemplates> >
+template <class Backend, class NormalizePolicy, expression_template_option ExpressionTemplates>
+struct component_type<number<rational_adaptor<Backend, NormalizePolicy>, ExpressionTemplates> >
 {
    typedef number<Backend, ExpressionTemplates> type;
 };
@@ -1249,9 +1708,26 @@ inline number<IntBackend, ET> denominator(const number<rational_adaptor<IntBacke
 {
    return val.backend().denom();
 }
+//
+// With lazy normalization the components are reduced to lowest terms first:
+//
+template <class IntBackend, std::size_t ThresholdBits, expression_template_option ET>
+inline number<IntBackend, ET> numerator(const number<rational_adaptor<IntBackend, lazy_normalize<ThresholdBits> >, ET>& val)
+{
+   rational_adaptor<IntBackend, lazy_normalize<ThresholdBits> > t(val.backend());
+   t.normalize();
+   return t.num();
+}
+template <class IntBackend, std::size_t ThresholdBits, expression_template_option ET>
+inline number<IntBackend, ET> denominator(const number<rational_adaptor<IntBackend, lazy_normalize<ThresholdBits> >, ET>& val)
+{
+   rational_adaptor<IntBackend, lazy_normalize<ThresholdBits> > t(val.backend());
+   t.normalize();
+   return t.denom();
+}
 
-template <class Backend>
-struct is_unsigned_number<rational_adaptor<Backend> > : public is_unsigned_number<Backend>
+template <class Backend, class NormalizePolicy>
+struct is_unsigned_number<rational_adaptor<Backend, NormalizePolicy> > : public is_unsigned_number<Backend>
 {};
 
 
@@ -1259,11 +1735,11 @@ struct is_unsigned_number<rational_adaptor<Backend> > : public is_unsigned_numbe
 
 namespace std {
 
-   template <class IntBackend, boost::multiprecision::expression_template_option ExpressionTemplates>
-   class numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend>, ExpressionTemplates> > : public std::numeric_limits<boost::multiprecision::number<IntBackend, ExpressionTemplates> >
+   template <class IntBackend, class NormalizePolicy, boost::multiprecision::expression_template_option ExpressionTemplates>
+   class numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend, NormalizePolicy>, ExpressionTemplates> > : public std::numeric_limits<boost::multiprecision::number<IntBackend, ExpressionTemplates> >
    {
       using base_type = std::numeric_limits<boost::multiprecision::number<IntBackend> >;
-      using number_type = boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend> >;
+      using number_type = boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend, NormalizePolicy> >;
 
    public:
       static constexpr bool is_integer = false;
@@ -1279,10 +1755,10 @@ namespace std {
       static constexpr number_type denorm_min() { return base_type::denorm_min(); }
    };
 
-   template <class IntBackend, boost::multiprecision::expression_template_option ExpressionTemplates>
-   constexpr bool numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend>, ExpressionTemplates> >::is_integer;
-   template <class IntBackend, boost::multiprecision::expression_template_option ExpressionTemplates>
-   constexpr bool numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend>, ExpressionTemplates> >::is_exact;
+   template <class IntBackend, class NormalizePolicy, boost::multiprecision::expression_template_option ExpressionTemplates>
+   constexpr bool numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend, NormalizePolicy>, ExpressionTemplates> >::is_integer;
+   template <class IntBackend, class NormalizePolicy, boost::multiprecision::expression_template_option ExpressionTemplates>
+   constexpr bool numeric_limits<boost::multiprecision::number<boost::multiprecision::rational_adaptor<IntBackend, NormalizePolicy>, ExpressionTemplates> >::is_exact;
 
 } // namespace std
 
@@ -0,0 +1,172 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of binary_encode_array / binary_decode_array for arrays of 1000 values,
+// with export_bits / import_bits and string conversion for comparison.  Bytes per
+// second are those of the encoded form.
+//
+
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/random.hpp>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using namespace boost::multiprecision;
+
+static boost::random::mt19937_64 gen;
+
+static cpp_int make_integer(unsigned bits)
+{
+   cpp_int val = 0;
+   for (unsigned i = 0; i < bits; i += 64)
+   {
+      val <<= 64;
+      val |= static_cast<std::uint64_t>(gen());
+   }
+   return (gen() & 1) ? cpp_int(-val) : val;
+}
+
+template <class T>
+static T make_value(unsigned bits, const std::integral_constant<int, number_kind_integer>&)
+{
+   return T(make_integer(bits));
+}
+template <class T>
+static T make_value(unsigned bits, const std::integral_constant<int, number_kind_rational>&)
+{
+   return T(make_integer(bits), abs(make_integer(bits)) + 1);
+}
+template <class T>
+static T make_value(unsigned, const std::integral_constant<int, number_kind_floating_point>&)
+{
+   return ldexp(T(make_integer(std::numeric_limits<T>::digits)), static_cast<int>(gen() % 200) - 100 - std::numeric_limits<T>::digits);
+}
+
+template <class T>
+static std::vector<T> make_values(unsigned bits)
+{
+   std::vector<T> result;
+   for (unsigned i = 0; i < 1000; ++i)
+      result.push_back(make_value<T>(bits, number_category<T>()));
+   return result;
+}
+
+template <class T>
+static void BM_encode(benchmark::State& state)
+{
+   std::vector<T>             values = make_values<T>(static_cast<unsigned>(state.range(0)));
+   std::vector<unsigned char> buf(binary_encoded_array_size(values.data(), values.size()));
+   for (auto _ : state)
+      benchmark::DoNotOptimize(binary_encode_array(values.data(), values.size(), buf.data(), buf.data() + buf.size()));
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buf.size()));
+}
+
+template <class T>
+static void BM_decode(benchmark::State& state)
+{
+   std::vector<T>             values = make_values<T>(static_cast<unsigned>(state.range(0)));
+   std::vector<unsigned char> buf(binary_encoded_array_size(values.data(), values.size()));
+   binary_encode_array(values.data(), values.size(), buf.data(), buf.data() + buf.size());
+   std::vector<T> result;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(binary_decode_array(result, buf.data(), buf.data() + buf.size()));
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buf.size()));
+}
+
+//
+// The existing alternatives: export_bits / import_bits for integers (which lose the sign),
+// and conversion to and from strings for everything else.
+//
+static void BM_export_bits(benchmark::State& state)
+{
+   std::vector<cpp_int>       values = make_values<cpp_int>(static_cast<unsigned>(state.range(0)));
+   std::vector<unsigned char> buf;
+   for (auto _ : state)
+   {
+      buf.clear();
+      for (const cpp_int& v : values)
+         export_bits(v, std::back_inserter(buf), 8, false);
+      benchmark::DoNotOptimize(buf.data());
+   }
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * buf.size()));
+}
+
+static void BM_import_bits(benchmark::State& state)
+{
+   std::vector<cpp_int>                    values = make_values<cpp_int>(static_cast<unsigned>(state.range(0)));
+   std::vector<std::vector<unsigned char> > bufs;
+   std::size_t                             bytes = 0;
+   for (const cpp_int& v : values)
+   {
+      bufs.emplace_back();
+      export_bits(v, std::back_inserter(bufs.back()), 8, false);
+      bytes += bufs.back().size();
+   }
+   std::vector<cpp_int> result(values.size());
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < bufs.size(); ++i)
+         import_bits(result[i], bufs[i].begin(), bufs[i].end(), 8, false);
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+template <class T>
+static void BM_to_string(benchmark::State& state)
+{
+   std::vector<T> values = make_values<T>(static_cast<unsigned>(state.range(0)));
+   std::size_t    bytes  = 0;
+   for (auto _ : state)
+   {
+      bytes = 0;
+      for (const T& v : values)
+         bytes += v.str(std::numeric_limits<T>::max_digits10, std::ios_base::scientific).size();
+   }
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+template <class T>
+static void BM_from_string(benchmark::State& state)
+{
+   std::vector<T>           values = make_values<T>(static_cast<unsigned>(state.range(0)));
+   std::vector<std::string> strings;
+   std::size_t              bytes = 0;
+   for (const T& v : values)
+   {
+      strings.push_back(v.str(std::numeric_limits<T>::max_digits10, std::ios_base::scientific));
+      bytes += strings.back().size();
+   }
+   std::vector<T> result(values.size());
+   for (auto _ : state)
+   {
+      for (std::size_t i = 0; i < strings.size(); ++i)
+         result[i].assign(strings[i]);
+      benchmark::DoNotOptimize(result.data());
+   }
+   state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations() * bytes));
+}
+
+BENCHMARK_TEMPLATE(BM_encode, cpp_int)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_TEMPLATE(BM_decode, cpp_int)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK(BM_export_bits)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK(BM_import_bits)->RangeMultiplier(8)->Range(64, 32768);
+BENCHMARK_TEMPLATE(BM_encode, int256_t)->Arg(256);
+BENCHMARK_TEMPLATE(BM_decode, int256_t)->Arg(256);
+BENCHMARK_TEMPLATE(BM_encode, cpp_rational)->Arg(256);
+BENCHMARK_TEMPLATE(BM_decode, cpp_rational)->Arg(256);
+BENCHMARK_TEMPLATE(BM_encode, cpp_bin_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_decode, cpp_bin_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_to_string, cpp_bin_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_from_string, cpp_bin_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_encode, cpp_dec_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_decode, cpp_dec_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_to_string, cpp_dec_float_50)->Arg(0);
+BENCHMARK_TEMPLATE(BM_from_string, cpp_dec_float_50)->Arg(0);
+
+BENCHMARK_MAIN();
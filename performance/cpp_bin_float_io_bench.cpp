@@ -0,0 +1,82 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Conversions per second between cpp_bin_float and decimal strings: str() at max_digits10,
+// parsing, and to_chars (shortest round trip, into a caller supplied buffer).  The first
+// argument is the range of binary exponents used.
+//
+
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/random.hpp>
+#include <string>
+#include <vector>
+
+using namespace boost::multiprecision;
+
+template <class T>
+static std::vector<T> make_values(int exponent_range)
+{
+   boost::random::mt19937_64 gen;
+   std::vector<T>            result;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      T val = 0;
+      for (int bits = 0; bits < std::numeric_limits<T>::digits; bits += 64)
+         val = ldexp(val, 64) + static_cast<std::uint64_t>(gen());
+      val = ldexp(val, static_cast<int>(gen() % (2 * exponent_range + 1)) - exponent_range - std::numeric_limits<T>::digits);
+      result.push_back((gen() & 1) ? T(-val) : val);
+   }
+   return result;
+}
+
+template <class T>
+static void BM_str(benchmark::State& state)
+{
+   std::vector<T> values = make_values<T>(static_cast<int>(state.range(0)));
+   for (auto _ : state)
+   {
+      for (const T& v : values)
+         benchmark::DoNotOptimize(v.str(std::numeric_limits<T>::max_digits10, std::ios_base::scientific));
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class T>
+static void BM_parse(benchmark::State& state)
+{
+   std::vector<T>           values = make_values<T>(static_cast<int>(state.range(0)));
+   std::vector<std::string> strings;
+   for (const T& v : values)
+      strings.push_back(v.str(std::numeric_limits<T>::max_digits10, std::ios_base::scientific));
+   T result;
+   for (auto _ : state)
+   {
+      for (const std::string& s : strings)
+         benchmark::DoNotOptimize(result.assign(s));
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class T>
+static void BM_to_chars(benchmark::State& state)
+{
+   std::vector<T> values = make_values<T>(static_cast<int>(state.range(0)));
+   char           buf[200];
+   for (auto _ : state)
+   {
+      for (const T& v : values)
+         benchmark::DoNotOptimize(to_chars(buf, buf + sizeof(buf), v).ptr);
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+BENCHMARK_TEMPLATE(BM_str, cpp_bin_float_50)->Arg(30)->Arg(300)->Arg(3000);
+BENCHMARK_TEMPLATE(BM_parse, cpp_bin_float_50)->Arg(30)->Arg(300)->Arg(3000);
+BENCHMARK_TEMPLATE(BM_to_chars, cpp_bin_float_50)->Arg(30)->Arg(300)->Arg(3000);
+BENCHMARK_TEMPLATE(BM_str, cpp_bin_float_quad)->Arg(30)->Arg(300);
+BENCHMARK_TEMPLATE(BM_parse, cpp_bin_float_quad)->Arg(30)->Arg(300);
+BENCHMARK_TEMPLATE(BM_to_chars, cpp_bin_float_quad)->Arg(30)->Arg(300);
+
+BENCHMARK_MAIN();
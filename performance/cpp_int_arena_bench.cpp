@@ -0,0 +1,116 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Compares an expression heavy loop using cpp_int, with the same loop using
+// arena_cpp_int inside a scoped_limb_arena.  The "allocs" counter is the number
+// of calls to global operator new per iteration.
+//
+
+#include <cstdlib>
+#include <new>
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/limb_arena.hpp>
+#include <boost/random.hpp>
+
+using namespace boost::multiprecision;
+
+static std::size_t new_count = 0;
+
+void* operator new(std::size_t n)
+{
+   ++new_count;
+   if (void* p = std::malloc(n ? n : 1))
+      return p;
+   throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept
+{
+   std::free(p);
+}
+
+template <class Integer>
+Integer make_value(unsigned bits)
+{
+   static boost::random::mt19937 gen;
+   Integer                       val = 0;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+//
+// Horner evaluation of a polynomial with big coefficients, followed by some
+// mixed arithmetic: every step creates short lived temporaries.
+//
+template <class Integer>
+Integer kernel(const std::vector<Integer>& coef, const Integer& x, const Integer& m)
+{
+   Integer r = 0;
+   for (const Integer& c : coef)
+      r = (r * x + c) % m;
+   Integer s = r * r - x * (r + 1);
+   return s / (x + 3) + (r >> 7);
+}
+
+template <class Integer>
+static void BM_plain(benchmark::State& state)
+{
+   unsigned             bits = static_cast<unsigned>(state.range(0));
+   std::vector<Integer> coef;
+   for (unsigned i = 0; i < 20; ++i)
+      coef.push_back(make_value<Integer>(bits));
+   Integer     x = make_value<Integer>(bits), m = make_value<Integer>(bits) | 1;
+   std::size_t start = new_count;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(kernel(coef, x, m));
+   state.counters["allocs"] = benchmark::Counter(static_cast<double>(new_count - start), benchmark::Counter::kAvgIterations);
+}
+
+template <class Integer>
+static void BM_arena(benchmark::State& state)
+{
+   unsigned             bits = static_cast<unsigned>(state.range(0));
+   std::vector<Integer> coef;
+   for (unsigned i = 0; i < 20; ++i)
+      coef.push_back(make_value<Integer>(bits));
+   Integer     x = make_value<Integer>(bits), m = make_value<Integer>(bits) | 1;
+   std::size_t start = new_count;
+   for (auto _ : state)
+   {
+      scoped_limb_arena arena;
+      benchmark::DoNotOptimize(kernel(coef, x, m));
+   }
+   state.counters["allocs"] = benchmark::Counter(static_cast<double>(new_count - start), benchmark::Counter::kAvgIterations);
+}
+
+//
+// One arena around many iterations, so that block allocation is amortised too:
+//
+template <class Integer>
+static void BM_arena_outer(benchmark::State& state)
+{
+   unsigned             bits = static_cast<unsigned>(state.range(0));
+   std::vector<Integer> coef;
+   for (unsigned i = 0; i < 20; ++i)
+      coef.push_back(make_value<Integer>(bits));
+   Integer           x = make_value<Integer>(bits), m = make_value<Integer>(bits) | 1;
+   scoped_limb_arena arena;
+   std::size_t       start = new_count;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(kernel(coef, x, m));
+   state.counters["allocs"] = benchmark::Counter(static_cast<double>(new_count - start), benchmark::Counter::kAvgIterations);
+}
+
+BENCHMARK_TEMPLATE(BM_plain, cpp_int)->RangeMultiplier(2)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_arena, arena_cpp_int)->RangeMultiplier(2)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_arena_outer, arena_cpp_int)->RangeMultiplier(2)->Range(128, 8192);
+
+BENCHMARK_MAIN();
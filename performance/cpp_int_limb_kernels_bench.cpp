@@ -0,0 +1,128 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Compares the limb kernels used by cpp_int, as dispatched at runtime, with their
+// portable versions, and times the cpp_int operations built on them.  Build once
+// as is and once with -DBOOST_MP_CPP_INT_NO_DISPATCH to compare the latter.
+//
+
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random.hpp>
+#include <vector>
+
+using namespace boost::multiprecision;
+
+static boost::random::mt19937_64 gen;
+
+static std::vector<limb_type> make_limbs(std::size_t n)
+{
+   std::vector<limb_type> v(n);
+   for (auto& l : v)
+      l = static_cast<limb_type>(gen());
+   return v;
+}
+
+static cpp_int make_value(unsigned bits)
+{
+   cpp_int val = 0;
+   for (unsigned i = 0; i < bits; i += 64)
+   {
+      val <<= 64;
+      val |= static_cast<std::uint64_t>(gen());
+   }
+   return val;
+}
+
+static void BM_addmul_1(benchmark::State& state)
+{
+   std::size_t            n = static_cast<std::size_t>(state.range(0));
+   std::vector<limb_type> a = make_limbs(n), r = make_limbs(n);
+   limb_type              b = static_cast<limb_type>(gen());
+   for (auto _ : state)
+      benchmark::DoNotOptimize(detail::limb_addmul_1(r.data(), a.data(), n, b));
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+static void BM_addmul_1_generic(benchmark::State& state)
+{
+   std::size_t            n = static_cast<std::size_t>(state.range(0));
+   std::vector<limb_type> a = make_limbs(n), r = make_limbs(n);
+   limb_type              b = static_cast<limb_type>(gen());
+   for (auto _ : state)
+      benchmark::DoNotOptimize(detail::limb_addmul_1_generic(r.data(), a.data(), n, b, 0));
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+static void BM_mul_1(benchmark::State& state)
+{
+   std::size_t            n = static_cast<std::size_t>(state.range(0));
+   std::vector<limb_type> a = make_limbs(n), r(n);
+   limb_type              b = static_cast<limb_type>(gen());
+   for (auto _ : state)
+      benchmark::DoNotOptimize(detail::limb_mul_1(r.data(), a.data(), n, b));
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+static void BM_mul_1_generic(benchmark::State& state)
+{
+   std::size_t            n = static_cast<std::size_t>(state.range(0));
+   std::vector<limb_type> a = make_limbs(n), r(n);
+   limb_type              b = static_cast<limb_type>(gen());
+   for (auto _ : state)
+      benchmark::DoNotOptimize(detail::limb_mul_1_generic(r.data(), a.data(), n, b, 0));
+   state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * n));
+}
+
+static void BM_multiply(benchmark::State& state)
+{
+   unsigned bits = static_cast<unsigned>(state.range(0));
+   cpp_int  a = make_value(bits), b = make_value(bits), r;
+   for (auto _ : state)
+   {
+      r = a * b;
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+static void BM_square(benchmark::State& state)
+{
+   unsigned bits = static_cast<unsigned>(state.range(0));
+   cpp_int  a = make_value(bits), r;
+   for (auto _ : state)
+   {
+      r = a * a;
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+static void BM_divide(benchmark::State& state)
+{
+   unsigned bits = static_cast<unsigned>(state.range(0));
+   cpp_int  a = make_value(2 * bits), b = make_value(bits), r;
+   for (auto _ : state)
+   {
+      r = a / b;
+      benchmark::DoNotOptimize(r.backend().limbs());
+   }
+}
+
+static void BM_powm(benchmark::State& state)
+{
+   unsigned bits = static_cast<unsigned>(state.range(0));
+   cpp_int  a = make_value(bits), e = make_value(bits), m = make_value(bits) | 1;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(cpp_int(powm(a, e, m)));
+}
+
+BENCHMARK(BM_addmul_1)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_addmul_1_generic)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_mul_1)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_mul_1_generic)->RangeMultiplier(4)->Range(4, 1024);
+BENCHMARK(BM_multiply)->RangeMultiplier(2)->Range(256, 2048);
+BENCHMARK(BM_square)->RangeMultiplier(2)->Range(256, 2048);
+BENCHMARK(BM_divide)->RangeMultiplier(2)->Range(256, 4096);
+BENCHMARK(BM_powm)->RangeMultiplier(2)->Range(512, 2048);
+
+BENCHMARK_MAIN();
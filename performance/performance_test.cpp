@@ -27,6 +27,9 @@
 // TEST_CPP_BIN_FLOAT
 // TEST_CPP_DOUBLE_FLOAT
 //
+// Defining BOOST_MP_CPP_INT_NO_FIXED_WIDTH_KERNELS as well times the cpp_int(fixed) types
+// without their unrolled arithmetic, for comparison.
+//
 
 #include "performance_test.hpp"
 
@@ -217,6 +220,9 @@ int main()
    test49();
    test50();
    test51();
+   test54();
+   test55();
+   test56();
 
    quickbook_results();
    return 0;
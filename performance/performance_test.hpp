@@ -783,4 +783,7 @@ void test49();
 void test50();
 void test51();
 void test52();
+void test54();
+void test55();
+void test56();
 
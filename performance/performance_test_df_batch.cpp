@@ -0,0 +1,119 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+// Compares the batched kernels in cpp_double_fp_batch.hpp with the same
+// operations written as loops over arrays of cpp_double_float and cpp_double_double.
+
+#include <boost/multiprecision/cpp_double_fp_batch.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t size   = 4096;
+constexpr std::size_t repeat = 200;
+constexpr std::size_t degree = 8;
+
+template <class F>
+double time_it(F f)
+{
+   double best = 1e300;
+   for (unsigned trial = 0; trial < 5; ++trial)
+   {
+      const auto start = std::chrono::steady_clock::now();
+      for (std::size_t i = 0; i < repeat; ++i)
+         f();
+      const auto stop = std::chrono::steady_clock::now();
+      best            = (std::min)(best, std::chrono::duration<double, std::nano>(stop - start).count() / (repeat * size));
+   }
+   return best;
+}
+
+void report(const std::string& type, const std::string& op, double scalar, double batch)
+{
+   std::cout << std::left << std::setw(20) << type << std::setw(8) << op << std::right << std::fixed << std::setprecision(2)
+             << std::setw(10) << scalar << std::setw(10) << batch << std::setw(10) << scalar / batch << "\n";
+}
+
+template <class FloatingPointType>
+void test(const std::string& type)
+{
+   using batch_type = boost::multiprecision::cpp_double_fp_batch<FloatingPointType>;
+   using value_type = typename batch_type::value_type;
+
+   std::mt19937                                      gen;
+   std::uniform_real_distribution<FloatingPointType> dist(-1, 1);
+
+   std::vector<value_type> a(size), b(size), c(size), r(size), coef(degree + 1);
+   for (std::size_t i = 0; i < size; ++i)
+   {
+      a[i] = value_type(dist(gen)) / 3;
+      b[i] = value_type(dist(gen)) / 7;
+      c[i] = value_type(dist(gen)) / 11;
+   }
+   for (auto& k : coef)
+      k = value_type(dist(gen)) / 13;
+   const value_type alpha = value_type(1) / 3;
+
+   const batch_type ba(a.begin(), a.end()), bb(b.begin(), b.end()), bc(c.begin(), c.end()), bcoef(coef.begin(), coef.end());
+   batch_type       br(size);
+
+   double scalar = time_it([&]() { for (std::size_t i = 0; i < size; ++i) r[i] = a[i] + b[i]; });
+   double batch  = time_it([&]() { boost::multiprecision::batch_add(br, ba, bb); });
+   report(type, "add", scalar, batch);
+
+   scalar = time_it([&]() { for (std::size_t i = 0; i < size; ++i) r[i] = a[i] * b[i]; });
+   batch  = time_it([&]() { boost::multiprecision::batch_multiply(br, ba, bb); });
+   report(type, "mul", scalar, batch);
+
+   scalar = time_it([&]() { for (std::size_t i = 0; i < size; ++i) r[i] = a[i] * b[i] + c[i]; });
+   batch  = time_it([&]() { boost::multiprecision::batch_fma(br, ba, bb, bc); });
+   report(type, "fma", scalar, batch);
+
+   scalar = time_it([&]() { for (std::size_t i = 0; i < size; ++i) r[i] += alpha * a[i]; });
+   batch  = time_it([&]() { boost::multiprecision::batch_axpy(alpha, ba, br); });
+   report(type, "axpy", scalar, batch);
+
+   value_type sink = 0;
+   scalar          = time_it([&]() { value_type s = 0; for (std::size_t i = 0; i < size; ++i) s += a[i] * b[i]; sink += s; });
+   batch           = time_it([&]() { sink += boost::multiprecision::batch_dot(ba, bb); });
+   report(type, "dot", scalar, batch);
+
+   scalar = time_it([&]() {
+      for (std::size_t i = 0; i < size; ++i)
+      {
+         value_type p = coef[degree];
+         for (std::size_t k = degree; k-- > 0;)
+            p = p * a[i] + coef[k];
+         r[i] = p;
+      }
+   });
+   batch  = time_it([&]() { boost::multiprecision::batch_horner(br, ba, bcoef); });
+   report(type, "horner", scalar, batch);
+
+   // Keep the results alive:
+   if (sink == 42)
+      std::cout << sink << r[0] << br.get(0) << "\n";
+}
+
+} // namespace
+
+int main()
+{
+   std::cout << std::left << std::setw(20) << "Type" << std::setw(8) << "Op" << std::right << std::setw(10) << "Scalar" << std::setw(10) << "Batch"
+             << std::setw(10) << "Speedup" << "\n(times in ns per element)\n";
+
+   test<float>("cpp_double_float");
+   test<double>("cpp_double_double");
+
+   return 0;
+}
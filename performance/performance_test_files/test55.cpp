@@ -0,0 +1,16 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+#include "../performance_test.hpp"
+#if defined(TEST_CPP_INT)
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+
+void test55()
+{
+#ifdef TEST_CPP_INT
+   test<boost::multiprecision::number<boost::multiprecision::cpp_int_backend<512, 512, boost::multiprecision::unsigned_magnitude, boost::multiprecision::unchecked, void>, boost::multiprecision::et_off> >("cpp_int(unsigned, fixed)", 512);
+#endif
+}
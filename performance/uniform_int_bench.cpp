@@ -0,0 +1,60 @@
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+// Samples per second from uniform_int_distribution over [0, 2^bits), for the limb
+// filling version, bulk generation, and the generic algorithm it replaces.
+//
+
+#include <benchmark/benchmark.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/gmp.hpp>
+#include <random>
+#include <vector>
+
+using namespace boost::multiprecision;
+
+template <class T>
+static void BM_sample(benchmark::State& state)
+{
+   std::mt19937_64             gen;
+   uniform_int_distribution<T> dist(0, (T(1) << state.range(0)) - 1);
+   for (auto _ : state)
+      benchmark::DoNotOptimize(dist(gen));
+   state.SetItemsProcessed(state.iterations());
+}
+
+template <class T>
+static void BM_generate(benchmark::State& state)
+{
+   std::mt19937_64             gen;
+   uniform_int_distribution<T> dist(0, (T(1) << state.range(0)) - 1);
+   std::vector<T>              values(1000);
+   for (auto _ : state)
+   {
+      dist.generate(values.begin(), values.end(), gen);
+      benchmark::DoNotOptimize(values.data());
+   }
+   state.SetItemsProcessed(state.iterations() * values.size());
+}
+
+template <class T>
+static void BM_generic(benchmark::State& state)
+{
+   std::mt19937_64 gen;
+   const T         a(0), b = (T(1) << state.range(0)) - 1;
+   for (auto _ : state)
+      benchmark::DoNotOptimize(boost::multiprecision::detail::generate_uniform_int<std::mt19937_64, T>(gen, a, b));
+   state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_sample, cpp_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_generate, cpp_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_generic, cpp_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_sample, mpz_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_generate, mpz_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_generic, mpz_int)->RangeMultiplier(4)->Range(128, 8192);
+BENCHMARK_TEMPLATE(BM_sample, uint512_t)->Arg(511);
+BENCHMARK_TEMPLATE(BM_generic, uint512_t)->Arg(511);
+
+BENCHMARK_MAIN();
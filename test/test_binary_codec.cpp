@@ -0,0 +1,280 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Round trip the binary encoding of cpp_int, cpp_bin_float, cpp_dec_float and
+// the rational types, and check the byte layout against known encodings.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937_64 gen;
+
+cpp_int random_integer(unsigned max_bits)
+{
+   unsigned bits = static_cast<unsigned>(gen() % max_bits) + 1;
+   cpp_int  val  = 0;
+   for (unsigned i = 0; i < bits; i += 64)
+   {
+      val <<= 64;
+      val |= static_cast<std::uint64_t>(gen());
+   }
+   val >>= (bits + 63) / 64 * 64 - bits;
+   if (gen() & 1)
+      val = -val;
+   return val;
+}
+
+template <class T>
+T random_float()
+{
+   T val = T(random_integer(std::numeric_limits<T>::digits + 100));
+   if (val == 0)
+      return val;
+   val = ldexp(val, static_cast<int>(gen() % 2000) - 1000 - ilogb(val));
+   return val;
+}
+
+template <class T>
+std::vector<unsigned char> encode(const T& val)
+{
+   std::vector<unsigned char> buf(binary_encoded_size(val));
+   unsigned char*             p = binary_encode(val, buf.data(), buf.data() + buf.size());
+   BOOST_CHECK(p == buf.data() + buf.size());
+   return buf;
+}
+
+template <class T>
+T decode(const std::vector<unsigned char>& buf)
+{
+   T                    result;
+   const unsigned char* p = binary_decode(result, buf.data(), buf.data() + buf.size());
+   BOOST_CHECK(p == buf.data() + buf.size());
+   return result;
+}
+
+template <class T>
+void check_round_trip(const T& val)
+{
+   T result = decode<T>(encode(val));
+   BOOST_CHECK_EQUAL(result, val);
+}
+
+template <class T>
+void check_encoding(const T& val, std::vector<unsigned char> const& expected)
+{
+   std::vector<unsigned char> buf = encode(val);
+   BOOST_CHECK(buf == expected);
+   check_round_trip(val);
+}
+
+template <class T>
+void check_array(const std::vector<T>& values)
+{
+   std::vector<unsigned char> buf(binary_encoded_array_size(values.data(), values.size()));
+   unsigned char*             p = binary_encode_array(values.data(), values.size(), buf.data(), buf.data() + buf.size());
+   BOOST_CHECK(p == buf.data() + buf.size());
+   BOOST_CHECK_EQUAL(buf[0], 'M');
+   BOOST_CHECK_EQUAL(buf[1], 'P');
+   BOOST_CHECK_EQUAL(buf[2], 1);
+
+   std::vector<T>       result;
+   const unsigned char* q = binary_decode_array(result, buf.data(), buf.data() + buf.size());
+   BOOST_CHECK(q == buf.data() + buf.size());
+   BOOST_CHECK(result == values);
+
+#ifndef BOOST_NO_EXCEPTIONS
+   // Truncated input, and a buffer that's too small:
+   if (buf.size() > 4)
+   {
+      BOOST_CHECK_THROW(binary_decode_array(result, buf.data(), buf.data() + buf.size() - 1), std::runtime_error);
+      BOOST_CHECK_THROW(binary_encode_array(values.data(), values.size(), buf.data(), buf.data() + buf.size() - 1), std::length_error);
+   }
+   std::vector<unsigned char> bad(buf);
+   bad[0] = 'X';
+   BOOST_CHECK_THROW(binary_decode_array(result, bad.data(), bad.data() + bad.size()), std::runtime_error);
+   bad    = buf;
+   bad[2] = 2;
+   BOOST_CHECK_THROW(binary_decode_array(result, bad.data(), bad.data() + bad.size()), std::runtime_error);
+#endif
+
+#ifdef BOOST_MP_HAS_STD_SPAN
+   std::span<unsigned char> rest = binary_encode_array(std::span<const T>(values), std::span<unsigned char>(buf));
+   BOOST_CHECK(rest.empty());
+   std::span<const unsigned char> in = binary_decode_array(result, std::span<const unsigned char>(buf));
+   BOOST_CHECK(in.empty());
+   BOOST_CHECK(result == values);
+#endif
+}
+
+template <class T>
+void test_integers(unsigned max_bits)
+{
+   std::vector<T> values;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      cpp_int v = random_integer(max_bits);
+      if (!std::numeric_limits<T>::is_signed)
+         v = abs(v);
+      values.push_back(T(v));
+      check_round_trip(values.back());
+   }
+   values.push_back(T(0));
+   check_round_trip(T(0));
+   check_array(values);
+}
+
+template <class T>
+void test_floats()
+{
+   std::vector<T> values;
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      values.push_back(random_float<T>());
+      check_round_trip(values.back());
+      values.push_back(T(static_cast<long long>(gen() >> 40)));
+      check_round_trip(values.back());
+   }
+   values.push_back(T(0));
+   values.push_back(std::numeric_limits<T>::infinity());
+   values.push_back(-std::numeric_limits<T>::infinity());
+   values.push_back((std::numeric_limits<T>::max)());
+   values.push_back((std::numeric_limits<T>::min)());
+   values.push_back(-(std::numeric_limits<T>::max)());
+   values.push_back(std::numeric_limits<T>::epsilon());
+   for (const T& v : values)
+      check_round_trip(v);
+   check_array(values);
+
+   T nan = decode<T>(encode(std::numeric_limits<T>::quiet_NaN()));
+   BOOST_CHECK((boost::multiprecision::isnan)(nan));
+}
+
+template <class T>
+void test_rationals()
+{
+   std::vector<T> values;
+   for (unsigned i = 0; i < 500; ++i)
+   {
+      cpp_int d = abs(random_integer(300));
+      values.push_back(T(random_integer(300), d ? d : cpp_int(1)));
+      check_round_trip(values.back());
+   }
+   check_array(values);
+}
+
+int main()
+{
+   //
+   // Integers: varint (byte count << 1 | sign) then the magnitude, least significant byte first:
+   //
+   check_encoding(cpp_int(0), {0x00});
+   check_encoding(cpp_int(1), {0x02, 0x01});
+   check_encoding(cpp_int(-1), {0x03, 0x01});
+   check_encoding(cpp_int(0x1234), {0x04, 0x34, 0x12});
+   check_encoding(cpp_int(1) << 64, {0x12, 0, 0, 0, 0, 0, 0, 0, 0, 0x01});
+   std::vector<unsigned char> expected(67);
+   expected[0]  = 0x83; // 65 bytes, negative
+   expected[1]  = 0x01;
+   expected[66] = 0x01;
+   check_encoding(-(cpp_int(1) << 512), expected);
+   check_encoding(int128_t(-0x1234), {0x05, 0x34, 0x12});
+   check_encoding(uint256_t(0x1234), {0x04, 0x34, 0x12});
+   //
+   // Binary floats: flags (class | sign << 2), zig-zag exponent, mantissa bytes:
+   //
+   check_encoding(cpp_bin_float_50(0), {0x00});
+   check_encoding(-cpp_bin_float_50(0), {0x04});
+   check_encoding(cpp_bin_float_50(1), {0x01, 0x00, 0x01, 0x01});
+   check_encoding(cpp_bin_float_double(-2.5), {0x05, 0x01, 0x01, 0x05});
+   check_encoding(cpp_bin_float_50(768), {0x01, 0x10, 0x01, 0x03});
+   check_encoding(std::numeric_limits<cpp_bin_float_50>::infinity(), {0x02});
+   //
+   // Decimal floats: flags, zig-zag base 10 exponent, element count, base 10^8 elements:
+   //
+   check_encoding(cpp_dec_float_50(0), {0x00});
+   check_encoding(cpp_dec_float_50(1), {0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00});
+   check_encoding(cpp_dec_float_50(-1.5), {0x05, 0x00, 0x02, 0x01, 0x00, 0x00, 0x00, 0x80, 0xF0, 0xFA, 0x02});
+   //
+   // Rationals: numerator then denominator:
+   //
+   check_encoding(cpp_rational(-3, 4), {0x03, 0x03, 0x02, 0x04});
+
+   test_integers<cpp_int>(5000);
+   test_integers<int128_t>(127);
+   test_integers<uint256_t>(256);
+   test_integers<int1024_t>(1023);
+   test_integers<checked_int512_t>(511);
+   test_integers<number<cpp_int_backend<50, 50, unsigned_magnitude, unchecked, void> > >(50);
+
+   test_floats<cpp_bin_float_double>();
+   test_floats<cpp_bin_float_50>();
+   test_floats<cpp_bin_float_quad>();
+   test_floats<number<cpp_bin_float<300, digit_base_10, std::allocator<char> > > >();
+   test_floats<cpp_dec_float_50>();
+   test_floats<cpp_dec_float_100>();
+
+   test_rationals<cpp_rational>();
+   test_rationals<number<rational_adaptor<cpp_int_backend<>, lazy_normalize<256> > > >();
+
+   //
+   // Values decode into other types, rounding or truncating as conversions do:
+   //
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      cpp_int a = random_integer(2000);
+      BOOST_CHECK_EQUAL(decode<int256_t>(encode(a)), int256_t(a));
+      BOOST_CHECK_EQUAL(decode<cpp_int>(encode(int256_t(a))), cpp_int(int256_t(a)));
+
+      cpp_bin_float_100 f = random_float<cpp_bin_float_100>();
+      BOOST_CHECK_EQUAL(decode<cpp_bin_float_50>(encode(f)), cpp_bin_float_50(f));
+      BOOST_CHECK_EQUAL(decode<cpp_bin_float_100>(encode(cpp_bin_float_50(f))), cpp_bin_float_100(cpp_bin_float_50(f)));
+   }
+   // A lazily normalized rational is written in lowest terms:
+   number<rational_adaptor<cpp_int_backend<>, lazy_normalize<256> > > lazy(1, 3);
+   lazy += lazy;
+   BOOST_CHECK(encode(lazy) == encode(cpp_rational(2, 3)));
+
+#ifndef BOOST_NO_EXCEPTIONS
+   // Out of range for a checked type:
+   BOOST_CHECK_THROW(decode<checked_int128_t>(encode(cpp_int(1) << 200)), std::overflow_error);
+   BOOST_CHECK_THROW(decode<checked_int256_t>(encode(cpp_int(1) << 300)), std::overflow_error);
+   // Malformed input:
+   BOOST_CHECK_THROW(decode<cpp_int>({0x04, 0x01}), std::runtime_error);
+   BOOST_CHECK_THROW(decode<cpp_int>({0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}), std::runtime_error);
+   BOOST_CHECK_THROW(decode<cpp_bin_float_50>({0x09}), std::runtime_error);
+   BOOST_CHECK_THROW(decode<cpp_bin_float_50>({0x01, 0x00, 0x01, 0x00}), std::runtime_error);
+   BOOST_CHECK_THROW(decode<cpp_dec_float_50>({0x01, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF}), std::runtime_error);
+   BOOST_CHECK_THROW(decode<cpp_rational>({0x02, 0x01, 0x00}), std::runtime_error);
+   std::vector<unsigned char> small(2);
+   BOOST_CHECK_THROW(binary_encode(cpp_int(0x123456), small.data(), small.data() + small.size()), std::length_error);
+#endif
+
+#ifdef BOOST_MP_HAS_STD_SPAN
+   // Streaming several values through one buffer:
+   std::vector<unsigned char> buf(64);
+   std::span<unsigned char>   out = binary_encode(cpp_int(-12345), std::span<unsigned char>(buf));
+   out                            = binary_encode(cpp_rational(1, 7), out);
+   cpp_int                        a;
+   cpp_rational                   b;
+   std::span<const unsigned char> in = binary_decode(a, std::span<const unsigned char>(buf.data(), buf.size() - out.size()));
+   in                                = binary_decode(b, in);
+   BOOST_CHECK(in.empty());
+   BOOST_CHECK_EQUAL(a, -12345);
+   BOOST_CHECK_EQUAL(b, cpp_rational(1, 7));
+#endif
+   return boost::report_errors();
+}
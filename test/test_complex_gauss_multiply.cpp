@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/detail/lightweight_test.hpp>
+#include "test.hpp"
+
+#include <boost/multiprecision/cpp_complex.hpp>
+#include <random>
+
+//
+// Above complex_adaptor_gauss_multiply_bits products, squares and norms use fewer real
+// multiplications, compare them with the same values computed at twice the precision:
+//
+template <class T>
+T random_value(std::mt19937& gen)
+{
+   std::uniform_real_distribution<double> dist(-1, 1);
+   std::uniform_int_distribution<int>     exp_dist(-12, 12);
+
+   T result = dist(gen);
+   for (unsigned i = 0; i < 40; ++i)
+      result = result * 1073741824.0 + dist(gen);
+   return ldexp(result, exp_dist(gen) - 40 * 30);
+}
+
+template <class Real, class Real2>
+bool close_to(const Real& a, const Real2& exact, const Real2& scale, unsigned bits)
+{
+   // |a - exact| <= 2^bits ulp of scale:
+   if (scale == 0)
+      return a == 0;
+   return abs(Real2(a) - exact) <= ldexp(scale * std::numeric_limits<Real>::epsilon(), static_cast<int>(bits));
+}
+
+template <unsigned Digits>
+void test()
+{
+   using namespace boost::multiprecision;
+   using complex_type  = number<complex_adaptor<cpp_bin_float<Digits> >, et_off>;
+   using real_type     = number<cpp_bin_float<Digits>, et_off>;
+   using complex2_type = number<complex_adaptor<cpp_bin_float<Digits * 2> >, et_off>;
+   using real2_type    = number<cpp_bin_float<Digits * 2>, et_off>;
+
+   std::mt19937 gen;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      real_type x = random_value<real_type>(gen), y = random_value<real_type>(gen), u = random_value<real_type>(gen), v = random_value<real_type>(gen);
+      // Some components of very different magnitude, and some zeros:
+      if (i % 7 == 0)
+         y = ldexp(y, -200);
+      if (i % 11 == 0)
+         v = 0;
+
+      const complex_type  a(x, y), b(u, v);
+      const complex2_type a2{real2_type(x), real2_type(y)}, b2{real2_type(u), real2_type(v)};
+
+      complex_type  r  = a * b;
+      complex2_type r2 = a2 * b2;
+      BOOST_CHECK(close_to(real(r), real(r2), real2_type(abs(x * u) + abs(y * v)), 7));
+      BOOST_CHECK(close_to(imag(r), imag(r2), real2_type(abs(x * v) + abs(y * u)), 7));
+
+      complex_type t(a);
+      t *= b;
+      BOOST_CHECK_EQUAL(t, r);
+      t = b;
+      t *= a;
+      BOOST_CHECK(close_to(real(t), real(r2), real2_type(abs(x * u) + abs(y * v)), 7));
+      BOOST_CHECK(close_to(imag(t), imag(r2), real2_type(abs(x * v) + abs(y * u)), 7));
+
+      r  = a * a;
+      r2 = a2 * a2;
+      BOOST_CHECK(close_to(real(r), real(r2), real2_type(x * x + y * y), 2));
+      BOOST_CHECK(close_to(imag(r), imag(r2), real2_type(abs(imag(r2))), 2));
+      t = a;
+      t *= t;
+      BOOST_CHECK_EQUAL(t, r);
+
+      real_type  n  = norm(a);
+      real2_type n2 = norm(a2);
+      BOOST_CHECK(close_to(n, n2, n2, 2));
+      BOOST_CHECK_EQUAL(n, x * x + y * y);
+      BOOST_CHECK(close_to(abs(a), real2_type(abs(a2)), real2_type(abs(a2)), 2));
+   }
+
+   // Non-finite values and signed zeros are treated as by the usual form:
+   const real_type   inf = std::numeric_limits<real_type>::infinity();
+   const complex_type z(inf, 2), w(3, 4);
+   complex_type       r = z * w;
+   BOOST_CHECK_EQUAL(real(r), inf);
+   BOOST_CHECK_EQUAL(imag(r), inf);
+   r = z * z;
+   BOOST_CHECK_EQUAL(real(r), inf);
+   BOOST_CHECK_EQUAL(imag(r), inf);
+   r = complex_type(real_type(-0.0), 0) * complex_type(real_type(-0.0), 0);
+   BOOST_CHECK(!signbit(real(r)));
+   BOOST_CHECK(signbit(imag(r)));
+   BOOST_CHECK_EQUAL(norm(z), inf);
+}
+
+int main()
+{
+   test<50>();
+   test<400>();
+   test<1000>();
+
+   return boost::report_errors();
+}
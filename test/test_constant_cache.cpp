@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// The constants pi, e and ln(2) are shared between threads, and variable precision
+// types round them from the most precise value computed so far: check that every
+// thread sees correct values whatever order the precisions are requested in.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+//
+// Compares with values computed directly, without the cache, with twice the precision
+// when the type allows it, as the values in the cache carry guard digits:
+//
+template <class Number>
+void check_close(const Number& num, const Number& expected, unsigned tolerance)
+{
+   // mpf_float has no numeric_limits support, so we derive epsilon from digits2:
+   Number eps = ldexp(Number(1), 1 - static_cast<int>(boost::multiprecision::detail::digits2<Number>::value()));
+   BOOST_CHECK_LE(Number(abs((num - expected) / expected)), eps * tolerance);
+}
+
+template <class Number>
+void check_constants(unsigned tolerance)
+{
+   using backend_type = typename Number::backend_type;
+   backend_type pi, e, ln2;
+   {
+      boost::multiprecision::detail::scoped_precision_options<Number> scope(static_cast<unsigned>(2 * boost::multiprecision::detail::digits2_2_10(boost::multiprecision::detail::digits2<Number>::value())));
+      const unsigned digits = static_cast<unsigned>(boost::multiprecision::detail::digits2<Number>::value());
+      boost::multiprecision::detail::maybe_promote_precision(&pi);
+      boost::multiprecision::detail::maybe_promote_precision(&e);
+      boost::multiprecision::detail::maybe_promote_precision(&ln2);
+      // Found by ADL where the backend has its own methods:
+      using default_ops::calc_pi;
+      using default_ops::calc_e;
+      using default_ops::calc_log2;
+      calc_pi(pi, digits);
+      calc_e(e, digits);
+      calc_log2(ln2, digits);
+   }
+   Number num;
+   num.backend() = default_ops::get_constant_pi<backend_type>();
+   check_close(num, Number(pi), tolerance);
+   num.backend() = default_ops::get_constant_e<backend_type>();
+   check_close(num, Number(e), tolerance);
+   num.backend() = default_ops::get_constant_ln2<backend_type>();
+   check_close(num, Number(ln2), tolerance);
+}
+
+template <class Number>
+void test_fixed()
+{
+   using backend_type = typename Number::backend_type;
+   //
+   // All threads share the one value:
+   //
+   std::vector<const backend_type*> seen(4);
+   std::vector<std::thread>         threads;
+   for (unsigned i = 0; i < seen.size(); ++i)
+      threads.emplace_back([&seen, i]() {
+         seen[i] = &default_ops::get_constant_pi<backend_type>();
+      });
+   for (std::thread& t : threads)
+      t.join();
+   for (unsigned i = 1; i < seen.size(); ++i)
+      BOOST_CHECK(seen[i] == seen[0]);
+   BOOST_CHECK(&default_ops::get_constant_pi<backend_type>() == seen[0]);
+   check_constants<Number>(2);
+}
+
+void test_variable()
+{
+   //
+   // Each thread works through a different sequence of precisions, some below and some
+   // above the precision at which the constants stop being read from strings:
+   //
+   const unsigned precisions[] = {30, 1500, 50, 400, 3000, 20, 1100, 2000};
+   const unsigned count        = sizeof(precisions) / sizeof(precisions[0]);
+
+   std::vector<std::thread> threads;
+   for (unsigned t = 0; t < 4; ++t)
+      threads.emplace_back([&precisions, t]() {
+         for (unsigned i = 0; i < count; ++i)
+         {
+            mpf_float::thread_default_precision(precisions[(i + t * 3) % count]);
+            check_constants<mpf_float>(1);
+            BOOST_CHECK_EQUAL(default_ops::get_constant_e<gmp_float<0> >().precision(), mpf_float::thread_default_precision());
+            // Repeated use at the same precision returns the thread local copy:
+            BOOST_CHECK(&default_ops::get_constant_pi<gmp_float<0> >() == &default_ops::get_constant_pi<gmp_float<0> >());
+         }
+      });
+   for (std::thread& t : threads)
+      t.join();
+
+   mpf_float::thread_default_precision(60);
+   mpf_float pi = boost::math::constants::pi<mpf_float>();
+   BOOST_CHECK_EQUAL(pi.precision(), 60u);
+   BOOST_CHECK(abs(mpf_float(sin(pi))) < ldexp(mpf_float(1), -190));
+}
+
+int main()
+{
+   // Precomputing is allowed at any time, and harmless if the values already exist:
+   preload_constants<mpf_float>(5000);
+   preload_constants<cpp_bin_float_100>();
+   preload_constants<mpf_float>(100);
+
+   test_fixed<cpp_bin_float_100>();
+   test_fixed<number<cpp_dec_float<1500> > >();
+   test_fixed<number<cpp_bin_float<5000> > >();
+   test_variable();
+
+   return boost::report_errors();
+}
@@ -0,0 +1,96 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Above the precision of the stored strings, cpp_bin_float and cpp_dec_float compute
+// pi, e and ln(2) by binary splitting: compare with the generic methods used by
+// mpf_float at higher precision, and check that splitting the work between threads
+// gives the same result.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_dec_float.hpp>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+template <class T>
+void check_close(const T& val, const gmp_float<0>& expected, const char* tolerance)
+{
+   mpf_float e(expected);
+   BOOST_CHECK_LE(mpf_float(abs((mpf_float(val) - e) / e)), mpf_float(tolerance));
+}
+
+template <class T>
+void test(const char* tolerance)
+{
+   using backend_type = typename T::backend_type;
+
+   const unsigned digits = static_cast<unsigned>(boost::multiprecision::detail::digits2<T>::value());
+   BOOST_CHECK_GE(digits, default_ops::constant_string_bits);
+
+   mpf_float::default_precision(std::numeric_limits<T>::digits10 + 50);
+   gmp_float<0> pi, e, ln2;
+   default_ops::calc_pi(pi, digits + 128);
+   default_ops::calc_e(e, digits + 128);
+   default_ops::calc_log2(ln2, digits + 128);
+
+   backend_type val;
+   calc_pi(val, digits);
+   check_close(T(val), pi, tolerance);
+   calc_e(val, digits);
+   check_close(T(val), e, tolerance);
+   calc_log2(val, digits);
+   check_close(T(val), ln2, tolerance);
+   //
+   // The public interface has the same accuracy:
+   //
+   check_close(boost::math::constants::pi<T>(), pi, tolerance);
+   check_close(boost::math::constants::e<T>(), e, tolerance);
+   check_close(boost::math::constants::ln_two<T>(), ln2, tolerance);
+}
+
+void test_threads()
+{
+   //
+   // The splitting is the same whether or not the subtrees run on other threads:
+   //
+   const auto leaf = [](boost::multiprecision::detail::binary_splitting_terms& t, std::uint64_t n) {
+      t.P = 2 * n + 1;
+      t.Q = 3 * n + 7;
+      t.B = n + 1;
+      t.T = n % 3;
+      if (n & 1u)
+         t.T = -t.T;
+   };
+   boost::multiprecision::detail::binary_splitting_terms serial, parallel;
+   boost::multiprecision::detail::binary_split(serial, 0, 20000, leaf, 1);
+   boost::multiprecision::detail::binary_split(parallel, 0, 20000, leaf, 5);
+   BOOST_CHECK_EQUAL(serial.P, parallel.P);
+   BOOST_CHECK_EQUAL(serial.Q, parallel.Q);
+   BOOST_CHECK_EQUAL(serial.B, parallel.B);
+   BOOST_CHECK_EQUAL(serial.T, parallel.T);
+}
+
+int main()
+{
+   // cpp_bin_float is correctly rounded, in all but the rarest cases, so the relative
+   // error is at most 2^-bits:
+   test<number<cpp_bin_float<4000, digit_base_2> > >("1e-1204");
+   test<number<cpp_bin_float<30000, digit_base_2> > >("2e-9031");
+   test<number<cpp_bin_float<2000> > >("3e-2001");
+   // cpp_dec_float carries guard digits beyond epsilon:
+   test<number<cpp_dec_float<1200> > >("1e-1200");
+   test<number<cpp_dec_float<5000> > >("1e-5000");
+
+   test_threads();
+
+   return boost::report_errors();
+}
@@ -0,0 +1,129 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Division and square root by Newton iteration, with the thresholds lowered so that
+// modest precisions take the new code path: check that the results are correctly
+// rounded by comparing with the midpoints between the result and its neighbours,
+// computed exactly at three times the precision.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#define BOOST_MP_CPP_BIN_FLOAT_NEWTON_DIVISION_BITS 500
+#define BOOST_MP_CPP_BIN_FLOAT_NEWTON_SQRT_BITS 500
+#define BOOST_MP_NEWTON_BASE_BITS 100
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/math/special_functions/next.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937 gen;
+
+template <class T>
+T generate_random(int e_range)
+{
+   T val = gen();
+   T prev_val = -1;
+   while (val != prev_val)
+   {
+      val *= (gen.max)();
+      prev_val = val;
+      val += gen();
+   }
+   int e;
+   val = frexp(val, &e);
+   boost::random::uniform_int_distribution<int> ui(-e_range, e_range);
+   return ldexp(val, ui(gen));
+}
+
+template <class T, class T3>
+void check_divide(const T& u, const T& v)
+{
+   T q = u / v;
+   BOOST_CHECK_EQUAL(q, -(-u / v));
+   //
+   // |u / v| lies between the midpoints lo and hi when lo |v| <= |u| <= hi |v|, which are exact
+   // at three times the precision:
+   //
+   q     = abs(q);
+   T3 lo = (T3(q) + T3(boost::math::float_prior(q))) / 2;
+   T3 hi = (T3(q) + T3(boost::math::float_next(q))) / 2;
+   BOOST_CHECK_LE(lo * T3(abs(v)), T3(abs(u)));
+   BOOST_CHECK_GE(hi * T3(abs(v)), T3(abs(u)));
+}
+
+template <class T, class T3>
+void check_sqrt(const T& x)
+{
+   T s = sqrt(x);
+   T3 lo = (T3(s) + T3(boost::math::float_prior(s))) / 2;
+   T3 hi = (T3(s) + T3(boost::math::float_next(s))) / 2;
+   BOOST_CHECK_LE(lo * lo, T3(x));
+   BOOST_CHECK_GE(hi * hi, T3(x));
+}
+
+template <class T, class T3>
+void test(unsigned count)
+{
+   for (unsigned i = 0; i < count; ++i)
+   {
+      T u = generate_random<T>(100);
+      T v = generate_random<T>(100);
+      check_divide<T, T3>(u, v);
+      check_divide<T, T3>(-u, v);
+      check_divide<T, T3>(v, u);
+      check_sqrt<T, T3>(u);
+      check_sqrt<T, T3>(ldexp(u, 1));
+      //
+      // Exact quotients and roots, where the Newton iteration can't decide the rounding
+      // and the exact remainder is used instead:
+      //
+      T w = ldexp(trunc(ldexp(v, std::numeric_limits<T>::digits / 2 - 1 - ilogb(v))), ilogb(v) - 3);
+      T x = ldexp(trunc(ldexp(u, std::numeric_limits<T>::digits / 2 - 1 - ilogb(u))), ilogb(u));
+      check_divide<T, T3>(w * x, x);
+      BOOST_CHECK_EQUAL((w * x) / x, w);
+      BOOST_CHECK_EQUAL(sqrt(x * x), abs(x));
+      T odd = ldexp(T(1), std::numeric_limits<T>::digits - 1) + 2 * (gen() / 2) + 1;
+      check_divide<T, T3>(odd, T(2));
+      check_divide<T, T3>(odd, T(-2));
+      check_divide<T, T3>(odd, T(3));
+      check_sqrt<T, T3>(x * x * (1 + std::numeric_limits<T>::epsilon()));
+      check_sqrt<T, T3>(x * x * (1 - std::numeric_limits<T>::epsilon()));
+      check_sqrt<T, T3>(boost::math::float_next(x * x));
+      check_sqrt<T, T3>(boost::math::float_prior(x * x));
+   }
+   //
+   // Special values are handled as before:
+   //
+   BOOST_CHECK_EQUAL(T(1) / T(3) * 3, 1);
+   BOOST_CHECK_EQUAL(T(2) / T(2), 1);
+   BOOST_CHECK_EQUAL(sqrt(T(4)), 2);
+   BOOST_CHECK_EQUAL(sqrt(T(0)), 0);
+   BOOST_CHECK((boost::math::isinf)(T(1) / T(0)));
+   BOOST_CHECK((boost::math::isnan)(sqrt(T(-1))));
+   T y = 2;
+   y   = sqrt(y);
+   BOOST_CHECK_EQUAL(y, sqrt(T(2)));
+   y = 2;
+   y /= y;
+   BOOST_CHECK_EQUAL(y, 1);
+}
+
+int main()
+{
+   test<number<cpp_bin_float<500, digit_base_2> >, number<cpp_bin_float<1600, digit_base_2> > >(200);
+   test<number<cpp_bin_float<777, digit_base_2, void, std::int32_t, -100000, 100000> >, number<cpp_bin_float<2400, digit_base_2> > >(200);
+   test<number<cpp_bin_float<1000, digit_base_10, std::allocator<char> > >, number<cpp_bin_float<10000, digit_base_2> > >(50);
+   test<number<cpp_bin_float<20000, digit_base_2> >, number<cpp_bin_float<60000, digit_base_2> > >(5);
+
+   return boost::report_errors();
+}
@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Above cpp_bin_float_fixed_series_bits the series for exp, log, sin, cos, asin and atan
+// are summed in fixed point: compare with values computed by mpf_float at twice the
+// precision, over a range of precisions from just above the threshold.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937 gen;
+
+template <class T>
+void check_close(const T& val, const mpf_float& expected, unsigned tolerance)
+{
+   mpf_float err = abs((mpf_float(val) - expected) / expected);
+   BOOST_CHECK_LE(err, mpf_float(std::numeric_limits<T>::epsilon()) * tolerance);
+}
+
+template <class T>
+void test(unsigned count)
+{
+   mpf_float::default_precision(std::numeric_limits<T>::digits10 * 2 + 20);
+   boost::random::uniform_real_distribution<double> dist(-30, 30);
+
+   for (unsigned i = 0; i < count; ++i)
+   {
+      T x = T(dist(gen)) + T(1) / T(gen());
+      if (i % 3 == 0)
+         x = ldexp(x, -static_cast<int>(gen() % 40));
+      mpf_float xx(x);
+
+      check_close<T>(exp(x / 4), exp(xx / 4), 8);
+      check_close<T>(log(abs(x)), log(abs(xx)), 4);
+      check_close<T>(sin(x), sin(xx), 8);
+      check_close<T>(cos(x), cos(xx), 8);
+      check_close<T>(atan(x), atan(xx), 4);
+      T y = x / 31;
+      check_close<T>(asin(y), asin(mpf_float(y)), 8);
+   }
+   //
+   // Special values are handled as before:
+   //
+   BOOST_CHECK_EQUAL(exp(T(0)), 1);
+   BOOST_CHECK_EQUAL(log(T(1)), 0);
+   BOOST_CHECK_EQUAL(atan(T(0)), 0);
+   BOOST_CHECK((boost::math::isinf)(log(T(0))));
+   BOOST_CHECK((boost::math::isnan)(log(T(-1))));
+   BOOST_CHECK_EQUAL(atan(std::numeric_limits<T>::infinity()), boost::math::constants::half_pi<T>());
+   BOOST_CHECK_EQUAL(atan(-std::numeric_limits<T>::infinity()), -boost::math::constants::half_pi<T>());
+   //
+   // Arguments either side of the points where log and atan change method:
+   //
+   T eps = ldexp(T(1), 5 - std::numeric_limits<T>::digits);
+   for (T z : {T(1) - eps, T(1) + eps, T(2) / 3, T(4) / 3, T(1) / 16, T(16), T(0.5) - eps, T(0.5) + eps})
+   {
+      mpf_float zz(z);
+      check_close<T>(log(z), log(zz), 4);
+      check_close<T>(atan(z), atan(zz), 4);
+      check_close<T>(atan(-z), atan(-zz), 4);
+   }
+   check_close<T>(atan(T(1)), atan(mpf_float(1)), 4);
+}
+
+int main()
+{
+   test<cpp_bin_float_50>(100);
+   test<number<cpp_bin_float<400, digit_base_2> > >(50);
+   test<number<cpp_bin_float<1000, digit_base_2, void, std::int32_t, -100000, 100000> > >(30);
+   test<number<cpp_bin_float<300, digit_base_10, std::allocator<char> > > >(20);
+   test<number<cpp_bin_float<3000, digit_base_2> > >(5);
+
+   return boost::report_errors();
+}
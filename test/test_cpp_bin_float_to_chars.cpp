@@ -0,0 +1,180 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks that to_chars for cpp_bin_float produces the shortest string which reads back
+// as the same value, and agrees with std::to_chars for double where available.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <cstring>
+#include <string>
+#include "test.hpp"
+
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937_64 gen;
+
+template <class T>
+T random_value(int exponent_range)
+{
+   T val = 0;
+   for (int bits = 0; bits < std::numeric_limits<T>::digits; bits += 64)
+      val = ldexp(val, 64) + static_cast<std::uint64_t>(gen());
+   // Sometimes use short mantissas, so that there's a short decimal representation:
+   if (gen() % 4 == 0)
+      val = trunc(ldexp(val, -static_cast<int>(gen() % std::numeric_limits<T>::digits)));
+   if (val == 0)
+      val = 1;
+   val = ldexp(val, static_cast<int>(gen() % (2 * exponent_range + 1)) - exponent_range - ilogb(val));
+   return (gen() & 1) ? T(-val) : val;
+}
+
+template <class T>
+std::string shortest(const T& val, std::ios_base::fmtflags f = std::ios_base::fmtflags(0))
+{
+   char            buf[2000];
+   to_chars_result r = to_chars(buf, buf + sizeof(buf), val, f);
+   BOOST_CHECK(r.ec == std::errc());
+   return std::string(buf, r.ptr);
+}
+
+template <class T>
+void check_shortest(const T& val)
+{
+   std::string s = shortest(val, std::ios_base::scientific);
+   BOOST_CHECK_EQUAL(T(s), val);
+   //
+   // Check there's no shorter representation: the candidates are the two values either side of
+   // val with one less digit, which are the scientific mantissa truncated, or truncated and incremented:
+   //
+   std::string::size_type e_pos    = s.find('e');
+   std::string            mantissa = s.substr(s[0] == '-' ? 1 : 0, e_pos - (s[0] == '-' ? 1 : 0));
+   mantissa.erase(std::remove(mantissa.begin(), mantissa.end(), '.'), mantissa.end());
+   long exponent = std::atol(s.c_str() + e_pos + 1);
+   BOOST_CHECK(static_cast<int>(mantissa.size()) <= std::numeric_limits<T>::max_digits10);
+   BOOST_CHECK(mantissa[mantissa.size() - 1] != '0');
+   if (mantissa.size() > 1)
+   {
+      cpp_int     truncated(mantissa.substr(0, mantissa.size() - 1));
+      long        e = exponent - static_cast<long>(mantissa.size()) + 2;
+      std::string sign(s[0] == '-' ? "-" : "");
+      BOOST_CHECK_NE(T(sign + truncated.str() + "e" + std::to_string(e)), val);
+      BOOST_CHECK_NE(T(sign + cpp_int(truncated + 1).str() + "e" + std::to_string(e)), val);
+   }
+   //
+   // The other formats have the same digits:
+   //
+   BOOST_CHECK_EQUAL(T(shortest(val)), val);
+   if ((exponent > -50) && (exponent < 50))
+      BOOST_CHECK_EQUAL(T(shortest(val, std::ios_base::fixed)), val);
+}
+
+template <class T>
+void test()
+{
+   for (unsigned i = 0; i < 2000; ++i)
+      check_shortest<T>(random_value<T>(60));
+   for (unsigned i = 0; i < 500; ++i)
+      check_shortest<T>(random_value<T>((std::min)(std::numeric_limits<T>::max_exponent - 1, 5000)));
+   // Powers of 2 have an asymmetric rounding interval:
+   for (int i = -300; i < 300; ++i)
+      check_shortest<T>(ldexp(T(1), i));
+   check_shortest<T>((std::numeric_limits<T>::max)());
+   check_shortest<T>((std::numeric_limits<T>::min)());
+   check_shortest<T>(std::numeric_limits<T>::epsilon());
+   check_shortest<T>(T(1) / 3);
+   check_shortest<T>(T(2) / 3);
+
+   BOOST_CHECK_EQUAL(shortest(T(0)), "0");
+   BOOST_CHECK_EQUAL(shortest(T(0), std::ios_base::scientific), "0e+00");
+   BOOST_CHECK_EQUAL(shortest(T(-T(0))), "-0");
+   BOOST_CHECK_EQUAL(shortest(T(1)), "1");
+   BOOST_CHECK_EQUAL(shortest(T(-1)), "-1");
+   BOOST_CHECK_EQUAL(shortest(T(1), std::ios_base::scientific), "1e+00");
+   BOOST_CHECK_EQUAL(shortest(T(1.5)), "1.5");
+   BOOST_CHECK_EQUAL(shortest(T(1.5), std::ios_base::scientific), "1.5e+00");
+   BOOST_CHECK_EQUAL(shortest(T(0.125)), "0.125");
+   BOOST_CHECK_EQUAL(shortest(T(1024)), "1024");
+   BOOST_CHECK_EQUAL(shortest(T(1e20)), "1e+20");
+   BOOST_CHECK_EQUAL(shortest(T(1e20), std::ios_base::fixed), "100000000000000000000");
+   BOOST_CHECK_EQUAL(shortest(T(1e5)), "1e+05");
+   BOOST_CHECK_EQUAL(shortest(T(1e4)), "10000");
+   BOOST_CHECK_EQUAL(shortest(T(123456)), "123456");
+   BOOST_CHECK_EQUAL(shortest(T(1234567), std::ios_base::scientific), "1.234567e+06");
+   BOOST_CHECK_EQUAL(shortest(T("3e-6")), "3e-06");
+   BOOST_CHECK_EQUAL(shortest(T("3e-6"), std::ios_base::fixed), "0.000003");
+   BOOST_CHECK_EQUAL(shortest(T("1e100")), "1e+100");
+   BOOST_CHECK_EQUAL(shortest(T("1e-100")), "1e-100");
+   BOOST_CHECK_EQUAL(shortest(std::numeric_limits<T>::infinity()), "inf");
+   BOOST_CHECK_EQUAL(shortest(T(-std::numeric_limits<T>::infinity())), "-inf");
+   BOOST_CHECK_EQUAL(shortest(std::numeric_limits<T>::quiet_NaN()), "nan");
+   //
+   // Buffers which are too small:
+   //
+   char            buf[10];
+   to_chars_result r = to_chars(buf, buf + 2, T(-0.125));
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+   BOOST_CHECK(r.ptr == buf + 2);
+   r = to_chars(buf, buf, T(-1));
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+   r = to_chars(buf, buf + 2, std::numeric_limits<T>::infinity());
+   BOOST_CHECK(r.ec == std::errc::value_too_large);
+   r = to_chars(buf, buf + 6, T(-0.125));
+   BOOST_CHECK(r.ec == std::errc());
+   BOOST_CHECK(r.ptr == buf + 6);
+   BOOST_CHECK(std::memcmp(buf, "-0.125", 6) == 0);
+}
+
+void test_double()
+{
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+   //
+   // For double precision there's only one correct answer, so we should agree with the
+   // standard library: with no format given both choose the shorter of fixed and scientific.
+   //
+   std::chars_format       std_formats[] = {std::chars_format::scientific, std::chars_format::fixed};
+   std::ios_base::fmtflags formats[]     = {std::ios_base::scientific, std::ios_base::fixed};
+   for (unsigned i = 0; i < 20000; ++i)
+   {
+      std::uint64_t bits = gen();
+      double        d;
+      std::memcpy(&d, &bits, sizeof(d));
+      if (!(boost::math::isnormal)(d))
+         continue;
+      char                 buf[400];
+      std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), d);
+      BOOST_CHECK_EQUAL(shortest(cpp_bin_float_double(d)), std::string(buf, r.ptr));
+      for (unsigned j = 0; j < 2; ++j)
+      {
+         r = std::to_chars(buf, buf + sizeof(buf), d, std_formats[j]);
+         BOOST_CHECK_EQUAL(shortest(cpp_bin_float_double(d), formats[j]), std::string(buf, r.ptr));
+      }
+   }
+#endif
+}
+
+int main()
+{
+   test<cpp_bin_float_double>();
+   test<cpp_bin_float_quad>();
+   test<cpp_bin_float_50>();
+   test<cpp_bin_float_100>();
+   test<number<cpp_bin_float<30, digit_base_10, std::allocator<char> > > >();
+   test<number<cpp_bin_float<64, digit_base_2, void, std::int32_t> > >();
+   test_double();
+   return boost::report_errors();
+}
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/detail/lightweight_test.hpp>
+#include "test.hpp"
+
+#include <boost/multiprecision/cpp_double_fp_batch.hpp>
+#include <random>
+
+//
+// The batched kernels must give the same results as the scalar operators, exactly for
+// addition, and to within the rounding of the low parts for products (which may use FMA),
+// whichever instruction set is chosen at runtime.
+//
+template <class T>
+T random_value(std::mt19937& gen)
+{
+   using float_type = typename T::backend_type::float_type;
+
+   std::uniform_real_distribution<float_type> dist(-1, 1);
+   std::uniform_int_distribution<int>         exp_dist(-20, 20);
+
+   T result = dist(gen);
+   result += T(dist(gen)) * std::numeric_limits<float_type>::epsilon();
+   return ldexp(result, exp_dist(gen));
+}
+
+template <class T>
+bool bit_equal(const T& a, const T& b)
+{
+   return (a.backend().crep().first == b.backend().crep().first) && (a.backend().crep().second == b.backend().crep().second);
+}
+
+template <class T>
+bool close(const T& a, const T& b, const T& scale)
+{
+   return abs(a - b) <= scale * std::numeric_limits<T>::epsilon() * 4;
+}
+
+template <class F>
+void test()
+{
+   using batch_type = boost::multiprecision::cpp_double_fp_batch<F>;
+   using value_type = typename batch_type::value_type;
+
+   std::mt19937 gen;
+
+   for (std::size_t n : {0u, 1u, 3u, 7u, 8u, 9u, 31u, 257u, 1000u})
+   {
+      batch_type a, b, c;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         a.push_back(random_value<value_type>(gen));
+         b.push_back(random_value<value_type>(gen));
+         c.push_back(random_value<value_type>(gen));
+      }
+      BOOST_TEST_EQ(a.size(), n);
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         value_type t = random_value<value_type>(gen);
+         batch_type d(a);
+         d.set(i, t);
+         BOOST_CHECK(bit_equal(d.get(i), t));
+      }
+
+      batch_type r;
+      boost::multiprecision::batch_add(r, a, b);
+      BOOST_TEST_EQ(r.size(), n);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK(bit_equal(r.get(i), value_type(a.get(i) + b.get(i))));
+
+      boost::multiprecision::batch_multiply(r, a, b);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK(close(r.get(i), value_type(a.get(i) * b.get(i)), value_type(abs(a.get(i) * b.get(i)))));
+
+      boost::multiprecision::batch_fma(r, a, b, c);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK(close(r.get(i), value_type(a.get(i) * b.get(i) + c.get(i)), value_type(abs(a.get(i) * b.get(i)) + abs(c.get(i)))));
+
+      // In place:
+      batch_type p(a);
+      boost::multiprecision::batch_multiply(p, p, b);
+      boost::multiprecision::batch_multiply(r, a, b);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK(bit_equal(p.get(i), r.get(i)));
+
+      const value_type alpha = random_value<value_type>(gen);
+      r                      = c;
+      boost::multiprecision::batch_axpy(alpha, a, r);
+      for (std::size_t i = 0; i < n; ++i)
+         BOOST_CHECK(close(r.get(i), value_type(alpha * a.get(i) + c.get(i)), value_type(abs(alpha * a.get(i)) + abs(c.get(i)))));
+
+      // The dot product is summed in a different order, so compare with a sum of absolute values:
+      value_type dot = 0, norm = 0;
+      for (std::size_t i = 0; i < n; ++i)
+      {
+         dot += a.get(i) * b.get(i);
+         norm += abs(a.get(i) * b.get(i));
+      }
+      const value_type batch_dot = boost::multiprecision::batch_dot(a, b);
+      BOOST_CHECK(close(batch_dot, dot, norm));
+
+      // Polynomials, constant term first:
+      for (std::size_t degree : {0u, 1u, 5u})
+      {
+         batch_type coef;
+         for (std::size_t k = 0; k <= degree; ++k)
+            coef.push_back(random_value<value_type>(gen));
+         boost::multiprecision::batch_horner(r, a, coef);
+         BOOST_TEST_EQ(r.size(), n);
+         for (std::size_t i = 0; i < n; ++i)
+         {
+            value_type p = coef.get(degree), norm = abs(p);
+            for (std::size_t k = degree; k-- > 0;)
+            {
+               p    = p * a.get(i) + coef.get(k);
+               norm = norm * abs(a.get(i)) + abs(coef.get(k));
+            }
+            BOOST_CHECK(close(r.get(i), p, norm));
+         }
+         batch_type x(a);
+         boost::multiprecision::batch_horner(x, x, coef);
+         for (std::size_t i = 0; i < n; ++i)
+            BOOST_CHECK(bit_equal(x.get(i), r.get(i)));
+      }
+   }
+
+   // Construction from a range and a fill value:
+   const value_type values[] = {1, value_type(1) / 3, -2};
+   const batch_type from_range(values, values + 3);
+   const batch_type filled(4, values[1]);
+   BOOST_TEST_EQ(from_range.size(), 3u);
+   BOOST_TEST_EQ(filled.size(), 4u);
+   for (std::size_t i = 0; i < 3; ++i)
+      BOOST_CHECK(bit_equal(from_range.get(i), values[i]));
+   for (std::size_t i = 0; i < 4; ++i)
+      BOOST_CHECK(bit_equal(filled.get(i), values[1]));
+   BOOST_TEST_EQ(filled.hi_data()[0], values[1].backend().crep().first);
+   BOOST_TEST_EQ(filled.lo_data()[0], values[1].backend().crep().second);
+}
+
+int main()
+{
+   test<float>();
+   test<double>();
+   test<long double>();
+
+   return boost::report_errors();
+}
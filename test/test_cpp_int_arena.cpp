@@ -0,0 +1,135 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check that cpp_int's drawing their storage from a scoped_limb_arena give the
+// same results as regular cpp_int's, including values which outlive the arena.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/limb_arena.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+using boost::multiprecision::arena_cpp_int;
+using boost::multiprecision::cpp_int;
+
+cpp_int generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937 gen;
+   cpp_int                       val = 0;
+   for (unsigned i = 0; i < bits_wanted; i += 32)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   return val;
+}
+
+template <class I>
+I from(const cpp_int& x)
+{
+   return I(x.str());
+}
+
+//
+// A mixture of operations producing many temporaries of varying sizes:
+//
+template <class I>
+I compute(const I& a, const I& b, const I& m)
+{
+   I r = a * b + (a - b) * (a + b);
+   r   = (r * r) / (b + 1) + (a << 100) - (b >> 3);
+   r %= m;
+   r += powm(a, b & 0xffff, m);
+   r -= gcd(a, b);
+   r *= sqrt(a * a + b);
+   return r;
+}
+
+void test_values(unsigned bits)
+{
+   cpp_int a = generate_random(bits), b = generate_random(bits / 2 + 1), m = generate_random(bits) | 1;
+   cpp_int expected = compute(a, b, m);
+   {
+      boost::multiprecision::scoped_limb_arena arena;
+      BOOST_CHECK_EQUAL(compute(from<arena_cpp_int>(a), from<arena_cpp_int>(b), from<arena_cpp_int>(m)).str(), expected.str());
+   }
+   // Without an arena the allocator falls back on the heap:
+   BOOST_CHECK_EQUAL(compute(from<arena_cpp_int>(a), from<arena_cpp_int>(b), from<arena_cpp_int>(m)).str(), expected.str());
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   for (unsigned bits = 32; bits < 20000; bits = bits * 3 / 2)
+      test_values(bits);
+
+   cpp_int a = generate_random(3000), b = generate_random(2000);
+   //
+   // Values created outside the arena, or inside and surviving it:
+   //
+   arena_cpp_int outside = from<arena_cpp_int>(a);
+   arena_cpp_int escaped;
+   std::vector<arena_cpp_int> kept;
+   {
+      scoped_limb_arena arena(64);
+      arena_cpp_int     x = from<arena_cpp_int>(b);
+      outside *= x;
+      outside += 1;
+      escaped = x * x;
+      for (unsigned i = 0; i < 100; ++i)
+         kept.push_back(arena_cpp_int(x << (i * 64)));
+      {
+         // Nested scope:
+         scoped_limb_arena inner;
+         arena_cpp_int     y = x * 3;
+         outside += y;
+         escaped -= y;
+         kept.erase(kept.begin(), kept.begin() + 50);
+      }
+      x = 0;
+   }
+   BOOST_CHECK_EQUAL(outside.str(), cpp_int(a * b + 1 + b * 3).str());
+   BOOST_CHECK_EQUAL(escaped.str(), cpp_int(b * b - b * 3).str());
+   BOOST_CHECK_EQUAL(kept.size(), 50u);
+   for (unsigned i = 0; i < kept.size(); ++i)
+      BOOST_CHECK_EQUAL(kept[i].str(), cpp_int(b << ((i + 50) * 64)).str());
+   kept.clear();
+   escaped = outside;
+   BOOST_CHECK_EQUAL(escaped.str(), outside.str());
+
+   //
+   // Each thread has its own arena:
+   //
+   std::vector<std::thread> threads;
+   std::vector<int>         ok(4, 0);
+   for (unsigned t = 0; t < ok.size(); ++t)
+   {
+      threads.emplace_back([&ok, t, &a, &b]() {
+         arena_cpp_int x = from<arena_cpp_int>(a), y = from<arena_cpp_int>(b) + t;
+         cpp_int       expected(compute(a, cpp_int(b + t), cpp_int(a + 7)));
+         bool          good = true;
+         for (unsigned i = 0; i < 20; ++i)
+         {
+            scoped_limb_arena arena;
+            good = good && (compute(x, y, arena_cpp_int(x + 7)).str() == expected.str());
+         }
+         ok[t] = good;
+      });
+   }
+   for (std::thread& th : threads)
+      th.join();
+   for (int r : ok)
+      BOOST_CHECK(r);
+
+   return boost::report_errors();
+}
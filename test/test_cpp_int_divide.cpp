@@ -0,0 +1,134 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare recursive division results for cpp_int with GMP results.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+//
+// Lower the cutoff so that several levels of recursion, and the transition
+// to long division, are exercised at modest sizes:
+//
+#define BOOST_MP_DIVIDE_RECURSIVE_CUTOFF 6
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val &= (T(1) << bits_wanted) - 1;
+   return val;
+}
+
+template <class N>
+N from_mpz(const boost::multiprecision::mpz_int& x)
+{
+   return N("0x" + x.str(0, std::ios_base::hex));
+}
+
+template <class N>
+void check_negative(const N& a, const N& b, const N& q, const N& r, const std::integral_constant<bool, true>&)
+{
+   // Quotients truncate towards zero and remainders take the sign of the numerator:
+   BOOST_CHECK_EQUAL(N(-a / b), N(-q));
+   BOOST_CHECK_EQUAL(N(-a % b), N(-r));
+   BOOST_CHECK_EQUAL(N(a / -b), N(-q));
+   BOOST_CHECK_EQUAL(N(a % -b), r);
+   BOOST_CHECK_EQUAL(N(-a / -b), q);
+}
+template <class N>
+void check_negative(const N&, const N&, const N&, const N&, const std::integral_constant<bool, false>&)
+{}
+
+template <class N>
+void check_divide(const boost::multiprecision::mpz_int& a, const boost::multiprecision::mpz_int& b)
+{
+   using boost::multiprecision::mpz_int;
+
+   N a1 = from_mpz<N>(a), b1 = from_mpz<N>(b);
+   N q1 = from_mpz<N>(mpz_int(a / b)), r1 = from_mpz<N>(mpz_int(a % b));
+   BOOST_CHECK_EQUAL(N(a1 / b1), q1);
+   BOOST_CHECK_EQUAL(N(a1 % b1), r1);
+   N q, r;
+   divide_qr(a1, b1, q, r);
+   BOOST_CHECK_EQUAL(q, q1);
+   BOOST_CHECK_EQUAL(r, r1);
+   N t(a1);
+   t /= b1;
+   BOOST_CHECK_EQUAL(t, q1);
+   t = a1;
+   t %= b1;
+   BOOST_CHECK_EQUAL(t, r1);
+   check_negative(a1, b1, q1, r1, std::integral_constant<bool, std::numeric_limits<N>::is_signed>());
+}
+
+template <class N>
+void test(unsigned max_limbs)
+{
+   using boost::multiprecision::mpz_int;
+
+   const unsigned limb_bits = sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+
+   static boost::random::mt19937 gen;
+   boost::random::uniform_int_distribution<unsigned> d(1, max_limbs / 2);
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      unsigned bs = d(gen), qs = d(gen);
+      mpz_int  b = generate_random<mpz_int>(bs * limb_bits - i % limb_bits) + 1;
+      mpz_int  a = generate_random<mpz_int>((bs + qs) * limb_bits - i % 7);
+      check_divide<N>(a, b);
+      // Exact division, and one less than a multiple:
+      mpz_int m = b * generate_random<mpz_int>(qs * limb_bits - 3);
+      check_divide<N>(m, b);
+      check_divide<N>(mpz_int(m - 1), b);
+   }
+   //
+   // All ones, and divisors with a single high bit, produce the largest corrections
+   // to each estimated quotient:
+   //
+   for (unsigned limbs = 8; limbs <= max_limbs / 2; limbs += limbs / 2)
+   {
+      mpz_int ones   = (mpz_int(1) << (limbs * limb_bits)) - 1;
+      mpz_int ones2  = (mpz_int(1) << (2 * limbs * limb_bits)) - 1;
+      mpz_int sparse = (mpz_int(1) << (limbs * limb_bits - 1)) + 1;
+      check_divide<N>(ones2, ones);
+      check_divide<N>(ones2, sparse);
+      check_divide<N>(mpz_int(ones2 >> 1), mpz_int(sparse - 2));
+      check_divide<N>(mpz_int(ones * ones), ones);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(600);
+   test<number<cpp_int_backend<16384, 16384, signed_magnitude, unchecked, void> > >(256);
+   test<number<cpp_int_backend<32768, 32768, unsigned_magnitude, unchecked> > >(512);
+   test<number<cpp_int_backend<16384, 16384, signed_magnitude, checked, void> > >(256);
+   test<number<cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<char> >, et_off> >(400);
+
+   return boost::report_errors();
+}
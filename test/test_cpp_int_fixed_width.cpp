@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Check the unrolled arithmetic used for the small fixed precision types
+// (uint256_t and friends) against the same operations carried out in
+// arbitrary precision and then reduced to the width of the type.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+using boost::multiprecision::cpp_int;
+
+boost::random::mt19937_64 gen;
+
+template <class T>
+T reduce(const cpp_int& v)
+{
+   // Modular arithmetic on the magnitude, with the sign carried separately,
+   // or two's complement wrapping for unsigned types:
+   constexpr unsigned bits = std::numeric_limits<T>::digits;
+   cpp_int            m    = abs(v) & ((cpp_int(1) << bits) - 1);
+   T                  r(m);
+   if (v < 0)
+      r = T(0) - r;
+   return r;
+}
+
+template <class T>
+T generate_random(unsigned kind)
+{
+   constexpr unsigned bits = std::numeric_limits<T>::digits;
+   cpp_int            val  = 0;
+   switch (kind)
+   {
+   case 0:
+      return 0;
+   case 1:
+      val = (cpp_int(1) << bits) - 1;
+      break;
+   case 2:
+      val = static_cast<std::uint64_t>(gen());
+      break;
+   default:
+   {
+      unsigned n = static_cast<unsigned>(gen() % bits) + 1;
+      for (unsigned i = 0; i < n; i += 64)
+      {
+         val <<= 64;
+         val |= static_cast<std::uint64_t>(gen());
+      }
+      val &= (cpp_int(1) << n) - 1;
+   }
+   }
+   T result(val);
+   if (std::numeric_limits<T>::is_signed && (gen() & 1))
+      result = T(0) - result;
+   return result;
+}
+
+template <class T>
+void test_values(const T& a, const T& b)
+{
+   cpp_int a1(a), b1(b);
+
+   BOOST_CHECK_EQUAL(T(a + b), reduce<T>(a1 + b1));
+   BOOST_CHECK_EQUAL(T(a - b), reduce<T>(a1 - b1));
+   BOOST_CHECK_EQUAL(T(b - a), reduce<T>(b1 - a1));
+   BOOST_CHECK_EQUAL(T(a * b), reduce<T>(a1 * b1));
+   BOOST_CHECK_EQUAL(T(a * a), reduce<T>(a1 * a1));
+
+   unsigned s = static_cast<unsigned>(gen() % (std::numeric_limits<T>::digits + 70));
+   BOOST_CHECK_EQUAL(T(a << s), reduce<T>(a1 << s));
+   BOOST_CHECK_EQUAL(T(a >> s), reduce<T>(a1 >> s));
+   s = 64 * static_cast<unsigned>(gen() % 18);
+   BOOST_CHECK_EQUAL(T(a << s), reduce<T>(a1 << s));
+   BOOST_CHECK_EQUAL(T(a >> s), reduce<T>(a1 >> s));
+
+   // In place, with the arguments aliased:
+   T r(a);
+   r += b;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 + b1));
+   r = a;
+   r -= b;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 - b1));
+   r = b;
+   r -= a;
+   BOOST_CHECK_EQUAL(r, reduce<T>(b1 - a1));
+   r = a;
+   r *= b;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 * b1));
+   r = b;
+   r *= a;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 * b1));
+   r = a;
+   r *= r;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 * a1));
+   r = a;
+   r += r;
+   BOOST_CHECK_EQUAL(r, reduce<T>(a1 + a1));
+   r = a;
+   r -= r;
+   BOOST_CHECK_EQUAL(r, 0);
+}
+
+template <class T>
+void test()
+{
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      T a = generate_random<T>(i % 5), b = generate_random<T>((i / 5) % 5);
+      test_values(a, b);
+   }
+}
+
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+template <class T>
+constexpr T constexpr_test(T a, T b)
+{
+   T r = a * b;
+   r += a;
+   r -= b * b;
+   r <<= 67;
+   r >>= 3;
+   return r;
+}
+#endif
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<uint256_t>();
+   test<int256_t>();
+   test<uint512_t>();
+   test<int512_t>();
+   test<uint1024_t>();
+   test<int1024_t>();
+   // Widths which aren't a whole number of limbs, so the top limb gets masked:
+   test<number<cpp_int_backend<200, 200, unsigned_magnitude, unchecked, void> > >();
+   test<number<cpp_int_backend<1000, 1000, signed_magnitude, unchecked, void> > >();
+
+#ifndef BOOST_MP_NO_CONSTEXPR_DETECTION
+   constexpr uint256_t a = (uint256_t(0x123456789abcdefuLL) << 130) + 0xfedcba987654321uLL;
+   constexpr uint256_t b = (uint256_t(0xabcdef0123456789uLL) << 64) + 0x13579bdf2468aceuLL;
+   constexpr uint256_t c = constexpr_test(a, b);
+   BOOST_CHECK_EQUAL(c, constexpr_test(uint256_t(a), uint256_t(b)));
+   constexpr int512_t d = constexpr_test(-int512_t(a), int512_t(b) << 200);
+   BOOST_CHECK_EQUAL(d, constexpr_test(-int512_t(a), int512_t(b) << 200));
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,142 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare the limb kernels used by cpp_int, which may be dispatched to
+// assembly versions at runtime, with their portable versions, and then
+// check the arithmetic built on them against GMP.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <vector>
+#include "test.hpp"
+
+using boost::multiprecision::limb_type;
+
+boost::random::mt19937_64 gen;
+
+limb_type random_limb(unsigned kind)
+{
+   switch (kind)
+   {
+   case 0:
+      return ~static_cast<limb_type>(0);
+   case 1:
+      return 0;
+   default:
+      return static_cast<limb_type>(gen());
+   }
+}
+
+std::vector<limb_type> random_limbs(std::size_t n, unsigned kind)
+{
+   std::vector<limb_type> v(n);
+   for (auto& l : v)
+      l = random_limb(kind);
+   return v;
+}
+
+void test_kernels(std::size_t n, unsigned kind)
+{
+   using namespace boost::multiprecision::detail;
+
+   const std::vector<limb_type> a = random_limbs(n, kind), b = random_limbs(n, kind), r = random_limbs(2 * n, kind);
+   const limb_type              m = random_limb(kind == 1 ? 2 : kind);
+
+   std::vector<limb_type> r1(r), r2(r);
+   BOOST_CHECK_EQUAL(limb_mul_1(r1.data(), a.data(), n, m), limb_mul_1_generic(r2.data(), a.data(), n, m, 0));
+   BOOST_CHECK(r1 == r2);
+   r1 = r2 = r;
+   BOOST_CHECK_EQUAL(limb_addmul_1(r1.data(), a.data(), n, m), limb_addmul_1_generic(r2.data(), a.data(), n, m, 0));
+   BOOST_CHECK(r1 == r2);
+   r1 = r2 = r;
+   BOOST_CHECK_EQUAL(limb_submul_1(r1.data(), a.data(), n, m), limb_submul_1_generic(r2.data(), a.data(), n, m, 0));
+   BOOST_CHECK(r1 == r2);
+   // submul_1 undoes addmul_1:
+   limb_type c = limb_addmul_1(r1.data(), b.data(), n, m);
+   BOOST_CHECK_EQUAL(limb_submul_1(r1.data(), b.data(), n, m), c);
+   BOOST_CHECK(r1 == r2);
+   // In place:
+   r1.assign(a.begin(), a.end());
+   r2.assign(a.begin(), a.end());
+   BOOST_CHECK_EQUAL(limb_mul_1(r1.data(), r1.data(), n, m), limb_mul_1_generic(r2.data(), a.data(), n, m, 0));
+   BOOST_CHECK(r1 == r2);
+
+   r1.assign(n, 0);
+   r2.assign(n, 0);
+   limb_type carry = limb_add_n(r1.data(), a.data(), b.data(), n);
+   BOOST_CHECK_EQUAL(limb_sub_n(r2.data(), r1.data(), b.data(), n), carry);
+   BOOST_CHECK(r2 == a);
+
+   //
+   // For the square the doubled cross products must leave room for the diagonal, so
+   // build them from a, as cpp_int does:
+   //
+   r1.assign(2 * n, 0);
+   for (std::size_t i = 0; i + 1 < n; ++i)
+      r1[i + n] = limb_addmul_1_generic(r1.data() + 2 * i + 1, a.data() + i + 1, n - i - 1, a[i], 0);
+   r2 = r1;
+   limb_sqr_diag_addlsh1(r1.data(), a.data(), n);
+   limb_sqr_diag_addlsh1_generic(r2.data(), a.data(), n);
+   BOOST_CHECK(r1 == r2);
+   std::vector<limb_type> sq(2 * n, 0);
+   for (std::size_t i = 0; i < n; ++i)
+      sq[i + n] = limb_addmul_1_generic(sq.data() + i, a.data(), n, a[i], 0);
+   BOOST_CHECK(r1 == sq);
+}
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   T val = 0;
+   for (unsigned i = 0; i < bits_wanted; i += 64)
+   {
+      val <<= 64;
+      val |= static_cast<std::uint64_t>(gen());
+   }
+   val &= (T(1) << bits_wanted) - 1;
+   return val;
+}
+
+template <class N>
+N from_mpz(const boost::multiprecision::mpz_int& x)
+{
+   return N("0x" + x.str(0, std::ios_base::hex));
+}
+
+void test_arithmetic(unsigned bits)
+{
+   using boost::multiprecision::cpp_int;
+   using boost::multiprecision::mpz_int;
+
+   mpz_int a = generate_random<mpz_int>(bits), b = generate_random<mpz_int>(bits / 2 + 1) + 1;
+   cpp_int a1 = from_mpz<cpp_int>(a), b1 = from_mpz<cpp_int>(b);
+   BOOST_CHECK_EQUAL(cpp_int(a1 * b1), from_mpz<cpp_int>(mpz_int(a * b)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 * a1), from_mpz<cpp_int>(mpz_int(a * a)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 / b1), from_mpz<cpp_int>(mpz_int(a / b)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 % b1), from_mpz<cpp_int>(mpz_int(a % b)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 + b1), from_mpz<cpp_int>(mpz_int(a + b)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 - b1), from_mpz<cpp_int>(mpz_int(a - b)));
+   BOOST_CHECK_EQUAL(cpp_int(a1 * 0x123456789abcdefuLL), from_mpz<cpp_int>(mpz_int(a * 0x123456789abcdefuLL)));
+   mpz_int m = b | 1;
+   cpp_int m1 = from_mpz<cpp_int>(m);
+   BOOST_CHECK_EQUAL(cpp_int(powm(a1, b1, m1)), from_mpz<cpp_int>(mpz_int(powm(a, b, m))));
+}
+
+int main()
+{
+   for (std::size_t n = 0; n < 40; ++n)
+      for (unsigned kind = 0; kind < 3; ++kind)
+         test_kernels(n, kind);
+   for (unsigned bits = 64; bits < 6000; bits += 1 + bits / 5)
+      test_arithmetic(bits);
+   return boost::report_errors();
+}
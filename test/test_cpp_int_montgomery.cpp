@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare Montgomery powm results for cpp_int with GMP results.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   T        max_val = T(1) << bits_wanted;
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val %= max_val;
+   return val;
+}
+
+template <class N>
+void test(unsigned max_bits)
+{
+   using boost::multiprecision::mpz_int;
+
+   for (unsigned bits = 64; bits <= max_bits; bits *= 2)
+   {
+      for (unsigned i = 0; i < 10; ++i)
+      {
+         mpz_int a = generate_random<mpz_int>(bits);
+         mpz_int p = generate_random<mpz_int>(bits);
+         mpz_int m = generate_random<mpz_int>(bits) | 1;
+         if (m < 3)
+            m = 3;
+
+         N a1(a.str()), p1(p.str()), m1(m.str());
+
+         BOOST_CHECK_EQUAL(N(powm(a1, p1, m1)).str(), mpz_int(powm(a, p, m)).str());
+         BOOST_CHECK_EQUAL(N(powm(a1, 65537u, m1)).str(), mpz_int(powm(a, 65537u, m)).str());
+         // Base larger than the modulus:
+         BOOST_CHECK_EQUAL(N(powm(m1 + a1, p1, m1)).str(), mpz_int(powm(m + a, p, m)).str());
+         // Even modulus takes the generic path:
+         if (bits <= 1024)
+            BOOST_CHECK_EQUAL(N(powm(a1, p1, N(m1 + 1))).str(), mpz_int(powm(a, p, mpz_int(m + 1))).str());
+
+         boost::multiprecision::montgomery_context<N> ctx(m1);
+         BOOST_CHECK_EQUAL(ctx.modulus(), m1);
+         BOOST_CHECK_EQUAL(ctx.powm(a1, p1).str(), mpz_int(powm(a, p, m)).str());
+         BOOST_CHECK_EQUAL(ctx.powm(a1, 3).str(), mpz_int(powm(a, 3u, m)).str());
+         BOOST_CHECK_EQUAL(ctx.powm(a1, 0), 1);
+         BOOST_CHECK_EQUAL(ctx.from_montgomery(ctx.to_montgomery(a1)).str(), mpz_int(a % m).str());
+         N am = ctx.to_montgomery(a1), pm = ctx.to_montgomery(p1);
+         BOOST_CHECK_EQUAL(ctx.from_montgomery(ctx.multiply(am, pm)).str(), mpz_int((a * p) % m).str());
+      }
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(4096);
+   test<number<cpp_int_backend<1024, 1024, unsigned_magnitude, unchecked, void> > >(512);
+   test<number<cpp_int_backend<2048, 2048, signed_magnitude, checked, void> > >(1024);
+   test<int1024_t>(512);
+
+   // Negative base keeps the sign semantics of the generic algorithm:
+   cpp_int m = (cpp_int(1) << 200) + 235;
+   BOOST_CHECK_EQUAL(powm(cpp_int(-3), cpp_int(5), m), -243);
+
+   montgomery_context<cpp_int> ctx(m);
+   BOOST_CHECK_EQUAL(ctx.powm(cpp_int(-3), 5), m - 243);
+
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(montgomery_context<cpp_int>(cpp_int(1) << 100), std::domain_error);
+   BOOST_CHECK_THROW(montgomery_context<cpp_int>(cpp_int(1)), std::domain_error);
+   BOOST_CHECK_THROW(montgomery_context<cpp_int>(cpp_int(-7)), std::domain_error);
+   BOOST_CHECK_THROW(ctx.powm(cpp_int(2), -1), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int(powm(cpp_int(2), cpp_int(-1), m)), std::runtime_error);
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare conversion of large cpp_int's to and from strings with GMP results.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+//
+// Lower the cutoff so that several levels of recursion are exercised at modest sizes:
+//
+#define BOOST_MP_RADIX_CONVERSION_CUTOFF 3
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val &= (T(1) << bits_wanted) - 1;
+   return val;
+}
+
+template <class N>
+void check_negative(const std::string& s, const std::integral_constant<bool, true>&)
+{
+   N a(s), b("-" + s);
+   BOOST_CHECK_EQUAL(N(-a), b);
+   BOOST_CHECK_EQUAL(b.str(), s == "0" ? s : "-" + s);
+}
+template <class N>
+void check_negative(const std::string&, const std::integral_constant<bool, false>&)
+{}
+
+template <class N>
+void check_round_trip(const boost::multiprecision::mpz_int& x)
+{
+   std::string dec = x.str(), hex = x.str(0, std::ios_base::hex), oct = x.str(0, std::ios_base::oct);
+   N           a(dec);
+   BOOST_CHECK_EQUAL(a, N("0x" + hex));
+   BOOST_CHECK_EQUAL(a, N("0" + oct));
+   BOOST_CHECK_EQUAL(a.str(), dec);
+   BOOST_CHECK_EQUAL(a.str(0, std::ios_base::hex), hex);
+   BOOST_CHECK_EQUAL(a.str(0, std::ios_base::oct), oct);
+   check_negative<N>(dec, std::integral_constant<bool, std::numeric_limits<N>::is_signed>());
+}
+
+template <class N>
+void test(unsigned max_bits)
+{
+   using boost::multiprecision::mpz_int;
+
+   for (unsigned bits = 1; bits <= max_bits; bits += 1 + bits / 5)
+   {
+      check_round_trip<N>(generate_random<mpz_int>(bits));
+      // Values either side of a power of ten produce long runs of 9's and 0's:
+      mpz_int p = pow(mpz_int(10), bits * 3 / 10);
+      check_round_trip<N>(p);
+      check_round_trip<N>(mpz_int(p - 1));
+      check_round_trip<N>(mpz_int(p + 1));
+      check_round_trip<N>((mpz_int(1) << bits) - 1);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(60000);
+   test<int1024_t>(1023);
+   test<number<cpp_int_backend<16384, 16384, unsigned_magnitude, unchecked, void> > >(16384);
+   test<checked_int1024_t>(1023);
+   test<number<cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<char> >, et_off> >(10000);
+
+   // Formatting flags:
+   cpp_int x = (cpp_int(1) << 1000) + 0xabcdef;
+   BOOST_CHECK_EQUAL(x.str(0, std::ios_base::hex | std::ios_base::uppercase | std::ios_base::showbase).substr(0, 3), "0X1");
+   std::string h = x.str(0, std::ios_base::hex | std::ios_base::uppercase);
+   BOOST_CHECK_EQUAL(h.substr(h.size() - 6), "ABCDEF");
+   BOOST_CHECK_EQUAL(x.str(0, std::ios_base::showpos)[0], '+');
+   // Truncation to fixed precision, and overflow detection for checked types:
+   std::string big = (cpp_int(1) << 3000).str();
+   BOOST_CHECK_EQUAL(uint1024_t(big), 0);
+   BOOST_CHECK_EQUAL(uint1024_t(cpp_int((cpp_int(1) << 3000) + 12345).str()), 12345);
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(checked_int1024_t(big.c_str()), std::overflow_error);
+   BOOST_CHECK_THROW(cpp_int((big + "1x").c_str()), std::runtime_error);
+   BOOST_CHECK_THROW(cpp_int(("1x" + big).c_str()), std::runtime_error);
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,113 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare cpp_int squaring, which takes a dedicated path when both arguments
+// to eval_multiply are the same value, with GMP results.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val &= (T(1) << bits_wanted) - 1;
+   return val;
+}
+
+template <class N>
+N from_mpz(const boost::multiprecision::mpz_int& x)
+{
+   return N("0x" + x.str(0, std::ios_base::hex));
+}
+
+template <class N>
+void check_square(const boost::multiprecision::mpz_int& a)
+{
+   using boost::multiprecision::mpz_int;
+
+   mpz_int r = a * a;
+   if (std::numeric_limits<N>::is_bounded)
+      r &= (mpz_int(1) << std::numeric_limits<N>::digits) - 1;
+   N a1 = from_mpz<N>(a), r1 = from_mpz<N>(r);
+   BOOST_CHECK_EQUAL(N(a1 * a1), r1);
+   N t(a1);
+   t *= t;
+   BOOST_CHECK_EQUAL(t, r1);
+   // Same value but different objects, takes the general multiplication path:
+   N b1(a1);
+   BOOST_CHECK_EQUAL(N(a1 * b1), r1);
+}
+
+template <class N>
+void test(unsigned max_limbs)
+{
+   using boost::multiprecision::mpz_int;
+
+   const unsigned limb_bits = sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+   for (unsigned limbs = 1; limbs <= max_limbs; limbs += 1 + limbs / 8)
+   {
+      check_square<N>(generate_random<mpz_int>(limbs * limb_bits));
+      check_square<N>(generate_random<mpz_int>(limbs * limb_bits - 3));
+      // All ones generates the largest carries:
+      check_square<N>((mpz_int(1) << (limbs * limb_bits)) - 1);
+      check_square<N>(mpz_int(1) << (limbs * limb_bits - 1));
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(3000);
+   test<number<cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<char> >, et_off> >(200);
+   test<uint1024_t>(16);
+   test<number<cpp_int_backend<8192, 8192, signed_magnitude, unchecked, void> > >(128);
+
+   // Negative values square to positive:
+   cpp_int x = -(cpp_int(1) << 3000) + 12345;
+   BOOST_CHECK_EQUAL(cpp_int(x * x), cpp_int(-x * -x));
+   BOOST_CHECK(x * x > 0);
+   x = -3;
+   x *= x;
+   BOOST_CHECK_EQUAL(x, 9);
+
+   // Callers which square internally:
+   mpz_int   m = generate_random<mpz_int>(2000) | 1;
+   mpz_int   b = generate_random<mpz_int>(2000);
+   mpz_int   e = generate_random<mpz_int>(300);
+   cpp_int   m1 = from_mpz<cpp_int>(m), b1 = from_mpz<cpp_int>(b), e1 = from_mpz<cpp_int>(e);
+   BOOST_CHECK_EQUAL(cpp_int(powm(b1, e1, m1)), from_mpz<cpp_int>(mpz_int(powm(b, e, m))));
+   BOOST_CHECK_EQUAL(cpp_int(pow(b1, 37)), from_mpz<cpp_int>(mpz_int(pow(b, 37))));
+   BOOST_CHECK_EQUAL(cpp_int(sqrt(b1)), from_mpz<cpp_int>(mpz_int(sqrt(b))));
+
+#ifndef BOOST_NO_EXCEPTIONS
+   // Checked types must still detect overflow:
+   checked_int512_t big = checked_int512_t(1) << 300;
+   BOOST_CHECK_THROW(big *= big, std::overflow_error);
+   checked_int512_t half = checked_int512_t(1) << 250;
+   BOOST_CHECK_EQUAL(checked_int512_t(half * half), checked_int512_t(1) << 500);
+#endif
+   return boost::report_errors();
+}
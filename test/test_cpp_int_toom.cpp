@@ -0,0 +1,125 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare Toom-Cook and NTT multiplication results for cpp_int with GMP results.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+//
+// Lower the cutoffs so that every multiplication algorithm, and the transitions
+// between them, are exercised at modest sizes:
+//
+#define BOOST_MP_TOOM3_CUTOFF 60
+#define BOOST_MP_TOOM4_CUTOFF 100
+#define BOOST_MP_NTT_CUTOFF 300
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val &= (T(1) << bits_wanted) - 1;
+   return val;
+}
+
+//
+// Conversion to and from hex is linear for both types, whereas decimal conversion of
+// large cpp_int's is not:
+//
+template <class N>
+N from_mpz(const boost::multiprecision::mpz_int& x)
+{
+   return N("0x" + x.str(0, std::ios_base::hex));
+}
+
+template <class N>
+void check_negative(const N& a, const N& b, const N& r, const std::integral_constant<bool, true>&)
+{
+   BOOST_CHECK_EQUAL(N(-a * b), N(-r));
+   BOOST_CHECK_EQUAL(N(a * -b), N(-r));
+}
+template <class N>
+void check_negative(const N&, const N&, const N&, const std::integral_constant<bool, false>&)
+{}
+
+template <class N>
+void check_multiply(const boost::multiprecision::mpz_int& a, const boost::multiprecision::mpz_int& b, const boost::multiprecision::mpz_int& mask)
+{
+   using boost::multiprecision::mpz_int;
+
+   mpz_int r = a * b;
+   if (std::numeric_limits<N>::is_bounded)
+      r &= mask;
+   N a1 = from_mpz<N>(a), b1 = from_mpz<N>(b), r1 = from_mpz<N>(r);
+   BOOST_CHECK_EQUAL(N(a1 * b1), r1);
+   check_negative(a1, b1, r1, std::integral_constant<bool, std::numeric_limits<N>::is_signed>());
+}
+
+template <class N>
+void test(unsigned max_limbs)
+{
+   using boost::multiprecision::mpz_int;
+
+   const unsigned limb_bits = sizeof(boost::multiprecision::limb_type) * CHAR_BIT;
+   mpz_int        mask;
+   if (std::numeric_limits<N>::is_bounded)
+      mask = (mpz_int(1) << std::numeric_limits<N>::digits) - 1;
+
+   static boost::random::mt19937 gen;
+   boost::random::uniform_int_distribution<unsigned> d(40, max_limbs);
+   for (unsigned i = 0; i < 100; ++i)
+   {
+      unsigned as = d(gen), bs = d(gen);
+      mpz_int  a = generate_random<mpz_int>(as * limb_bits), b = generate_random<mpz_int>(bs * limb_bits);
+      // Unbalanced, balanced and squares:
+      check_multiply<N>(a, b, mask);
+      check_multiply<N>(a, generate_random<mpz_int>(as * limb_bits - 5), mask);
+      check_multiply<N>(a, a, mask);
+   }
+   //
+   // All ones and sparse values have the largest intermediate values during interpolation:
+   //
+   for (unsigned limbs = 50; limbs <= max_limbs; limbs += limbs / 2)
+   {
+      mpz_int ones = (mpz_int(1) << (limbs * limb_bits)) - 1;
+      check_multiply<N>(ones, ones, mask);
+      check_multiply<N>(ones, mpz_int(ones >> 7), mask);
+      mpz_int sparse = (mpz_int(1) << (limbs * limb_bits - 1)) + 1;
+      check_multiply<N>(sparse, ones, mask);
+      check_multiply<N>(sparse, sparse, mask);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(1500);
+   test<number<cpp_int_backend<32768, 32768, signed_magnitude, unchecked, void> > >(512);
+   test<number<cpp_int_backend<65536, 65536, unsigned_magnitude, unchecked> > >(1024);
+   test<number<cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<char> >, et_off> >(1000);
+
+   return boost::report_errors();
+}
@@ -0,0 +1,121 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare fixed_modulus reductions with the results of operator%.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/fixed_modulus.hpp>
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include "test.hpp"
+
+template <class T>
+T generate_random(unsigned bits_wanted)
+{
+   static boost::random::mt19937               gen;
+   typedef boost::random::mt19937::result_type random_type;
+
+   T        max_val = T(1) << bits_wanted;
+   unsigned bits_per_r_val = std::numeric_limits<random_type>::digits - 1;
+   unsigned terms_needed   = bits_wanted / bits_per_r_val + 1;
+
+   T val = 0;
+   for (unsigned i = 0; i < terms_needed; ++i)
+   {
+      val <<= bits_per_r_val;
+      val |= gen() & ((random_type(1) << bits_per_r_val) - 1);
+   }
+   val %= max_val;
+   return val;
+}
+
+template <class N>
+void test(unsigned max_bits)
+{
+   using boost::multiprecision::mpz_int;
+
+   for (unsigned bits = 8; bits <= max_bits; bits *= 2)
+   {
+      for (unsigned i = 0; i < 20; ++i)
+      {
+         mpz_int m = generate_random<mpz_int>(bits);
+         if (m == 0)
+            m = 1;
+         mpz_int a = generate_random<mpz_int>((std::min)(2 * bits, max_bits));
+         mpz_int b = generate_random<mpz_int>(bits);
+         mpz_int c = generate_random<mpz_int>(bits / 2 + 1);
+         mpz_int d = generate_random<mpz_int>(max_bits);
+
+         N m1(m.str()), a1(a.str()), b1(b.str()), c1(c.str()), d1(d.str());
+         // Fixed precision types may have truncated the values:
+         a = mpz_int(a1.str());
+         b = mpz_int(b1.str());
+         boost::multiprecision::fixed_modulus<N> fm(m1);
+
+         BOOST_CHECK_EQUAL(fm.modulus(), m1);
+         BOOST_CHECK_EQUAL(fm.reduce(a1).str(), mpz_int(a % m).str());
+         BOOST_CHECK_EQUAL(N(a1 % fm).str(), mpz_int(a % m).str());
+         BOOST_CHECK_EQUAL(fm.reduce(b1).str(), mpz_int(b % m).str());
+         BOOST_CHECK_EQUAL(fm.reduce(c1).str(), mpz_int(c % m).str());
+         // Values too large for a single Barrett step:
+         BOOST_CHECK_EQUAL(fm.reduce(d1).str(), mpz_int(d % m).str());
+         BOOST_CHECK_EQUAL(fm.reduce(m1).str(), "0");
+         BOOST_CHECK_EQUAL(fm.reduce(N(m1 - 1)).str(), mpz_int(m - 1).str());
+         if (2 * bits <= max_bits)
+         {
+            BOOST_CHECK_EQUAL(fm.reduce(N(m1 * m1 - 1)).str(), mpz_int((m * m - 1) % m).str());
+            BOOST_CHECK_EQUAL(fm.reduce(N(m1 * m1)).str(), "0");
+         }
+         BOOST_CHECK_EQUAL(fm.multiply(b1, d1).str(), mpz_int((b * d) % m).str());
+         BOOST_CHECK_EQUAL(fm.multiply(d1, d1).str(), mpz_int((d * d) % m).str());
+         if (std::numeric_limits<N>::is_signed)
+         {
+            BOOST_CHECK_EQUAL(fm.reduce(N(0 - a1)).str(), mpz_int((-a) % m).str());
+            BOOST_CHECK_EQUAL(fm.multiply(N(0 - b1), d1).str(), mpz_int((-b * d) % m).str());
+         }
+      }
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   test<cpp_int>(4096);
+   test<uint1024_t>(1024);
+   test<int512_t>(512);
+   test<checked_uint512_t>(512);
+   test<uint128_t>(128);
+   test<number<cpp_int_backend<64, 64, signed_magnitude, unchecked, void> > >(32);
+   test<mpz_int>(2048);
+   test<number<cpp_int_backend<4096, 4096, signed_magnitude, unchecked, std::allocator<limb_type> > > >(2048);
+   test<number<cpp_int_backend<>, et_off> >(1024);
+
+   // Powers of two and near powers of two make the quotient estimate least accurate:
+   for (unsigned bits = 65; bits < 1000; bits += 37)
+   {
+      cpp_int m = (cpp_int(1) << bits) + 1;
+      fixed_modulus<cpp_int> fm(m), fm2(cpp_int(m - 2));
+      cpp_int x = (cpp_int(1) << (2 * bits)) - 1;
+      BOOST_CHECK_EQUAL(fm.reduce(x), x % m);
+      BOOST_CHECK_EQUAL(fm2.reduce(x), x % (m - 2));
+      x = m * m - 1;
+      BOOST_CHECK_EQUAL(fm.reduce(x), x % m);
+   }
+
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(fixed_modulus<cpp_int>(cpp_int(0)), std::domain_error);
+   BOOST_CHECK_THROW(fixed_modulus<cpp_int>(cpp_int(-7)), std::domain_error);
+   BOOST_CHECK_THROW(fixed_modulus<uint512_t>(uint512_t(0)), std::domain_error);
+   BOOST_CHECK_THROW(fixed_modulus<mpz_int>(mpz_int(-7)), std::domain_error);
+#endif
+   return boost::report_errors();
+}
@@ -0,0 +1,219 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Fused multiply-add and multiply-subtract: cpp_int results are compared with GMP,
+// and cpp_bin_float results with std::fma, or with a correctly rounded reference
+// computed at higher precision, to check that only one rounding takes place.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_int_distribution.hpp>
+#include <cmath>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+boost::random::mt19937 gen;
+
+mpz_int random_mpz(unsigned max_limbs)
+{
+   const unsigned limb_bits = sizeof(limb_type) * CHAR_BIT;
+   unsigned       bits      = boost::random::uniform_int_distribution<unsigned>(1, max_limbs * limb_bits)(gen);
+   mpz_int        val       = 0;
+   for (unsigned i = 0; i < bits; i += 32)
+   {
+      val <<= 32;
+      val |= gen();
+   }
+   val >>= (bits + 31) / 32 * 32 - bits;
+   switch (gen() % 8)
+   {
+   case 0:
+      val = 0;
+      break;
+   case 1:
+      // All ones produces the longest carry chains:
+      val = (mpz_int(1) << bits) - 1;
+      break;
+   default:
+      break;
+   }
+   return gen() & 1 ? mpz_int(-val) : val;
+}
+
+template <class N>
+N from_mpz(const mpz_int& x)
+{
+   return N(x.str());
+}
+
+template <class N>
+void test_integer(unsigned max_limbs, unsigned count)
+{
+   for (unsigned i = 0; i < count; ++i)
+   {
+      mpz_int a = random_mpz(max_limbs), b = random_mpz(max_limbs), c = random_mpz(max_limbs), d = random_mpz(max_limbs);
+      N       a1 = from_mpz<N>(a), b1 = from_mpz<N>(b), c1 = from_mpz<N>(c), d1 = from_mpz<N>(d);
+
+      N x(c1);
+      x += a1 * b1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(c + a * b));
+      x = c1;
+      x -= a1 * b1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(c - a * b));
+      // Sums of products:
+      x = a1 * b1 + c1 * d1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * b + c * d));
+      x = a1 * b1 - c1 * d1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * b - c * d));
+      x = a1 * b1 + c1 * d1 - a1 * d1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * b + c * d - a * d));
+      // Aliasing of the accumulator and the operands:
+      x = c1;
+      x = a1 * b1 + x;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * b + c));
+      x = c1;
+      x = a1 * b1 - x;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * b - c));
+      x = c1;
+      x += x * a1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(c + c * a));
+      x = c1;
+      x -= x * x;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(c - c * c));
+      x = a1 * a1 - b1 * b1;
+      BOOST_CHECK_EQUAL(x, from_mpz<N>(a * a - b * b));
+      // Exact cancellation:
+      x = a1 * b1;
+      x -= a1 * b1;
+      BOOST_CHECK_EQUAL(x, 0);
+      BOOST_CHECK(!(x < 0));
+   }
+   // Dot product:
+   mpz_int s = 0;
+   N       s1 = 0;
+   for (unsigned i = 0; i < 200; ++i)
+   {
+      mpz_int a = random_mpz(max_limbs), b = random_mpz(max_limbs);
+      s += a * b;
+      s1 += from_mpz<N>(a) * from_mpz<N>(b);
+   }
+   BOOST_CHECK_EQUAL(s1, from_mpz<N>(s));
+}
+
+template <class F>
+void test_double()
+{
+   // The 53-bit type must agree exactly with std::fma:
+   boost::random::uniform_int_distribution<int> exp_dist(-40, 40);
+   for (unsigned i = 0; i < 20000; ++i)
+   {
+      double a = std::ldexp(static_cast<double>(gen()) * 4294967296.0 + gen(), exp_dist(gen) - 64);
+      double b = std::ldexp(static_cast<double>(gen()) * 4294967296.0 + gen(), exp_dist(gen) - 64);
+      double c = std::ldexp(static_cast<double>(gen()) * 4294967296.0 + gen(), exp_dist(gen) - 64);
+      if (gen() & 1)
+         a = -a;
+      if (gen() & 1)
+         c = -c;
+      if (i % 4 == 0)
+         c = -(a * b) * (1 + std::ldexp(static_cast<double>(gen() % 16) - 8, -52)); // near total cancellation
+      if (i % 7 == 0)
+         c = std::ldexp(c, exp_dist(gen) * 3); // large exponent gaps
+      F r = fma(F(a), F(b), F(c));
+      BOOST_CHECK_EQUAL(r.template convert_to<double>(), std::fma(a, b, c));
+      F x(c);
+      x = fma(F(-a), F(b), x);
+      BOOST_CHECK_EQUAL(x.template convert_to<double>(), std::fma(-a, b, c));
+   }
+   // Rounding ties and sticky bits:
+   double one_ulp = std::ldexp(1.0, -52);
+   BOOST_CHECK_EQUAL(fma(F(1 + one_ulp), F(1 - one_ulp), F(-1)).template convert_to<double>(), std::fma(1 + one_ulp, 1 - one_ulp, -1.0));
+   BOOST_CHECK_EQUAL(fma(F(1 + one_ulp), F(1 + one_ulp), F(1)).template convert_to<double>(), std::fma(1 + one_ulp, 1 + one_ulp, 1.0));
+   BOOST_CHECK_EQUAL(fma(F(1), F(1), F(std::ldexp(1.0, -200))).template convert_to<double>(), 1.0);
+   BOOST_CHECK_EQUAL(fma(F(1), F(1), F(-std::ldexp(1.0, -200))).template convert_to<double>(), 1.0);
+   BOOST_CHECK_EQUAL(fma(F(std::ldexp(1.0, -53)), F(1 + one_ulp), F(1)).template convert_to<double>(), 1 + one_ulp);
+   BOOST_CHECK_EQUAL(fma(F(-std::ldexp(1.0, -54)), F(1 + one_ulp), F(1)).template convert_to<double>(), 1 - one_ulp / 2);
+   BOOST_CHECK_EQUAL(fma(F(std::ldexp(1.0, -200)), F(std::ldexp(1.0, -200)), F(-1)).template convert_to<double>(), -1.0);
+   // Special values:
+   BOOST_CHECK((boost::multiprecision::isnan)(fma(F(0), std::numeric_limits<F>::infinity(), F(1))));
+   BOOST_CHECK_EQUAL(fma(F(2), F(3), std::numeric_limits<F>::infinity()), std::numeric_limits<F>::infinity());
+   BOOST_CHECK_EQUAL(fma(F(0), F(3), F(5)), 5);
+   BOOST_CHECK_EQUAL(fma(F(2), F(3), F(0)), 6);
+   BOOST_CHECK_EQUAL(fma((std::numeric_limits<F>::max)(), F(2), -(std::numeric_limits<F>::max)()), (std::numeric_limits<F>::max)());
+   BOOST_CHECK_EQUAL(fma((std::numeric_limits<F>::max)(), F(4), -(std::numeric_limits<F>::max)()), std::numeric_limits<F>::infinity());
+   BOOST_CHECK_EQUAL(fma((std::numeric_limits<F>::min)(), F(0.5), F(0)), 0);
+   BOOST_CHECK_EQUAL(fma((std::numeric_limits<F>::min)(), F(0.5), (std::numeric_limits<F>::min)()), (std::numeric_limits<F>::min)() * 1.5);
+}
+
+template <class F>
+void test_float()
+{
+   //
+   // Reference results come from a type wide enough to hold the sum exactly, followed
+   // by a single correctly rounded narrowing conversion:
+   //
+   using backend_type = typename F::backend_type;
+   using wide_type    = number<cpp_bin_float<backend_type::bit_count * 4, digit_base_2> >;
+   boost::random::uniform_int_distribution<int> exp_dist(-static_cast<int>(backend_type::bit_count), backend_type::bit_count);
+
+   for (unsigned i = 0; i < 5000; ++i)
+   {
+      F a = ldexp(F(gen()) / gen(), exp_dist(gen) / 4);
+      F b = ldexp(F(gen()) / gen(), exp_dist(gen) / 4);
+      F c = ldexp(F(gen()) / gen(), exp_dist(gen));
+      if (gen() & 1)
+         a = -a;
+      if (gen() & 1)
+         c = -c;
+      if (i % 4 == 0)
+         c = -a * b;
+      if (i % 8 == 0)
+         c = nextafter(c, F(gen() & 1 ? 1 : -1));
+
+      F expected_add(wide_type(c) + wide_type(a) * wide_type(b));
+      F expected_sub(wide_type(c) - wide_type(a) * wide_type(b));
+      F x(c);
+      x += a * b;
+      BOOST_CHECK_EQUAL(x, expected_add);
+      x = c;
+      x -= a * b;
+      BOOST_CHECK_EQUAL(x, expected_sub);
+      x = a * b + c;
+      BOOST_CHECK_EQUAL(x, expected_add);
+      x = a * b - c;
+      BOOST_CHECK_EQUAL(x, F(-expected_sub));
+      BOOST_CHECK_EQUAL(fma(a, b, c), expected_add);
+      // Result aliasing an operand:
+      x = a;
+      x += x * b;
+      BOOST_CHECK_EQUAL(x, F(wide_type(a) + wide_type(a) * wide_type(b)));
+   }
+}
+
+int main()
+{
+   test_integer<cpp_int>(20, 2000);
+   test_integer<cpp_int>(100, 200);
+   test_integer<number<cpp_int_backend<0, 0, signed_magnitude, unchecked, std::allocator<char> >, et_off> >(20, 500);
+   test_integer<number<cpp_int_backend<0, 0, signed_magnitude, checked, std::allocator<limb_type> > > >(20, 500);
+   // Fixed precision types take the unfused path:
+   test_integer<int1024_t>(7, 500);
+
+   test_double<cpp_bin_float_double>();
+   // Expression templates are needed for x += a * b to reach the fused code:
+   test_float<number<cpp_bin_float<50>, et_on> >();
+   test_float<number<cpp_bin_float<100, digit_base_10, std::allocator<char> >, et_on> >();
+   test_float<number<cpp_bin_float<256, digit_base_2, void, std::int32_t, -100000, 100000>, et_on> >();
+
+   return boost::report_errors();
+}
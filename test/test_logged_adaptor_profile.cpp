@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks the per operation counters which logged_adaptor keeps when BOOST_MP_LOGGED_ADAPTOR_PROFILE
+// is defined, including those from other threads.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#define BOOST_MP_LOGGED_ADAPTOR_PROFILE
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/logged_adaptor.hpp>
+#include <sstream>
+#include <thread>
+#include <vector>
+#include "test.hpp"
+
+using namespace boost::multiprecision;
+
+using logged_int   = number<logged_adaptor<cpp_int_backend<> >, et_off>;
+using logged_float = logged_adaptor_t<cpp_bin_float_50>;
+
+const logged_adaptor_profile_entry* find_entry(const std::vector<logged_adaptor_profile_entry>& entries, const std::string& backend_part, const std::string& operation)
+{
+   for (const logged_adaptor_profile_entry& e : entries)
+   {
+      if ((e.operation == operation) && (e.backend.find(backend_part) != std::string::npos))
+         return &e;
+   }
+   return nullptr;
+}
+
+std::uint64_t count_of(const std::string& backend_part, const std::string& operation)
+{
+   std::vector<logged_adaptor_profile_entry> entries = logged_adaptor_profile();
+   const logged_adaptor_profile_entry*       e       = find_entry(entries, backend_part, operation);
+   return e ? e->count : 0;
+}
+
+void multiply_loop(unsigned n)
+{
+   logged_int a = logged_int(1) << 1000;
+   logged_int b(3);
+   for (unsigned i = 0; i < n; ++i)
+      a *= b;
+}
+
+int main()
+{
+   reset_logged_adaptor_profile();
+   BOOST_CHECK(logged_adaptor_profile().empty());
+
+   multiply_loop(100);
+   BOOST_CHECK_EQUAL(count_of("cpp_int_backend", "*="), 100u);
+   //
+   // The operands are 1000 bits, or 1024 counting whole limbs, so all fall into the 5th bucket:
+   //
+   {
+      std::vector<logged_adaptor_profile_entry> entries = logged_adaptor_profile();
+      const logged_adaptor_profile_entry*       e       = find_entry(entries, "cpp_int_backend", "*=");
+      BOOST_CHECK(e);
+      if (e)
+      {
+         std::uint64_t total = 0;
+         for (std::size_t i = 0; i < logged_adaptor_profile_bit_buckets; ++i)
+            total += e->bits[i];
+         BOOST_CHECK_EQUAL(total, e->count);
+         BOOST_CHECK_EQUAL(e->bits[4] + e->bits[5], e->count);
+         BOOST_CHECK(e->ticks > 0);
+      }
+   }
+   //
+   // Floating point types are bucketed by precision, and we record functions as well as arithmetic:
+   //
+   {
+      logged_float x(2);
+      logged_float y = exp(x);
+      y /= x;
+      y = sqrt(y);
+      BOOST_CHECK(y > 1);
+      BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "exp"), 1u);
+      BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "/="), 1u);
+      BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "sqrt"), 1u);
+      // number may construct from an int directly, or default construct then assign:
+      BOOST_CHECK(count_of("cpp_bin_float", "construct from arithmetic type") + count_of("cpp_bin_float", "Assignment from arithmetic type") >= 1u);
+      std::vector<logged_adaptor_profile_entry> entries = logged_adaptor_profile();
+      const logged_adaptor_profile_entry*       e       = find_entry(entries, "cpp_bin_float", "exp");
+      BOOST_CHECK(e && (e->bits[2] == 1)); // 168 bits
+      std::string s = y.str();
+      BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "Conversion to string"), 1u);
+      double d = y.convert_to<double>();
+      BOOST_CHECK(d > 1);
+      BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "convert_to"), 1u);
+   }
+   //
+   // Counts from other threads are included, both while they're running and after they've exited:
+   //
+   std::vector<std::thread> threads;
+   for (unsigned i = 0; i < 4; ++i)
+      threads.emplace_back(multiply_loop, 250);
+   for (std::thread& t : threads)
+      t.join();
+   BOOST_CHECK_EQUAL(count_of("cpp_int_backend", "*="), 1100u);
+   multiply_loop(10);
+   BOOST_CHECK_EQUAL(count_of("cpp_int_backend", "*="), 1110u);
+   //
+   // The reports:
+   //
+   std::stringstream ss;
+   print_logged_adaptor_profile(ss);
+   BOOST_CHECK(ss.str().find("*=: 1110 calls") != std::string::npos);
+   BOOST_CHECK(ss.str().find(logged_adaptor_profile_tick_unit()) != std::string::npos);
+   ss.str("");
+   print_logged_adaptor_profile_json(ss);
+   std::string json = ss.str();
+   BOOST_CHECK(json.find("{\"tick_unit\":\"") == 0);
+   BOOST_CHECK(json.find("\"operation\":\"*=\",\"count\":1110,") != std::string::npos);
+   BOOST_CHECK(json.find("\"operation\":\"exp\",\"count\":1,") != std::string::npos);
+   //
+   // Reset starts counting again from zero:
+   //
+   reset_logged_adaptor_profile();
+   BOOST_CHECK(logged_adaptor_profile().empty());
+   BOOST_CHECK_EQUAL(count_of("cpp_int_backend", "*="), 0u);
+   multiply_loop(5);
+   BOOST_CHECK_EQUAL(count_of("cpp_int_backend", "*="), 5u);
+   BOOST_CHECK_EQUAL(count_of("cpp_bin_float", "exp"), 0u);
+
+   return boost::report_errors();
+}
@@ -0,0 +1,199 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Compare batched and deterministic Miller-Rabin testing with GMP's results,
+// running the batch both inline and on a small thread pool.
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/multiprecision/gmp.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin_batch.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <boost/random.hpp>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include "test.hpp"
+
+//
+// Minimal fixed size thread pool, used as the executor:
+//
+class thread_pool
+{
+ public:
+   explicit thread_pool(unsigned n)
+   {
+      for (unsigned i = 0; i < n; ++i)
+         m_threads.emplace_back([this]() { run(); });
+   }
+   ~thread_pool()
+   {
+      {
+         std::lock_guard<std::mutex> l(m_mutex);
+         m_stop = true;
+      }
+      m_ready.notify_all();
+      for (std::thread& t : m_threads)
+         t.join();
+   }
+   void operator()(std::function<void()> f)
+   {
+      {
+         std::lock_guard<std::mutex> l(m_mutex);
+         m_tasks.push_back(std::move(f));
+         ++m_submitted;
+      }
+      m_ready.notify_one();
+   }
+   std::size_t submitted() const { return m_submitted; }
+
+ private:
+   void run()
+   {
+      while (true)
+      {
+         std::function<void()> f;
+         {
+            std::unique_lock<std::mutex> l(m_mutex);
+            m_ready.wait(l, [this]() { return m_stop || !m_tasks.empty(); });
+            if (m_tasks.empty())
+               return;
+            f = std::move(m_tasks.front());
+            m_tasks.pop_front();
+         }
+         f();
+      }
+   }
+   std::mutex                        m_mutex;
+   std::condition_variable           m_ready;
+   std::deque<std::function<void()> > m_tasks;
+   std::vector<std::thread>          m_threads;
+   std::size_t                       m_submitted = 0;
+   bool                              m_stop      = false;
+};
+
+template <class I>
+void test(thread_pool& pool)
+{
+   using namespace boost::random;
+   using namespace boost::multiprecision;
+
+   static const unsigned test_bits =
+      std::numeric_limits<I>::digits && (std::numeric_limits<I>::digits <= 256)
+         ? std::numeric_limits<I>::digits
+         : 128;
+
+   independent_bits_engine<mt11213b, test_bits, I> gen;
+   mt19937                                          gen2;
+
+   std::vector<I> candidates;
+   for (unsigned i = 1; i < boost::math::max_prime; i += 7)
+      candidates.push_back(I(boost::math::prime(i)));
+   for (unsigned i = 0; i < 2000; ++i)
+      candidates.push_back(gen());
+   // Some values from the screening stage:
+   candidates.push_back(I(0));
+   candidates.push_back(I(1));
+   candidates.push_back(I(2));
+   candidates.push_back(I(4));
+   candidates.push_back(I(227));
+   candidates.push_back(I(229));
+   candidates.push_back(I(231));
+
+   std::vector<bool> inline_result = miller_rabin_test_batch(candidates, 25, gen2);
+   std::vector<bool> pool_result   = miller_rabin_test_batch(candidates, 25, gen2, pool);
+   BOOST_CHECK_EQUAL(inline_result.size(), candidates.size());
+   BOOST_CHECK_EQUAL(pool_result.size(), candidates.size());
+   for (std::size_t i = 0; i < candidates.size(); ++i)
+   {
+      bool is_gmp_prime = mpz_probab_prime_p(mpz_int(candidates[i]).backend().data(), 25) ? true : false;
+      BOOST_CHECK_EQUAL(inline_result[i], is_gmp_prime);
+      BOOST_CHECK_EQUAL(pool_result[i], is_gmp_prime);
+      BOOST_CHECK_EQUAL(miller_rabin_test(candidates[i], 25, gen2), is_gmp_prime);
+      if (std::numeric_limits<I>::digits && (std::numeric_limits<I>::digits <= 64))
+         BOOST_CHECK_EQUAL(miller_rabin_test_deterministic(candidates[i]), is_gmp_prime);
+   }
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+
+   thread_pool pool(4);
+
+   test<mpz_int>(pool);
+   test<std::uint64_t>(pool);
+   test<std::uint32_t>(pool);
+   test<cpp_int>(pool);
+   test<uint512_t>(pool);
+   test<number<cpp_int_backend<64, 64, unsigned_magnitude, checked, void>, et_off> >(pool);
+
+   //
+   // Strong pseudoprimes to many small bases, composites which random witnesses are
+   // unlikely to catch all need the full deterministic witness set:
+   //
+   const std::uint64_t pseudoprimes[] = {
+       2047u,                             // base 2
+       3215031751u,                       // bases 2, 3, 5, 7
+       2152302898747u,                    // bases 2 to 11
+       3474749660383u,                    // bases 2 to 13
+       341550071728321u,                  // bases 2 to 17
+       3825123056546413051u,              // bases 2 to 23
+   };
+   for (std::uint64_t p : pseudoprimes)
+   {
+      BOOST_CHECK(!miller_rabin_test_deterministic(p));
+      BOOST_CHECK(!miller_rabin_test_deterministic(cpp_int(p)));
+   }
+   std::vector<cpp_int> pp(std::begin(pseudoprimes), std::end(pseudoprimes));
+   boost::random::mt19937 gen;
+   for (bool b : miller_rabin_test_batch(pp, 25, gen, pool))
+      BOOST_CHECK(!b);
+
+   // The largest 64-bit prime, and an expression template argument:
+   BOOST_CHECK(miller_rabin_test_deterministic(std::uint64_t(18446744073709551557u)));
+   BOOST_CHECK(miller_rabin_test_deterministic(cpp_int(18446744073709551557u)));
+   cpp_int a(1000000007), b(998244353);
+   BOOST_CHECK(!miller_rabin_test_deterministic(a * b));
+   BOOST_CHECK(miller_rabin_test_deterministic(a + 2 * b - a - b));
+
+   // Mixed sizes in one batch, a composite above 2^64 is caught by the random witnesses:
+   std::vector<cpp_int> mixed = {cpp_int(18446744073709551557u), (cpp_int(1) << 127) - 1, a * b, ((cpp_int(1) << 89) - 1) * ((cpp_int(1) << 107) - 1), cpp_int(9)};
+   std::vector<bool>    r     = miller_rabin_test_batch(mixed, 25, gen, pool);
+   BOOST_CHECK(r[0]);
+   BOOST_CHECK(r[1]);
+   BOOST_CHECK(!r[2]);
+   BOOST_CHECK(!r[3]);
+   BOOST_CHECK(!r[4]);
+
+   // Empty batches do no work:
+   std::size_t submitted = pool.submitted();
+   BOOST_CHECK(miller_rabin_test_batch(std::vector<cpp_int>(), 25, gen, pool).empty());
+   BOOST_CHECK(miller_rabin_test_batch(std::vector<cpp_int>(3, cpp_int(10)), 25, gen, pool) == std::vector<bool>(3, false));
+   BOOST_CHECK_EQUAL(submitted, pool.submitted());
+
+#ifndef BOOST_NO_EXCEPTIONS
+   BOOST_CHECK_THROW(miller_rabin_test_deterministic(cpp_int(1) << 64), std::domain_error);
+   BOOST_CHECK_THROW(miller_rabin_test_deterministic((cpp_int(1) << 64) + 13), std::domain_error);
+   // An executor which fails part way through leaves no rounds running:
+   std::size_t accepted = 0;
+   auto        failing  = [&](std::function<void()> f) {
+      if (accepted == 10)
+         throw std::runtime_error("executor full");
+      ++accepted;
+      pool(std::move(f));
+   };
+   std::vector<cpp_int> many(50, (cpp_int(1) << 127) - 1);
+   BOOST_CHECK_THROW(miller_rabin_test_batch(many, 25, gen, failing), std::runtime_error);
+#endif
+   return boost::report_errors();
+}
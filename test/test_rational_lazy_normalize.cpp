@@ -0,0 +1,171 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock.
+//  Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#include <boost/detail/lightweight_test.hpp>
+#include "test.hpp"
+
+#include <boost/multiprecision/cpp_int.hpp>
+#include <random>
+
+//
+// Values computed with lazy normalization must agree with the same values computed
+// with cpp_rational, however far from lowest terms the representation has drifted:
+//
+template <class Lazy>
+bool same_value(const Lazy& a, const boost::multiprecision::cpp_rational& b)
+{
+   return (a.str() == b.str()) && (numerator(a) == numerator(b)) && (denominator(a) == denominator(b));
+}
+
+//
+// Values whose denominator has reached the threshold must be in lowest terms:
+//
+template <class Lazy>
+bool large_is_reduced(const Lazy& a, std::size_t bits)
+{
+   using boost::multiprecision::cpp_int;
+   const cpp_int n(a.backend().num()), d(a.backend().denom());
+   if (d <= 0)
+      return false;
+   return (boost::multiprecision::msb(d) < bits) || (gcd(n, d) == 1);
+}
+
+template <std::size_t Bits>
+void test()
+{
+   using boost::multiprecision::cpp_rational;
+   using boost::multiprecision::cpp_int;
+   using lazy_type = boost::multiprecision::number<boost::multiprecision::rational_adaptor<boost::multiprecision::cpp_int_backend<>, boost::multiprecision::lazy_normalize<Bits> > >;
+
+   std::mt19937                        gen;
+   std::uniform_int_distribution<int>  small(-50, 50);
+   std::uniform_int_distribution<int>  op(0, 9);
+
+   lazy_type    l(1), l2(2);
+   cpp_rational e(1), e2(2);
+
+   for (unsigned i = 0; i < 2000; ++i)
+   {
+      int n = small(gen), d = small(gen);
+      if (d == 0)
+         d = 1;
+      lazy_type    lv(n, d);
+      cpp_rational ev(n, d);
+      BOOST_CHECK(same_value(lv, ev));
+
+      switch (op(gen))
+      {
+      case 0:
+         l += lv;
+         e += ev;
+         break;
+      case 1:
+         l -= lv;
+         e -= ev;
+         break;
+      case 2:
+         l *= lv;
+         e *= ev;
+         break;
+      case 3:
+         if (n)
+         {
+            l /= lv;
+            e /= ev;
+         }
+         break;
+      case 4:
+         l += n;
+         e += n;
+         break;
+      case 5:
+         l -= n;
+         e -= n;
+         break;
+      case 6:
+         l *= d;
+         e *= d;
+         break;
+      case 7:
+         l /= d;
+         e /= d;
+         break;
+      case 8:
+         l2 = l * lv - l2 / 3;
+         e2 = e * ev - e2 / 3;
+         break;
+      case 9:
+         l2 = d / l2 + l;
+         e2 = d / e2 + e;
+         break;
+      }
+      // Don't let the values grow without bound:
+      if (boost::multiprecision::msb(abs(numerator(e))) > 3000)
+      {
+         l = lv;
+         e = ev;
+      }
+      if (!e2.is_zero() && boost::multiprecision::msb(abs(numerator(e2))) > 3000)
+      {
+         l2 = lv + 1;
+         e2 = ev + 1;
+      }
+      BOOST_CHECK(same_value(l, e));
+      BOOST_CHECK(same_value(l2, e2));
+      BOOST_CHECK(large_is_reduced(l, Bits));
+      BOOST_CHECK(large_is_reduced(l2, Bits));
+
+      // Comparisons and hashing use the value, not the representation:
+      BOOST_CHECK_EQUAL(l == l2, e == e2);
+      BOOST_CHECK_EQUAL(l != l2, e != e2);
+      BOOST_CHECK_EQUAL(l < l2, e < e2);
+      BOOST_CHECK_EQUAL(l > l2, e > e2);
+      BOOST_CHECK_EQUAL(l == n, e == n);
+      BOOST_CHECK_EQUAL(n == l, n == e);
+      BOOST_CHECK_EQUAL(l < n, e < n);
+
+      lazy_type t(l);
+      t.backend().num() = (numerator(l) * 7).backend();
+      t.backend().denom() = (denominator(l) * 7).backend();
+      BOOST_CHECK(t == l);
+      BOOST_CHECK_EQUAL(hash_value(t), hash_value(l));
+      BOOST_CHECK_EQUAL(t.str(), e.str());
+      BOOST_CHECK_EQUAL(t.template convert_to<double>(), e.template convert_to<double>());
+      t.backend().normalize();
+      BOOST_CHECK(t.backend().denom().compare(denominator(e).backend()) == 0);
+      BOOST_CHECK(t.backend().num().compare(numerator(e).backend()) == 0);
+   }
+
+   // The denominator never grows past the threshold, or the size in lowest terms:
+   lazy_type    s = 0;
+   cpp_rational es = 0;
+   for (unsigned k = 1; k < 300; ++k)
+   {
+      s += lazy_type(1, k);
+      es += cpp_rational(1, k);
+      BOOST_CHECK(boost::multiprecision::msb(cpp_int(s.backend().denom())) < (std::max)(Bits, boost::multiprecision::msb(denominator(es)) + 1));
+      BOOST_CHECK(large_is_reduced(s, Bits));
+   }
+   BOOST_CHECK(same_value(s, es));
+
+   BOOST_CHECK_THROW(lazy_type(l / lazy_type(0)), std::overflow_error);
+   BOOST_CHECK_THROW(lazy_type(l / 0), std::overflow_error);
+   BOOST_CHECK_THROW(lazy_type(2 / lazy_type(0)), std::overflow_error);
+}
+
+int main()
+{
+   test<64>();
+   test<256>();
+   test<2048>();
+
+   return boost::report_errors();
+}
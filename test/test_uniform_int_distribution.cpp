@@ -0,0 +1,237 @@
+///////////////////////////////////////////////////////////////
+//  Copyright 2026 John Maddock. Distributed under the Boost
+//  Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt
+
+//
+// Checks uniform_int_distribution over multiprecision integers, both the limb filling
+// version (engines with a power of 2 range) and the generic one (other engines).
+//
+
+#ifdef _MSC_VER
+#define _SCL_SECURE_NO_WARNINGS
+#endif
+
+#if !defined(TEST_MPZ) && !defined(TEST_CPP_INT)
+#define TEST_MPZ
+#define TEST_CPP_INT
+
+#ifdef _MSC_VER
+#pragma message("CAUTION!!: No backend type specified so testing everything.... this will take some time!!")
+#endif
+#ifdef __GNUC__
+#pragma warning "CAUTION!!: No backend type specified so testing everything.... this will take some time!!"
+#endif
+
+#endif
+
+#if defined(TEST_MPZ)
+#include <boost/multiprecision/gmp.hpp>
+#endif
+#ifdef TEST_CPP_INT
+#include <boost/multiprecision/cpp_int.hpp>
+#endif
+#include <boost/multiprecision/detail/uniform_int_distribution.hpp>
+#include <random>
+#include <vector>
+#include "test.hpp"
+
+template <class T, class Engine>
+void test_range(Engine& eng, const T& a, const T& b)
+{
+   boost::multiprecision::uniform_int_distribution<T> dist(a, b);
+   T                                                  lo = b, hi = a;
+   for (unsigned i = 0; i < 1000; ++i)
+   {
+      T val = dist(eng);
+      BOOST_CHECK((val >= a) && (val <= b));
+      if (val < lo)
+         lo = val;
+      if (val > hi)
+         hi = val;
+   }
+   if (b - a < 10)
+   {
+      // Every value should have turned up:
+      BOOST_CHECK_EQUAL(lo, a);
+      BOOST_CHECK_EQUAL(hi, b);
+   }
+   else if (b - a > 1000000)
+   {
+      // The extremes should be close to the ends of the range:
+      T tol = (b - a) / 50;
+      BOOST_CHECK(lo - a < tol);
+      BOOST_CHECK(b - hi < tol);
+   }
+}
+
+template <class T, class Engine>
+void test_counts(Engine& eng, const T& a, unsigned buckets)
+{
+   // Small ranges, each value should turn up with close to the expected frequency:
+   boost::multiprecision::uniform_int_distribution<T> dist(a, a + (buckets - 1));
+   std::vector<unsigned>                              counts(buckets);
+   const unsigned                                     samples = 2000 * buckets;
+   for (unsigned i = 0; i < samples; ++i)
+   {
+      T val = dist(eng);
+      BOOST_CHECK((val >= a) && (val - a < buckets));
+      ++counts[static_cast<unsigned>(T(val - a))];
+   }
+   for (unsigned i = 0; i < buckets; ++i)
+   {
+      BOOST_CHECK(counts[i] > 1750);
+      BOOST_CHECK(counts[i] < 2250);
+   }
+}
+
+template <class T, class Engine>
+void test_top_limb(Engine& eng, unsigned bits)
+{
+   //
+   // The range is 3 * 2^bits - 1, so 1/3 of the values should have the top bit set, and
+   // 2/3 of those the next bit clear.  This exercises rejection on the top limb, and on
+   // the lower limbs when the top limb equals that of the range:
+   //
+   T                                                  b = (T(3) << bits) - 1;
+   boost::multiprecision::uniform_int_distribution<T> dist(0, b);
+   unsigned                                           high = 0, odd = 0;
+   const unsigned                                     samples = 6000;
+   for (unsigned i = 0; i < samples; ++i)
+   {
+      T val = dist(eng);
+      BOOST_CHECK(val <= b);
+      if (bit_test(val, bits + 1))
+         ++high;
+      if (bit_test(val, 0))
+         ++odd;
+   }
+   BOOST_CHECK(high > samples / 3 - 200);
+   BOOST_CHECK(high < samples / 3 + 200);
+   BOOST_CHECK(odd > samples / 2 - 250);
+   BOOST_CHECK(odd < samples / 2 + 250);
+   //
+   // A range of 2^bits has just one value with the top bit set:
+   //
+   boost::multiprecision::uniform_int_distribution<T> dist2(0, T(1) << bits);
+   for (unsigned i = 0; i < 100; ++i)
+      BOOST_CHECK(dist2(eng) <= T(1) << bits);
+}
+
+template <class T, class Engine>
+void test_bulk(const Engine& e, const T& a, const T& b)
+{
+   //
+   // generate() should give exactly the same sequence as repeated calls to operator():
+   //
+   Engine                                             eng1(e), eng2(e);
+   boost::multiprecision::uniform_int_distribution<T> dist(a, b);
+   std::vector<T>                                     v1, v2(200);
+   for (unsigned i = 0; i < v2.size(); ++i)
+      v1.push_back(dist(eng1));
+   dist.generate(v2.begin(), v2.end(), eng2);
+   BOOST_CHECK(v1 == v2);
+   // And again, reusing the storage:
+   dist.generate(v2.begin(), v2.end(), eng2);
+   for (const T& val : v2)
+      BOOST_CHECK((val >= a) && (val <= b));
+   BOOST_CHECK(v1 != v2);
+   // Using a param_type:
+   typename boost::multiprecision::uniform_int_distribution<T>::param_type p(a, a);
+   dist.generate(v2.begin(), v2.end(), eng2, p);
+   for (const T& val : v2)
+      BOOST_CHECK_EQUAL(val, a);
+}
+
+template <class T, class Engine>
+void test_engine(Engine& eng, bool is_signed)
+{
+   T big = T(1) << 700;
+   T zero(0);
+   test_range(eng, zero, zero);
+   test_range(eng, T(5), T(5));
+   test_range(eng, zero, T(1));
+   test_range(eng, T(2), T(7));
+   test_range(eng, zero, T(1) << 64);
+   test_range(eng, T(1) << 64, (T(1) << 65) - 1);
+   test_range(eng, big, T(big * 2));
+   test_range(eng, big, T(big + 5));
+   test_range(eng, T(3), (T(1) << 2048) - 159);
+   if (is_signed)
+   {
+      test_range(eng, T(-big), big);
+      test_range(eng, T(-big), T(-big + 5));
+      test_range(eng, T(-3), T(3));
+   }
+   test_counts(eng, zero, 10);
+   test_counts(eng, big, 7);
+   test_top_limb<T>(eng, 62);
+   test_top_limb<T>(eng, 63);
+   test_top_limb<T>(eng, 64);
+   test_top_limb<T>(eng, 300);
+   test_top_limb<T>(eng, 511);
+   test_bulk(eng, zero, big);
+   test_bulk(eng, T(10), T(19));
+   if (is_signed)
+      test_bulk(eng, T(-big), big);
+}
+
+template <class T>
+void test(bool is_signed)
+{
+   std::mt19937    e32;
+   std::mt19937_64 e64;
+   std::minstd_rand e31; // range is not a power of 2, so the generic version is used
+   std::independent_bits_engine<std::mt19937, 20, std::uint32_t> e20;
+   test_engine<T>(e32, is_signed);
+   test_engine<T>(e64, is_signed);
+   test_engine<T>(e31, is_signed);
+   test_engine<T>(e20, is_signed);
+}
+
+template <class T>
+void test_fixed()
+{
+   //
+   // Fixed precision types, including ranges which fill the type:
+   //
+   std::mt19937_64 eng;
+   T               m = (std::numeric_limits<T>::max)();
+   test_range(eng, T(0), m);
+   test_range(eng, T(m - 5), m);
+   test_range(eng, T(0), T(m / 3));
+   test_counts(eng, T(m - 9), 10);
+   test_bulk(eng, T(1), T(m / 2));
+   test_top_limb<T>(eng, std::numeric_limits<T>::digits - 2);
+}
+
+int main()
+{
+   using namespace boost::multiprecision;
+#ifdef TEST_CPP_INT
+   test<cpp_int>(true);
+   test<number<cpp_int_backend<>, et_off> >(true);
+   test<checked_cpp_int>(true);
+   test_fixed<uint128_t>();
+   test_fixed<uint512_t>();
+   test_fixed<checked_uint1024_t>();
+   test_fixed<number<cpp_int_backend<100, 100, unsigned_magnitude, unchecked, void> > >();
+#endif
+#ifdef TEST_MPZ
+   test<mpz_int>(true);
+#endif
+#if defined(TEST_MPZ) && defined(TEST_CPP_INT)
+   //
+   // With the same limb size, cpp_int and mpz_int produce the same sequence:
+   //
+   if (sizeof(mp_limb_t) == sizeof(limb_type))
+   {
+      std::mt19937_64            e1, e2;
+      uniform_int_distribution<cpp_int> d1(cpp_int(-3), cpp_int(1) << 1000);
+      uniform_int_distribution<mpz_int> d2(mpz_int(-3), mpz_int(1) << 1000);
+      for (unsigned i = 0; i < 100; ++i)
+         BOOST_CHECK_EQUAL(d1(e1).str(), d2(e2).str());
+   }
+#endif
+   return boost::report_errors();
+}